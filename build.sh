@@ -2,6 +2,7 @@
 
 INVOCATION_ABS_DIR=`pwd`
 BUILD_TYPE="None"
+BUILD_ATTIC="OFF"
 CMD_LINE_ARGS=""
 
 #-------------------------------------------------------------------
@@ -14,6 +15,7 @@ for ARGI; do
 	printf "  --help, -h                        \n" 
         printf "  --debug,   -d                     \n"
         printf "  --release, -r                     \n"
+        printf "  --attic,   -a                     \n"
 	printf "Notes:                              \n"
 	printf " (1) All other command line args will be passed as args    \n"
 	printf "     to \"make\" when it is eventually invoked.            \n"
@@ -26,6 +28,8 @@ for ARGI; do
         BUILD_TYPE="Debug"
     elif [ "${ARGI}" = "--release" -o "${ARGI}" = "-r" ] ; then
         BUILD_TYPE="Release"
+    elif [ "${ARGI}" = "--attic" -o "${ARGI}" = "-a" ] ; then
+        BUILD_ATTIC="ON"
     else
 	CMD_LINE_ARGS=$CMD_LINE_ARGS" "$ARGI
     fi
@@ -38,7 +42,7 @@ done
 mkdir -p build
 cd build
 
-cmake -DCMAKE_BUILD_TYPE=${BUILD_TYPE} ../
+cmake -DCMAKE_BUILD_TYPE=${BUILD_TYPE} -DBUILD_ATTIC=${BUILD_ATTIC} ../
 
 make ${CMD_LINE_ARGS}
 cd ${INVOCATION_ABS_DIR}
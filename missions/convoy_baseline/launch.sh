@@ -39,6 +39,7 @@ TRANSIT_SPD=0.5
 MAXIMUM_SPD=2.0
 
 CONVOY_VERS=""
+SLOT_ASSIGN=""
 
 USE_CACHE=""
 VLAUNCH_ARGS=" --auto "
@@ -68,6 +69,9 @@ for ARGI; do
 	echo "    The number of contacts to launch. The default is 0. "
 	echo "  --active_convoy, -ac                                  " 
 	echo "    Use Active Convoy Behavior: BHV_ConvoyV21X          "
+	echo "  --slot_assign, -sa                                    " 
+	echo "    Assign convoy slots on shoreside (uFldConvoyAssign) "
+	echo "    instead of the task auction                         "
 	echo "  --nomediate, -nm                                      " 
 	echo "    No use of pMediator for inter-vessel comms          "
 	echo "  --norand                                              " 
@@ -106,6 +110,8 @@ for ARGI; do
         SLAUNCH_ARGS+=" $ARGI"
     elif [ "${ARGI}" = "--active_convoy" -o "${ARGI}" = "-ac" ]; then
         CONVOY_VERS="--active_convoy"
+    elif [ "${ARGI}" = "--slot_assign" -o "${ARGI}" = "-sa" ]; then
+        SLOT_ASSIGN="--slot_assign"
     elif [ "${ARGI:0:6}" = "--amt=" ]; then
         AMT="${ARGI#--amt=*}"
     elif [ "${ARGI:0:8}" = "--mname=" ]; then
@@ -224,6 +230,7 @@ do
     IX_VLAUNCH_ARGS+=" --color=$COLOR  --sim            " 
     IX_VLAUNCH_ARGS+=" --vname=$VNAME  --shore=$SHOREIP "
     IX_VLAUNCH_ARGS+=" $VERBOSE $CONVOY_VERS $MEDIATED  "
+    IX_VLAUNCH_ARGS+=" $SLOT_ASSIGN "
     IX_VLAUNCH_ARGS+=" $TIME_WARP "
 
     #vecho "Launching: $VNAME"
@@ -235,7 +242,7 @@ done
 #-------------------------------------------------------------
 vecho "Launching the shoreside. Args: $SLAUNCH_ARGS $TIME_WARP"
 
-SLAUNCH_ARGS+=" --vnames=$ALL_VNAMES "
+SLAUNCH_ARGS+=" --vnames=$ALL_VNAMES $SLOT_ASSIGN "
 
 ./launch_shoreside.sh $SLAUNCH_ARGS $VERBOSE $TIME_WARP --mname=$MISSION_NAME
 sleep 0.25
@@ -14,6 +14,7 @@ VERBOSE="no"
 CONFIRM="yes"
 AUTO_LAUNCHED="no"
 LAUNCH_GUI="yes"
+SLOT_ASSIGN="no"
 CMD_ARGS=""
 
 IP_ADDR="localhost"
@@ -43,6 +44,8 @@ for ARGI; do
         echo "     Will not launch uMAC as the final step.     "
         echo "  --nogui, -n                                    "
         echo "     Headless mode - no pMarineViewer etc        "
+        echo "  --slot_assign, -sa                             "
+        echo "     Run uFldConvoyAssign for convoy slots       "
         echo "                                                 "
         echo "  --ip=<localhost>                               "
         echo "    Force pHostInfo to use this IP Address       "
@@ -64,6 +67,8 @@ for ARGI; do
         CONFIRM="no"
     elif [ "${ARGI}" = "--nogui" -o "${ARGI}" = "-n" ]; then
         LAUNCH_GUI="no"
+    elif [ "${ARGI}" = "--slot_assign" -o "${ARGI}" = "-sa" ]; then
+        SLOT_ASSIGN="yes"
     elif [ "${ARGI:0:8}" = "--mname=" ]; then
         MISSION_NAME="${ARGI#--mname=*}"
     elif [ "${ARGI:0:5}" = "--ip=" ]; then
@@ -103,7 +108,8 @@ mkdir targs &> /dev/null
 nsplug meta_shoreside.moos targs/targ_shoreside.moos -f WARP=$TIME_WARP \
        PSHARE_PORT=$PSHARE_PORT     VNAMES=$VNAMES                \
        IP_ADDR=$IP_ADDR             LAUNCH_GUI=$LAUNCH_GUI        \
-       MISSION_NAME=$MISSION_NAME   LEADIN_POSX=$LEADIN_POSX LEADIN_POSY=$LEADIN_POSY
+       MISSION_NAME=$MISSION_NAME   LEADIN_POSX=$LEADIN_POSX LEADIN_POSY=$LEADIN_POSY \
+       SLOT_ASSIGN=$SLOT_ASSIGN
 
 if [ ${JUST_MAKE} = "yes" ]; then
     echo "Files assembled; No launches; exiting per request."
@@ -41,6 +41,7 @@ RETURN_POS="5,0"
 TRANSIT_SPD="1.5"  
 MAXIMUM_SPD="1.8"
 CONVOY_ACTIVE="false"
+SLOT_ASSIGN="no"
 
 MTASC=""
 LOG_CLEAN="no"
@@ -98,6 +99,8 @@ for ARGI; do
         echo "     Mission is remotely launched (e.g. MTASC)   "
         echo "  --active_convoy, -ac                           "
         echo "     Set active_convoying=true in BHV_ConvoyV21X "
+        echo "  --slot_assign, -sa                             "
+        echo "     Follow the shoreside uFldConvoyAssign slots "
 	echo "                                                 "
         echo "  --abe,  -A  : abe vehicle.                     "
         echo "  --ben,  -B  : ben vehicle.                     "
@@ -172,6 +175,8 @@ for ARGI; do
 
     elif [ "${ARGI}" = "--active_convoy" -o "${ARGI}" = "-ac" ]; then
 	CONVOY_VERS="active"
+    elif [ "${ARGI}" = "--slot_assign" -o "${ARGI}" = "-sa" ]; then
+	SLOT_ASSIGN="yes"
 
     elif [ "${ARGI}" = "--sim" -o "${ARGI}" = "-s" ]; then
         XMODE="SIM"
@@ -304,7 +309,8 @@ nsplug meta_vehicle.moos targs/targ_$VNAME.moos $NSFLAGS WARP=$TIME_WARP  \
        
 nsplug meta_vehicle.bhv targs/targ_$VNAME.bhv $NSFLAGS VNAME=$VNAME    \
        TRANSIT_SPD=$TRANSIT_SPD     COLOR=$COLOR                 \
-       CONVOY_ACTIVE=$CONVOY_ACTIVE LEADIN_POS=$LEADIN_POS
+       CONVOY_ACTIVE=$CONVOY_ACTIVE LEADIN_POS=$LEADIN_POS       \
+       SLOT_ASSIGN=$SLOT_ASSIGN
        
 if [ "${JUST_MAKE}" = "yes" ]; then
     vecho "Files assembled; nothing launched; exiting per request."
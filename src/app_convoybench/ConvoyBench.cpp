@@ -0,0 +1,374 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoyBench.cpp                                      */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include "ConvoyBench.h"
+#include "MBUtils.h"
+#include "ACTable.h"
+
+using namespace std;
+
+//---------------------------------------------------------
+// Constructor()
+
+ConvoyBench::ConvoyBench()
+{
+  // Config vars
+  m_amt     = 100000;
+  m_seed    = 1;
+  m_verbose = false;
+  setNames("abe,ben,cal,deb,eve,fin");
+
+  // State vars
+  m_recap_text_fails  = 0;
+  m_recap_wire_fails  = 0;
+  m_marker_text_fails = 0;
+  m_marker_wire_fails = 0;
+}
+
+//---------------------------------------------------------
+// Procedure: setAmount()
+
+bool ConvoyBench::setAmount(string str)
+{
+  int ival = atoi(str.c_str());
+  if(!isNumber(str) || (ival <= 0))
+    return(false);
+  m_amt = (unsigned int)(ival);
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setSeed()
+
+bool ConvoyBench::setSeed(string str)
+{
+  if(!isNumber(str) || (str.find_first_not_of("0123456789") != string::npos))
+    return(false);
+  m_seed = strtoull(str.c_str(), 0, 10);
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setNames()
+//   Example: "abe,ben,cal"
+
+bool ConvoyBench::setNames(string str)
+{
+  vector<string> names = parseString(str, ',');
+  if(names.empty())
+    return(false);
+
+  m_names.clear();
+  for(unsigned int i=0; i<names.size(); i++) {
+    string name = tolower(stripBlankEnds(names[i]));
+    if((name == "") || strContainsWhite(name))
+      return(false);
+    m_names.push_back(name);
+  }
+  m_wire_names = ConvoyWireNames();
+  return(m_wire_names.setNames(str));
+}
+
+//---------------------------------------------------------
+// Procedure: run()
+//   Returns: true if every message round-tripped
+
+bool ConvoyBench::run()
+{
+  makeMessages();
+
+  checkRecaps();
+  checkMarkers();
+
+  timeRecaps(false);
+  timeRecaps(true);
+  timeMarkers(false);
+  timeMarkers(true);
+
+  cout << "Messages: " << m_amt << " of each type, seed=" << m_seed;
+  cout << ", names=" << m_names.size() << endl << endl;
+
+  ACTable actab(4);
+  actab << "Message | Msgs/sec | Avg Bytes | Fails";
+  actab.addHeaderLines();
+  for(unsigned int i=0; i<m_labels.size(); i++) {
+    actab << m_labels[i];
+    actab << doubleToStringX(m_rates[i], 0);
+    actab << doubleToStringX(m_bytes[i], 1);
+    actab << uintToString(m_fails[i]);
+  }
+  cout << actab.getFormattedString() << endl;
+
+  unsigned int fails = m_recap_text_fails + m_recap_wire_fails;
+  fails += m_marker_text_fails + m_marker_wire_fails;
+  if(fails > 0) {
+    cout << "FAILED: " << fails << " messages did not round-trip" << endl;
+    return(false);
+  }
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: makeMessages()
+
+void ConvoyBench::makeMessages()
+{
+  m_rng.seed(m_seed);
+
+  m_recaps.clear();
+  m_markers.clear();
+  m_recaps.reserve(m_amt);
+  m_markers.reserve(m_amt);
+  for(unsigned int i=0; i<m_amt; i++) {
+    m_recaps.push_back(randomRecap());
+    m_markers.push_back(randomMarker());
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: randomRecap()
+//      Note: Each optional field is present most of the time, and
+//            a few recaps are idle. Values sit on the resolution
+//            of the text form, so a round trip must be exact.
+
+ConvoyRecap ConvoyBench::randomRecap()
+{
+  ConvoyRecap recap;
+  recap.setConvoyRng(randValue(0, 200, 0.01));
+
+  unsigned int nix = m_rng() % m_names.size();
+  if(randChance(90))
+    recap.setVName(m_names[nix]);
+  if(randChance(90))
+    recap.setCName(m_names[(nix + 1) % m_names.size()]);
+  if(randChance(5)) {
+    recap.setIdle();
+    return(recap);
+  }
+
+  if(randChance(80))
+    recap.setConvoyRngDelta(randValue(0, 50, 0.01));
+  if(randChance(80))
+    recap.setTailRng(randValue(0, 100, 0.01));
+  if(randChance(80))
+    recap.setTailAng(randValue(0, 359.99, 0.01));
+  if(randChance(80)) {
+    recap.setMarkerBng(randValue(0, 359.99, 0.01));
+    recap.setTrackErr(randValue(0, 20, 0.01));
+  }
+  if(randChance(80))
+    recap.setAlignment(randValue(0, 180, 0.01));
+  if(randChance(80))
+    recap.setSetSpd(randValue(0, 3, 0.01));
+  if(randChance(80))
+    recap.setAvg2(randValue(0, 3, 0.01));
+  if(randChance(80))
+    recap.setAvg5(randValue(0, 3, 0.01));
+  if(randChance(50))
+    recap.setCorrMode(randChance(50) ? "close" : "lag");
+  if(randChance(90))
+    recap.setTimeUTC(randValue(1.7e9, 1.8e9, 0.001));
+  if(randChance(80)) {
+    recap.setMarkerX(randValue(-500, 500, 0.01));
+    recap.setMarkerY(randValue(-500, 500, 0.01));
+  }
+  if(randChance(80))
+    recap.setMarkerID(m_rng() % 100000);
+  if(randChance(80))
+    recap.setTailCnt(m_rng() % 50);
+  if(randChance(80))
+    recap.setIndex(m_rng() % 1000000);
+
+  return(recap);
+}
+
+//---------------------------------------------------------
+// Procedure: randomMarker()
+
+ConvoyMarker ConvoyBench::randomMarker()
+{
+  double x = randValue(-1000, 1000, 0.01);
+  double y = randValue(-1000, 1000, 0.01);
+  ConvoyMarker marker(x, y, m_rng() % 100000);
+  if(randChance(90))
+    marker.setVName(m_names[m_rng() % m_names.size()]);
+  if(randChance(90))
+    marker.setUTC(randValue(1.7e9, 1.8e9, 0.001));
+  return(marker);
+}
+
+//---------------------------------------------------------
+// Procedure: randValue()
+//   Returns: A uniform value in [lo,hi] on a multiple of res
+
+double ConvoyBench::randValue(double lo, double hi, double res)
+{
+  long long steps = llround((hi - lo) / res);
+  long long k = (long long)(m_rng() % (unsigned long long)(steps + 1));
+  return((llround(lo / res) + k) * res);
+}
+
+//---------------------------------------------------------
+// Procedure: randChance()
+
+bool ConvoyBench::randChance(double pct)
+{
+  return((double)(m_rng() % 10000) < (pct * 100));
+}
+
+//---------------------------------------------------------
+// Procedure: checkRecaps()
+//      Note: A text spec must decode to a recap that writes the
+//            same spec. A wire spec must decode to a recap that
+//            writes the same text spec as the original.
+
+void ConvoyBench::checkRecaps()
+{
+  for(unsigned int i=0; i<m_recaps.size(); i++) {
+    string spec = m_recaps[i].getSpec();
+
+    string text_spec = string2ConvoyRecap(spec).getSpec();
+    if(text_spec != spec) {
+      m_recap_text_fails++;
+      noteFailure("recap text", spec, text_spec);
+    }
+
+    string wire = m_recaps[i].getWireSpec(&m_wire_names);
+    string wire_spec = string2ConvoyRecap(wire, &m_wire_names).getSpec();
+    if(wire_spec != spec) {
+      m_recap_wire_fails++;
+      noteFailure("recap wire", spec, wire_spec);
+    }
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: checkMarkers()
+
+void ConvoyBench::checkMarkers()
+{
+  for(unsigned int i=0; i<m_markers.size(); i++) {
+    string spec = m_markers[i].getSpec();
+
+    string text_spec = string2ConvoyMarker(spec).getSpec();
+    if(text_spec != spec) {
+      m_marker_text_fails++;
+      noteFailure("marker text", spec, text_spec);
+    }
+
+    string wire = m_markers[i].getWireSpec("", &m_wire_names);
+    string wire_spec = string2ConvoyMarker(wire, &m_wire_names).getSpec();
+    if(wire_spec != spec) {
+      m_marker_wire_fails++;
+      noteFailure("marker wire", spec, wire_spec);
+    }
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: timeRecaps()
+//      Note: One encode and one decode per message. The text form
+//            reuses a single buffer, as a high-rate poster would.
+
+void ConvoyBench::timeRecaps(bool wire)
+{
+  double bytes = 0;
+  double sink  = 0;
+  string buf;
+
+  auto start = chrono::steady_clock::now();
+  for(unsigned int i=0; i<m_recaps.size(); i++) {
+    if(wire) {
+      buf = m_recaps[i].getWireSpec(&m_wire_names);
+      sink += string2ConvoyRecap(buf, &m_wire_names).getConvoyRng();
+    }
+    else {
+      m_recaps[i].writeSpec(buf);
+      sink += string2ConvoyRecap(buf).getConvoyRng();
+    }
+    bytes += buf.size();
+  }
+  auto end = chrono::steady_clock::now();
+  double secs = chrono::duration<double>(end - start).count();
+
+  if(m_verbose)
+    cout << "recap checksum: " << doubleToString(sink, 2) << endl;
+
+  if(wire)
+    addResult("recap wire", secs, bytes, m_recap_wire_fails);
+  else
+    addResult("recap text", secs, bytes, m_recap_text_fails);
+}
+
+//---------------------------------------------------------
+// Procedure: timeMarkers()
+
+void ConvoyBench::timeMarkers(bool wire)
+{
+  double bytes = 0;
+  double sink  = 0;
+  string buf;
+
+  auto start = chrono::steady_clock::now();
+  for(unsigned int i=0; i<m_markers.size(); i++) {
+    if(wire) {
+      buf = m_markers[i].getWireSpec("", &m_wire_names);
+      sink += string2ConvoyMarker(buf, &m_wire_names).getX();
+    }
+    else {
+      m_markers[i].writeSpec(buf);
+      sink += string2ConvoyMarker(buf).getX();
+    }
+    bytes += buf.size();
+  }
+  auto end = chrono::steady_clock::now();
+  double secs = chrono::duration<double>(end - start).count();
+
+  if(m_verbose)
+    cout << "marker checksum: " << doubleToString(sink, 2) << endl;
+
+  if(wire)
+    addResult("marker wire", secs, bytes, m_marker_wire_fails);
+  else
+    addResult("marker text", secs, bytes, m_marker_text_fails);
+}
+
+//---------------------------------------------------------
+// Procedure: addResult()
+
+void ConvoyBench::addResult(string label, double secs, double bytes,
+			    unsigned int fails)
+{
+  double rate = 0;
+  if(secs > 0)
+    rate = (double)(m_amt) / secs;
+
+  m_labels.push_back(label);
+  m_rates.push_back(rate);
+  m_bytes.push_back(bytes / (double)(m_amt));
+  m_fails.push_back(fails);
+}
+
+//---------------------------------------------------------
+// Procedure: noteFailure()
+
+void ConvoyBench::noteFailure(string label, const string& expected,
+			      const string& got)
+{
+  if(!m_verbose)
+    return;
+  cout << label << " mismatch:" << endl;
+  cout << "  sent: " << expected << endl;
+  cout << "  got:  " << got << endl;
+}
@@ -0,0 +1,77 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoyBench.h                                        */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef CONVOY_BENCH_HEADER
+#define CONVOY_BENCH_HEADER
+
+#include <string>
+#include <vector>
+#include <random>
+#include "ConvoyRecap.h"
+#include "ConvoyMarker.h"
+#include "ConvoyWire.h"
+
+class ConvoyBench
+{
+ public:
+  ConvoyBench();
+  virtual ~ConvoyBench() {}
+
+  bool setAmount(std::string);
+  bool setSeed(std::string);
+  bool setNames(std::string);
+
+  void setVerbose(bool v) {m_verbose=v;}
+
+ public:
+  bool run();
+
+ protected:
+  void makeMessages();
+  ConvoyRecap  randomRecap();
+  ConvoyMarker randomMarker();
+  double randValue(double lo, double hi, double res);
+  bool   randChance(double pct);
+
+  void checkRecaps();
+  void checkMarkers();
+  void timeRecaps(bool wire);
+  void timeMarkers(bool wire);
+  void addResult(std::string label, double secs, double bytes,
+		 unsigned int fails);
+  void noteFailure(std::string label, const std::string& expected,
+		   const std::string& got);
+
+ protected: // Config variables
+  unsigned int             m_amt;
+  unsigned long long       m_seed;
+  std::vector<std::string> m_names;
+  bool                     m_verbose;
+
+ protected: // State variables
+  std::mt19937_64 m_rng;
+  ConvoyWireNames m_wire_names;
+
+  std::vector<ConvoyRecap>  m_recaps;
+  std::vector<ConvoyMarker> m_markers;
+
+  unsigned int m_recap_text_fails;
+  unsigned int m_recap_wire_fails;
+  unsigned int m_marker_text_fails;
+  unsigned int m_marker_wire_fails;
+
+  std::vector<std::string> m_labels;
+  std::vector<double>      m_rates;
+  std::vector<double>      m_bytes;
+  std::vector<unsigned int> m_fails;
+};
+
+#endif
@@ -0,0 +1,75 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoyBench_Info.cpp                                 */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cstdlib> 
+#include <iostream>
+#include "ColorParse.h"
+#include "ReleaseInfo.h"
+#include "ConvoyBench_Info.h"
+
+using namespace std;
+
+//----------------------------------------------------------------
+// Procedure: showSynopsis
+
+void showSynopsis()
+{
+  blk("SYNOPSIS:                                                       ");
+  blk("------------------------------------                            ");
+  blk("  convoybench round-trips randomized ConvoyRecap and            ");
+  blk("  ConvoyMarker messages through the key=value text form and     ");
+  blk("  the compact wire form, checks that each decodes back to the   ");
+  blk("  same message, and reports encode+decode messages per second.  ");
+  blk("  Exits with 1 if any message fails to round-trip.              ");
+}
+
+//----------------------------------------------------------------
+// Procedure: showHelpAndExit
+
+void showHelpAndExit()
+{
+  cout << "=====================================================" << endl;
+  cout << "Usage: convoybench [OPTIONS]                         " << endl;
+  cout << "=====================================================" << endl;
+  cout << "                                                     " << endl;
+  showSynopsis();
+  cout << "                                                     " << endl;
+  cout << "Options:                                             " << endl;
+  cout << "  --help, -h                                         " << endl;
+  cout << "     Display this help message.                      " << endl;
+  cout << "  --version,-v                                       " << endl;
+  cout << "     Display the release version of convoybench.     " << endl;
+  cout << "  --verbose                                          " << endl;
+  cout << "     Show each failed message and a sample of specs. " << endl;
+  cout << "  --amt=<num>                                        " << endl;
+  cout << "     Number of random messages of each type. The     " << endl;
+  cout << "     default is 100000.                              " << endl;
+  cout << "  --seed=<num>                                       " << endl;
+  cout << "     Seed for the random messages. The default is 1. " << endl;
+  cout << "  --names=<name,name,...>                            " << endl;
+  cout << "     Vehicle names, also used as the wire name table." << endl;
+  cout << "     The default is abe,ben,cal,deb,eve,fin.         " << endl;
+  cout << "                                                     " << endl;
+  cout << "Examples:                                            " << endl;
+  cout << "  $ convoybench                                      " << endl;
+  cout << "  $ convoybench --amt=1000000 --seed=7               " << endl;
+  cout << "                                                     " << endl;
+  exit(0);
+}
+
+//----------------------------------------------------------------
+// Procedure: showReleaseInfoAndExit
+
+void showReleaseInfoAndExit()
+{
+  showReleaseInfo("convoybench", "gpl");
+  exit(0);
+}
@@ -0,0 +1,56 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: main.cpp                                             */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <iostream>
+#include "MBUtils.h"
+#include "ConvoyBench.h"
+#include "ConvoyBench_Info.h"
+
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+  ConvoyBench convoybench;
+
+  bool verbose = false;
+
+  for(int i=1; i<argc; i++) {
+    bool   handled = false;
+    
+    string argi = argv[i];
+
+    if((argi=="-v") || (argi=="--version") || (argi=="-version"))
+      showReleaseInfoAndExit();
+    else if((argi=="-h") || (argi == "--help") || (argi=="-help"))
+      showHelpAndExit();
+    else if(argi=="--verbose") {
+      verbose=true;
+      handled = true;
+    }
+    else if(strBegins(argi, "--amt="))
+      handled = convoybench.setAmount(argi.substr(6));
+    else if(strBegins(argi, "--seed="))
+      handled = convoybench.setSeed(argi.substr(7));
+    else if(strBegins(argi, "--names="))
+      handled = convoybench.setNames(argi.substr(8));
+
+    if(!handled) {
+      cout << "Unhandled arg: " << argi << endl;
+      return(1);
+    }
+  }
+
+  convoybench.setVerbose(verbose);
+  if(!convoybench.run())
+    return(1);
+
+  return(0);
+}
@@ -0,0 +1,409 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoySim.cpp                                        */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include "ConvoySim.h"
+#include "MBUtils.h"
+#include "ACTable.h"
+#include "AngleUtils.h"
+
+using namespace std;
+
+//---------------------------------------------------------
+// Constructor()
+
+ConvoySim::ConvoySim()
+{
+  // Config variables
+  m_vehicles  = 4;
+  m_duration  = 3600;
+  m_time_step = 0.25;   // Matches a helm AppTick of 4
+  m_spacing   = 10;
+  m_lead_spd  = 1.5;
+  m_model     = "v21x";
+  m_format    = "table";
+  m_verbose   = false;
+
+  // State variables
+  m_curr_time = 0;
+  m_steps     = 0;
+}
+
+//---------------------------------------------------------
+// Procedure: setVehicles()
+//      Note: Total vehicles, including the leader
+
+bool ConvoySim::setVehicles(string str)
+{
+  if(!isNumber(str))
+    return(false);
+  int ival = atoi(str.c_str());
+  if(ival < 2)
+    return(false);
+  m_vehicles = (unsigned int)(ival);
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setDuration()
+
+bool ConvoySim::setDuration(string str)
+{
+  return(setPosDoubleOnString(m_duration, str));
+}
+
+//---------------------------------------------------------
+// Procedure: setTimeStep()
+
+bool ConvoySim::setTimeStep(string str)
+{
+  return(setPosDoubleOnString(m_time_step, str));
+}
+
+//---------------------------------------------------------
+// Procedure: setSpacing()
+
+bool ConvoySim::setSpacing(string str)
+{
+  return(setPosDoubleOnString(m_spacing, str));
+}
+
+//---------------------------------------------------------
+// Procedure: setLeadSpeed()
+
+bool ConvoySim::setLeadSpeed(string str)
+{
+  return(setPosDoubleOnString(m_lead_spd, str));
+}
+
+//---------------------------------------------------------
+// Procedure: setLeadPath()
+//   Example: "0,0:120,0:120,-60:0,-60"
+
+bool ConvoySim::setLeadPath(string str)
+{
+  vector<double> ptx, pty;
+  vector<string> svector = parseString(str, ':');
+  for(unsigned int i=0; i<svector.size(); i++) {
+    string xstr = stripBlankEnds(biteStringX(svector[i], ','));
+    string ystr = stripBlankEnds(svector[i]);
+    if(!isNumber(xstr) || !isNumber(ystr))
+      return(false);
+    ptx.push_back(atof(xstr.c_str()));
+    pty.push_back(atof(ystr.c_str()));
+  }
+  if(ptx.size() < 2)
+    return(false);
+
+  m_lead_ptx = ptx;
+  m_lead_pty = pty;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setModel()
+//   Options: v21x (BHV_ConvoyV21X), pd (BHV_ConvoyPD)
+
+bool ConvoySim::setModel(string str)
+{
+  str = tolower(str);
+  if((str != "v21x") && (str != "pd"))
+    return(false);
+  m_model = str;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setFormat()
+//   Options: table, csv, report
+
+bool ConvoySim::setFormat(string str)
+{
+  str = tolower(str);
+  if((str != "table") && (str != "csv") && (str != "report"))
+    return(false);
+  m_format = str;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setLabel()
+//      Note: First column of csv output, to tag each run of a
+//            parameter study.
+
+bool ConvoySim::setLabel(string str)
+{
+  if(strContainsWhite(str) || strContains(str, ","))
+    return(false);
+  m_label = str;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: addAgentParam()
+//   Example: "ideal_convoy_range=12"
+//      Note: Applied to every vehicle. Checked once agents are
+//            created, so errors are reported there.
+
+bool ConvoySim::addAgentParam(string str)
+{
+  if(!strContains(str, "="))
+    return(false);
+  m_agent_params.push_back(str);
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: addEvalParam()
+//   Example: "tracking_thresh=1.2"
+
+bool ConvoySim::addEvalParam(string str)
+{
+  if(!strContains(str, "="))
+    return(false);
+  m_eval_params.push_back(str);
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: run()
+
+bool ConvoySim::run()
+{
+  if(!initAgents())
+    return(false);
+
+  auto wall_start = chrono::steady_clock::now();
+
+  unsigned int total_steps = (unsigned int)(ceil(m_duration / m_time_step));
+  for(unsigned int i=0; i<total_steps; i++)
+    step();
+
+  auto wall_end = chrono::steady_clock::now();
+  double elapsed = chrono::duration<double>(wall_end - wall_start).count();
+
+  printResults(elapsed);
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: initAgents()
+//      Note: The convoy starts in a line behind the leader,
+//            at rest, pointed at the first lead point.
+
+bool ConvoySim::initAgents()
+{
+  if(m_lead_ptx.empty())
+    setLeadPath("0,0:120,0:120,-60:0,-60");
+
+  m_agents.clear();
+  m_engines.clear();
+
+  double hdg = relAng(m_lead_ptx[0], m_lead_pty[0],
+		      m_lead_ptx[1], m_lead_pty[1]);
+  double rads = hdg * M_PI / 180;
+
+  for(unsigned int i=0; i<m_vehicles; i++) {
+    string vname = "v" + uintToString(i);
+    ConvoySimAgent agent(vname);
+    agent.setModel(m_model);
+    if(i > 0)
+      agent.setContact("v" + uintToString(i-1));
+
+    for(unsigned int j=0; j<m_agent_params.size(); j++) {
+      string value = m_agent_params[j];
+      string param = biteStringX(value, '=');
+      if(!agent.setParam(param, value)) {
+	cout << "Bad vehicle param: " << m_agent_params[j] << endl;
+	return(false);
+      }
+    }
+    string status = agent.checkParams();
+    if(status != "") {
+      cout << "Bad vehicle config: " << status << endl;
+      return(false);
+    }
+    agent.onParamsComplete();
+
+    double back = m_spacing * i;
+    agent.setPose(m_lead_ptx[0] - sin(rads) * back,
+		  m_lead_pty[0] - cos(rads) * back, hdg, 0);
+    agent.setLeadSpeed(m_lead_spd);
+    for(unsigned int j=0; j<m_lead_ptx.size(); j++)
+      agent.addLeadPoint(m_lead_ptx[j], m_lead_pty[j]);
+
+    m_agents.push_back(agent);
+  }
+
+  // One engine per follower, as with pEvalConvoy on each vehicle
+  for(unsigned int i=1; i<m_agents.size(); i++) {
+    EvalConvoyEngine engine;
+    for(unsigned int j=0; j<m_eval_params.size(); j++) {
+      string value = m_eval_params[j];
+      string param = biteStringX(value, '=');
+      if(!engine.setParam(param, value)) {
+	cout << "Bad eval param: " << m_eval_params[j] << endl;
+	return(false);
+      }
+    }
+
+    ConvoyStatRecap stat_recap;
+    m_agents[i].buildStatRecap(stat_recap);
+    engine.handleStatRecap(stat_recap);
+    engine.handleSpdPolicy(m_agents[i].getSpdPolicy());
+
+    // Stat recaps from the rest of the convoy, for ordering
+    for(unsigned int j=1; j<m_agents.size(); j++) {
+      if(j == i)
+	continue;
+      ConvoyStatRecap ally_recap;
+      m_agents[j].buildStatRecap(ally_recap);
+      engine.handleStatRecapAlly(ally_recap);
+    }
+    m_engines.push_back(engine);
+  }
+
+  m_curr_time = 0;
+  m_steps = 0;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: step()
+//      Note: All vehicles decide on the same snapshot of the
+//            world, then all move. Lead points of the pd model
+//            are handed down the convoy in between, and are
+//            acted on in the next step. The first recap is made at
+//            the end of the first step so the engine time never
+//            starts at zero (zero means "no recap yet").
+
+void ConvoySim::step()
+{
+  m_curr_time += m_time_step;
+
+  m_agents[0].decideLead();
+  for(unsigned int i=1; i<m_agents.size(); i++)
+    m_agents[i].decideFollow(m_agents[i-1], m_curr_time);
+
+  // Points passed on by the tail vehicle are dropped
+  for(unsigned int i=0; i<m_agents.size(); i++) {
+    vector<ConvoySimPoint> points = m_agents[i].takeSentPoints();
+    if((i+1) < m_agents.size())
+      m_agents[i+1].receivePoints(points);
+  }
+
+  for(unsigned int i=0; i<m_agents.size(); i++)
+    m_agents[i].move(m_time_step);
+
+  for(unsigned int i=1; i<m_agents.size(); i++) {
+    EvalConvoyEngine& engine = m_engines[i-1];
+    m_agents[i].buildRecap(m_recap, m_curr_time);
+    engine.setCurrTime(m_curr_time);
+    engine.handleRecap(m_recap);
+    engine.updateMetrics();
+  }
+  m_steps++;
+}
+
+//---------------------------------------------------------
+// Procedure: printResults()
+
+void ConvoySim::printResults(double elapsed)
+{
+  if(m_format == "csv")
+    printCSV();
+  else if(m_format == "report")
+    printReports();
+  else
+    printTable(elapsed);
+}
+
+//---------------------------------------------------------
+// Procedure: printTable()
+
+void ConvoySim::printTable(double elapsed)
+{
+  if(m_verbose)
+    cout << m_arg_summary << endl;
+
+  double sim_mins = m_curr_time / 60;
+  cout << "Simulated: " << doubleToStringX(sim_mins, 1) << " mins, ";
+  cout << m_agents.size() << " vehicles, " << m_steps << " steps, ";
+  cout << "model " << m_model << endl;
+  cout << "Wall time: " << doubleToStringX(elapsed, 3) << " secs";
+  if(elapsed > 0)
+    cout << " (" << doubleToStringX(sim_mins / elapsed, 0) << " sim mins/sec)";
+  cout << endl << endl;
+
+  ACTable actab(9);
+  actab << "Vehicle | OnTail | Aligned | Tethered | Fastened | Tracking";
+  actab << "RngSwitch | Dropped | Odometry";
+  actab.addHeaderLines();
+  for(unsigned int i=1; i<m_agents.size(); i++) {
+    const EvalConvoyEngine& engine = m_engines[i-1];
+    actab << m_agents[i].getVName();
+    actab << engine.getStrDouble("pct_time_on_tail", 1);
+    actab << engine.getStrDouble("pct_time_aligned", 1);
+    actab << engine.getStrDouble("pct_time_tethered", 1);
+    actab << engine.getStrDouble("pct_time_fastened", 1);
+    actab << engine.getStrDouble("pct_time_tracking", 1);
+    actab << engine.getStrUInt("rng_switches");
+    actab << uintToString(m_agents[i].getDroppedMarkers());
+    actab << doubleToStringX(m_agents[i].getOdometry(), 0);
+  }
+  cout << actab.getFormattedString() << endl;
+}
+
+//---------------------------------------------------------
+// Procedure: printCSV()
+//      Note: One line per follower, suited to appending the
+//            results of many runs into one file.
+
+void ConvoySim::printCSV()
+{
+  if(m_verbose) {
+    cout << "label,vname,leader,pct_on_tail,pct_aligned,pct_tethered,";
+    cout << "pct_fastened,pct_tracking,rng_switches,dropped,odometry" << endl;
+  }
+
+  for(unsigned int i=1; i<m_agents.size(); i++) {
+    const EvalConvoyEngine& engine = m_engines[i-1];
+    cout << m_label << ",";
+    cout << m_agents[i].getVName() << ",";
+    cout << m_agents[i].getContact() << ",";
+    cout << engine.getStrDouble("pct_time_on_tail") << ",";
+    cout << engine.getStrDouble("pct_time_aligned") << ",";
+    cout << engine.getStrDouble("pct_time_tethered") << ",";
+    cout << engine.getStrDouble("pct_time_fastened") << ",";
+    cout << engine.getStrDouble("pct_time_tracking") << ",";
+    cout << engine.getStrUInt("rng_switches") << ",";
+    cout << m_agents[i].getDroppedMarkers() << ",";
+    cout << doubleToStringX(m_agents[i].getOdometry(), 1) << endl;
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: printReports()
+//      Note: Full EvalConvoyEngine report, per follower
+
+void ConvoySim::printReports()
+{
+  for(unsigned int i=1; i<m_agents.size(); i++) {
+    cout << "==========================================" << endl;
+    cout << "Vehicle: " << m_agents[i].getVName() << endl;
+    cout << "==========================================" << endl;
+    vector<string> lines = m_engines[i-1].buildReport();
+    for(unsigned int j=0; j<lines.size(); j++)
+      cout << lines[j] << endl;
+  }
+}
@@ -0,0 +1,81 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoySim.h                                          */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef CONVOY_SIM_HEADER
+#define CONVOY_SIM_HEADER
+
+#include <string>
+#include <vector>
+#include "ConvoySimAgent.h"
+#include "EvalConvoyEngine.h"
+
+class ConvoySim
+{
+ public:
+  ConvoySim();
+  virtual ~ConvoySim() {}
+
+  bool setVehicles(std::string);
+  bool setDuration(std::string);
+  bool setTimeStep(std::string);
+  bool setSpacing(std::string);
+  bool setLeadSpeed(std::string);
+  bool setLeadPath(std::string);
+  bool setModel(std::string);
+  bool setFormat(std::string);
+  bool setLabel(std::string);
+  bool addAgentParam(std::string);
+  bool addEvalParam(std::string);
+
+  void setVerbose(bool v)               {m_verbose=v;}
+  void setArgSummary(std::string str)   {m_arg_summary=str;}
+
+ public:
+  bool run();
+
+ protected:
+  bool initAgents();
+  void step();
+  void printResults(double elapsed);
+  void printTable(double elapsed);
+  void printCSV();
+  void printReports();
+
+ protected: // Config variables
+  unsigned int m_vehicles;
+  double       m_duration;
+  double       m_time_step;
+  double       m_spacing;
+  double       m_lead_spd;
+  std::string  m_model;
+  std::string  m_format;
+  std::string  m_label;
+  bool         m_verbose;
+  std::string  m_arg_summary;
+
+  std::vector<double>      m_lead_ptx;
+  std::vector<double>      m_lead_pty;
+  std::vector<std::string> m_agent_params;
+  std::vector<std::string> m_eval_params;
+
+ protected: // State variables
+  double m_curr_time;
+  unsigned int m_steps;
+
+  // Agent 0 is the leader, agent i follows agent i-1.
+  // Engine i-1 evaluates agent i.
+  std::vector<ConvoySimAgent>   m_agents;
+  std::vector<EvalConvoyEngine> m_engines;
+
+  ConvoyRecap m_recap;
+};
+
+#endif
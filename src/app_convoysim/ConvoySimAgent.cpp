@@ -0,0 +1,347 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoySimAgent.cpp                                   */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cmath>
+#include <cstdlib>
+#include "ConvoySimAgent.h"
+#include "MBUtils.h"
+#include "AngleUtils.h"
+
+using namespace std;
+
+//-----------------------------------------------------------
+// Constructor()
+
+ConvoySimAgent::ConvoySimAgent(string vname)
+{
+  // Config variables (vehicle)
+  m_max_spd       = 3;
+  m_max_turn_rate = 30;   // degrees/sec
+  m_max_accel     = 0.5;  // m/s^2
+  m_max_decel     = 0.5;  // m/s^2
+
+  // Config variables (lead vehicle)
+  m_lead_spd = 1.5;
+  m_lead_capture_radius = 3;
+
+  // State variables (vehicle)
+  m_vname = vname;
+  m_x   = 0;
+  m_y   = 0;
+  m_hdg = 0;
+  m_spd = 0;
+  m_odometry = 0;
+  m_des_hdg  = 0;
+  m_des_spd  = 0;
+  m_lead_ix  = 0;
+
+  // Convoy behavior, v21x params as in convoy_mit
+  m_model = "v21x";
+  m_follower.setParam("capture_radius", "3");
+  m_follower.setParam("slip_radius", "15");
+  m_follower.setParam("aft_patience", "true");
+  m_follower.setParam("inter_mark_range", "3");
+  m_follower.setParam("tail_length_max", "10");
+  m_follower.setParam("full_stop_convoy_range", "2");
+  m_follower.setParam("slower_convoy_range", "5");
+  m_follower.setParam("ideal_convoy_range", "8");
+  m_follower.setParam("faster_convoy_range", "12");
+  m_follower.setParam("full_lag_convoy_range", "16");
+  m_follower.setParam("lag_speed_delta", "0.8");
+
+  // Convoy behavior, pd params as in convoy_baseline, except the
+  // follow range is matched to the ideal_convoy_range above, as
+  // the recaps of both models are scored against the same policy
+  m_pd_policy.setParam("desired_speed", "1.2");
+  m_pd_policy.setParam("point_update_distance", "0.5");
+  m_pd_policy.setParam("ideal_follow_range", "8");
+  m_pd_policy.setParam("kp_spd", "0.1");
+  m_pd_policy.setParam("kd_spd", "0.1");
+
+  m_recap_index = 0;
+}
+
+//-----------------------------------------------------------
+// Procedure: setParam()
+//      Note: Convoy params use the same names as the behaviors
+//            so a block from a .bhv file may be reused as is.
+
+bool ConvoySimAgent::setParam(string param, string value)
+{
+  param = tolower(param);
+  value = stripBlankEnds(value);
+
+  if(m_follower.setParam(param, value))
+    return(true);
+  if(m_pd_policy.setParam(param, value))
+    return(true);
+
+  bool handled = false;
+  if(param == "max_spd")
+    handled = setPosDoubleOnString(m_max_spd, value);
+  else if(param == "turn_rate")
+    handled = setPosDoubleOnString(m_max_turn_rate, value);
+  else if(param == "accel")
+    handled = setPosDoubleOnString(m_max_accel, value);
+  else if(param == "decel")
+    handled = setPosDoubleOnString(m_max_decel, value);
+
+  return(handled);
+}
+
+//-----------------------------------------------------------
+// Procedure: checkParams()
+//   Returns: Empty string if ok, error message otherwise.
+
+string ConvoySimAgent::checkParams()
+{
+  return(m_follower.checkParams());
+}
+
+//-----------------------------------------------------------
+// Procedure: onParamsComplete()
+
+void ConvoySimAgent::onParamsComplete()
+{
+  m_follower.onParamsComplete(m_vname);
+}
+
+//-----------------------------------------------------------
+// Procedure: setModel()
+//   Options: v21x, pd
+
+bool ConvoySimAgent::setModel(string model)
+{
+  model = tolower(model);
+  if((model != "v21x") && (model != "pd"))
+    return(false);
+  m_model = model;
+  return(true);
+}
+
+//-----------------------------------------------------------
+// Procedure: setPose()
+
+void ConvoySimAgent::setPose(double x, double y, double hdg, double spd)
+{
+  m_x   = x;
+  m_y   = y;
+  m_hdg = angle360(hdg);
+  m_spd = spd;
+
+  m_des_hdg = m_hdg;
+  m_des_spd = m_spd;
+}
+
+//-----------------------------------------------------------
+// Procedure: addLeadPoint()
+
+bool ConvoySimAgent::addLeadPoint(double x, double y)
+{
+  m_lead_ptx.push_back(x);
+  m_lead_pty.push_back(y);
+  return(true);
+}
+
+//-----------------------------------------------------------
+// Procedure: decideLead()
+//      Note: Cycle through the lead points, like a waypoint
+//            behavior with repeat=forever. In the pd model the
+//            leader also seeds lead points for its follower.
+
+void ConvoySimAgent::decideLead()
+{
+  if((m_model == "pd") && m_pd_policy.seedPoint(m_x, m_y)) {
+    ConvoySimPoint point = {m_x, m_y, m_spd};
+    m_pd_sent.push_back(point);
+  }
+
+  if(m_lead_ptx.empty()) {
+    m_des_hdg = m_hdg;
+    m_des_spd = m_lead_spd;
+    return;
+  }
+
+  double ptx = m_lead_ptx[m_lead_ix];
+  double pty = m_lead_pty[m_lead_ix];
+  if(hypot(ptx-m_x, pty-m_y) < m_lead_capture_radius) {
+    m_lead_ix = (m_lead_ix + 1) % m_lead_ptx.size();
+    ptx = m_lead_ptx[m_lead_ix];
+    pty = m_lead_pty[m_lead_ix];
+  }
+
+  m_des_hdg = relAng(m_x, m_y, ptx, pty);
+  m_des_spd = m_lead_spd;
+}
+
+//-----------------------------------------------------------
+// Procedure: decideFollow()
+//      Note: Same ConvoyFollower calls, in the same order, as
+//            BHV_ConvoyV21X::onRunState() with a passive tail.
+
+void ConvoySimAgent::decideFollow(const ConvoySimAgent& contact,
+				  double curr_time)
+{
+  m_follower.setOwnship(m_x, m_y, m_hdg);
+  m_follower.setContact(contact.getX(), contact.getY(),
+			contact.getHdg(), contact.getSpd());
+
+  // Part 1: Marker updates
+  m_follower.checkDropAftMarker();
+  m_follower.getMarkerTail().handleNewContactPos(contact.getX(),
+						 contact.getY(),
+						 contact.getHdg());
+
+  // Part 2: Speed from policy and metrics
+  m_follower.handleNewContactSpd(contact.getSpd(), curr_time);
+  m_follower.updateSetSpeed();
+  m_follower.updateMetrics();
+  m_follower.setCurrentMarker();
+
+  if(m_model == "pd") {
+    decideFollowPD(contact);
+    return;
+  }
+
+  // Part 3: With aft patience the behavior produces no objective
+  // function when closer to other parts of the tail. With no
+  // other behaviors, the helm then posts an all-stop.
+  if(m_follower.holding()) {
+    m_des_hdg = m_hdg;
+    m_des_spd = 0;
+    return;
+  }
+
+  m_des_hdg = relAng(m_x, m_y, m_follower.getWptX(), m_follower.getWptY());
+  m_des_spd = m_follower.getSetSpeed();
+}
+
+//-----------------------------------------------------------
+// Procedure: decideFollowPD()
+//      Note: As BHV_ConvoyPD::onRunState() for a follower. The
+//            behavior has zero priority with an empty queue, so
+//            with no other behaviors the helm posts an all-stop.
+
+void ConvoySimAgent::decideFollowPD(const ConvoySimAgent& contact)
+{
+  // Part 1: Capture the oldest point and pass it on
+  if(!m_pd_queue.empty()) {
+    ConvoySimPoint point = m_pd_queue.front();
+    if(m_pd_policy.pointCaptured(m_x, m_y, point.x, point.y)) {
+      m_pd_queue.pop_front();
+      m_pd_sent.push_back(point);
+    }
+  }
+
+  if(m_pd_queue.empty()) {
+    m_des_hdg = m_hdg;
+    m_des_spd = 0;
+    return;
+  }
+
+  // Part 2: Distance to the contact along the queue
+  double dist = 0;
+  double prev_x = m_x;
+  double prev_y = m_y;
+  list<ConvoySimPoint>::iterator p;
+  for(p = m_pd_queue.begin(); p != m_pd_queue.end(); p++) {
+    dist += hypot(p->x - prev_x, p->y - prev_y);
+    prev_x = p->x;
+    prev_y = p->y;
+  }
+  dist += hypot(contact.getX() - prev_x, contact.getY() - prev_y);
+
+  // Part 3: Steer to the oldest point at the PD speed
+  ConvoySimPoint point = m_pd_queue.front();
+  m_des_hdg = relAng(m_x, m_y, point.x, point.y);
+  m_des_spd = m_pd_policy.getSpdFromPolicy(dist, point.spd, m_spd);
+}
+
+//-----------------------------------------------------------
+// Procedure: receivePoints()
+
+void ConvoySimAgent::receivePoints(const vector<ConvoySimPoint>& points)
+{
+  for(unsigned int i=0; i<points.size(); i++)
+    m_pd_queue.push_back(points[i]);
+}
+
+//-----------------------------------------------------------
+// Procedure: takeSentPoints()
+//   Returns: Points seeded or captured since the last call
+
+vector<ConvoySimPoint> ConvoySimAgent::takeSentPoints()
+{
+  vector<ConvoySimPoint> points;
+  points.swap(m_pd_sent);
+  return(points);
+}
+
+//-----------------------------------------------------------
+// Procedure: move()
+
+void ConvoySimAgent::move(double dt)
+{
+  if(dt <= 0)
+    return;
+
+  // Part 1: Heading, limited by the turn rate
+  double hdg_delta = angle180(m_des_hdg - m_hdg);
+  double max_delta = m_max_turn_rate * dt;
+  if(hdg_delta > max_delta)
+    hdg_delta = max_delta;
+  else if(hdg_delta < -max_delta)
+    hdg_delta = -max_delta;
+  m_hdg = angle360(m_hdg + hdg_delta);
+
+  // Part 2: Speed, limited by accel/decel and max speed
+  double des_spd = vclip(m_des_spd, 0, m_max_spd);
+  double spd_delta = des_spd - m_spd;
+  if(spd_delta > (m_max_accel * dt))
+    spd_delta = m_max_accel * dt;
+  else if(spd_delta < -(m_max_decel * dt))
+    spd_delta = -(m_max_decel * dt);
+  m_spd += spd_delta;
+
+  // Part 3: Position
+  double rads = m_hdg * M_PI / 180;
+  double dist = m_spd * dt;
+  m_x += sin(rads) * dist;
+  m_y += cos(rads) * dist;
+  m_odometry += dist;
+}
+
+//-----------------------------------------------------------
+// Procedure: buildRecap()
+//      Note: In the pd model the set speed is the PD speed
+
+void ConvoySimAgent::buildRecap(ConvoyRecap& recap, double curr_time)
+{
+  m_follower.buildRecap(recap);
+  if(m_model == "pd")
+    recap.setSetSpd(m_des_spd);
+
+  recap.setVName(m_vname);
+  recap.setIndex(m_recap_index);
+  recap.setTimeUTC(curr_time);
+  m_recap_index++;
+}
+
+//-----------------------------------------------------------
+// Procedure: buildStatRecap()
+
+void ConvoySimAgent::buildStatRecap(ConvoyStatRecap& recap) const
+{
+  recap.setLeader(m_contact);
+  recap.setFollower(m_vname);
+  recap.setIdealRng(m_follower.getSpdPolicy().getIdealConvoyRng());
+  recap.setCompression(m_follower.getCompression());
+}
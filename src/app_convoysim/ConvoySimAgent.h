@@ -0,0 +1,136 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoySimAgent.h                                     */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef CONVOY_SIM_AGENT_HEADER
+#define CONVOY_SIM_AGENT_HEADER
+
+#include <string>
+#include <vector>
+#include <list>
+#include "ConvoyFollower.h"
+#include "ConvoyPDPolicy.h"
+#include "ConvoySpdPolicy.h"
+#include "ConvoyRecap.h"
+#include "ConvoyStatRecap.h"
+
+//---------------------------------------------------------------
+// ConvoySimPoint: a lead point of the PD model, as seeded by the
+// leader and passed down the convoy as each vehicle captures it.
+
+struct ConvoySimPoint
+{
+  double x;
+  double y;
+  double spd;
+};
+
+//---------------------------------------------------------------
+// ConvoySimAgent: one simulated vehicle. Kinematics are a simple
+// rate-limited point model (heading rate, accel, decel), in place
+// of uSimMarine. A lead vehicle cycles through a set of waypoints.
+// A follower makes its helm decision with the same lib_convoyz
+// classes as the behaviors, taken to be the behavior's set point:
+//   v21x: ConvoyFollower, as BHV_ConvoyV21X (passive tail)
+//   pd:   ConvoyPDPolicy, as BHV_ConvoyPD
+// In either model the ConvoyFollower marker tail and metrics are
+// kept, so both are scored with the same convoy recaps.
+
+class ConvoySimAgent
+{
+ public:
+  ConvoySimAgent(std::string vname="");
+  ~ConvoySimAgent() {}
+
+  bool setParam(std::string, std::string);
+  std::string checkParams();
+  void onParamsComplete();
+
+  bool setModel(std::string);
+  void setVName(std::string s)   {m_vname=s;}
+  void setContact(std::string s) {m_contact=s;}
+  void setPose(double x, double y, double hdg, double spd);
+
+  bool addLeadPoint(double x, double y);
+  void setLeadSpeed(double v)    {m_lead_spd=v;}
+
+  // Decide on a heading and speed, for either role
+  void decideLead();
+  void decideFollow(const ConvoySimAgent& contact, double curr_time);
+
+  // Lead points of the PD model, in and out
+  void receivePoints(const std::vector<ConvoySimPoint>&);
+  std::vector<ConvoySimPoint> takeSentPoints();
+
+  // Advance the kinematics by dt seconds
+  void move(double dt);
+
+  std::string getVName() const   {return(m_vname);}
+  std::string getContact() const {return(m_contact);}
+  std::string getModel() const   {return(m_model);}
+  bool   isLeader() const        {return(m_contact == "");}
+
+  double getX() const     {return(m_x);}
+  double getY() const     {return(m_y);}
+  double getHdg() const   {return(m_hdg);}
+  double getSpd() const   {return(m_spd);}
+  double getOdometry() const {return(m_odometry);}
+
+  const ConvoySpdPolicy& getSpdPolicy() const
+  {return(m_follower.getSpdPolicy());}
+
+  void buildRecap(ConvoyRecap&, double curr_time);
+  void buildStatRecap(ConvoyStatRecap&) const;
+
+  unsigned int getDroppedMarkers() const
+  {return(m_follower.getDroppedMarkers());}
+
+ protected:
+  void   decideFollowPD(const ConvoySimAgent& contact);
+
+ protected: // Configuration variables (vehicle)
+  double m_max_spd;
+  double m_max_turn_rate;
+  double m_max_accel;
+  double m_max_decel;
+
+ protected: // Configuration variables (lead vehicle)
+  std::vector<double> m_lead_ptx;
+  std::vector<double> m_lead_pty;
+  double m_lead_spd;
+  double m_lead_capture_radius;
+
+ protected: // State variables (vehicle)
+  std::string m_vname;
+  std::string m_contact;
+
+  double m_x;
+  double m_y;
+  double m_hdg;
+  double m_spd;
+  double m_odometry;
+
+  double m_des_hdg;
+  double m_des_spd;
+
+  unsigned int m_lead_ix;
+
+ protected: // Convoy behavior (lib_convoyz)
+  std::string    m_model;
+  ConvoyFollower m_follower;
+  ConvoyPDPolicy m_pd_policy;
+
+  std::list<ConvoySimPoint>   m_pd_queue;
+  std::vector<ConvoySimPoint> m_pd_sent;
+
+  unsigned int m_recap_index;
+};
+
+#endif
@@ -0,0 +1,114 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoySim_Info.cpp                                   */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cstdlib> 
+#include <iostream>
+#include "ColorParse.h"
+#include "ReleaseInfo.h"
+#include "ConvoySim_Info.h"
+
+using namespace std;
+
+//----------------------------------------------------------------
+// Procedure: showSynopsis
+
+void showSynopsis()
+{
+  blk("SYNOPSIS:                                                       ");
+  blk("------------------------------------                            ");
+  blk("  convoysim is a headless, in-process convoy simulator. A lead  ");
+  blk("  vehicle cycles a set of waypoints and N-1 followers each run  ");
+  blk("  the follower logic of a convoy behavior on simple rate-limited");
+  blk("  kinematics. The logic is the same lib_convoyz code the        ");
+  blk("  behaviors call: ConvoyFollower for BHV_ConvoyV21X (passive    ");
+  blk("  marker tail), or ConvoyPDPolicy for BHV_ConvoyPD (lead points ");
+  blk("  and PD speed law). There is no MOOSDB, helm or time warp. Each");
+  blk("  follower's recaps are fed straight into an EvalConvoyEngine   ");
+  blk("  and the convoy metrics are reported at the end, for fast      ");
+  blk("  parameter studies.                                            ");
+}
+
+//----------------------------------------------------------------
+// Procedure: showHelpAndExit
+
+void showHelpAndExit()
+{
+  cout << "=====================================================" << endl;
+  cout << "Usage: convoysim [OPTIONS]                           " << endl;
+  cout << "=====================================================" << endl;
+  cout << "                                                     " << endl;
+  showSynopsis();
+  cout << "                                                     " << endl;
+  cout << "Options:                                             " << endl;
+  cout << "  --help, -h                                         " << endl;
+  cout << "     Display this help message.                      " << endl;
+  cout << "  --version,-v                                       " << endl;
+  cout << "     Display the release version of convoysim.       " << endl;
+  cout << "  --verbose                                          " << endl;
+  cout << "     Produce more verbose output (csv header line).  " << endl;
+  cout << "  --vehicles=<num>                                   " << endl;
+  cout << "     Number of vehicles including the leader.        " << endl;
+  cout << "     The default is 4.                               " << endl;
+  cout << "  --duration=<secs>                                  " << endl;
+  cout << "     Simulated mission time. The default is 3600.    " << endl;
+  cout << "  --dt=<secs>                                        " << endl;
+  cout << "     Simulation time step, and the rate at which the " << endl;
+  cout << "     convoy logic and metrics are updated. Default   " << endl;
+  cout << "     is 0.25, matching a helm AppTick of 4.          " << endl;
+  cout << "  --spacing=<meters>                                 " << endl;
+  cout << "     Initial spacing between vehicles. Default is 10." << endl;
+  cout << "  --lead_spd=<m/s>                                   " << endl;
+  cout << "     Speed of the lead vehicle. Default is 1.5.      " << endl;
+  cout << "  --lead_path=<pts>                                  " << endl;
+  cout << "     Points cycled by the lead vehicle, e.g.,        " << endl;
+  cout << "     \"0,0:120,0:120,-60:0,-60\" (the default).        " << endl;
+  cout << "  --model=<v21x,pd>                                  " << endl;
+  cout << "     Follower logic, BHV_ConvoyV21X (the default) or " << endl;
+  cout << "     BHV_ConvoyPD. Both are scored with the same     " << endl;
+  cout << "     marker tail metrics and ideal_convoy_range.     " << endl;
+  cout << "  --param=<param>=<value>                            " << endl;
+  cout << "     Vehicle or convoy behavior parameter, applied to" << endl;
+  cout << "     all vehicles. Behavior params use the same names" << endl;
+  cout << "     as in the .bhv file, e.g., ideal_convoy_range,  " << endl;
+  cout << "     compression, inter_mark_range, capture_radius,  " << endl;
+  cout << "     or for pd, ideal_follow_range, kp_spd, kd_spd.  " << endl;
+  cout << "     Vehicle params: max_spd, turn_rate, accel, decel" << endl;
+  cout << "     May be given multiple times.                    " << endl;
+  cout << "  --eval=<param>=<value>                             " << endl;
+  cout << "     EvalConvoyEngine parameter, e.g.,               " << endl;
+  cout << "     tracking_thresh=1.2. May be given multiple times" << endl;
+  cout << "  --format=<table,csv,report>                        " << endl;
+  cout << "     Output format. Default is table. The csv format " << endl;
+  cout << "     is one line per follower, for batch studies.    " << endl;
+  cout << "  --label=<str>                                      " << endl;
+  cout << "     Label for the first column of csv output.       " << endl;
+  cout << "                                                     " << endl;
+  cout << "Examples:                                            " << endl;
+  cout << "  convoysim --vehicles=6 --duration=7200             " << endl;
+  cout << "  convoysim --param=compression=0.5 --format=report  " << endl;
+  cout << "  convoysim --model=pd --param=kp_spd=0.2            " << endl;
+  cout << "  for r in 6 8 10 12; do                             " << endl;
+  cout << "    convoysim --param=ideal_convoy_range=$r          " << endl;
+  cout << "              --format=csv --label=ideal_$r >> out.csv" << endl;
+  cout << "  done                                               " << endl;
+  cout << "                                                     " << endl;
+  
+  exit(0);
+}
+
+//----------------------------------------------------------------
+// Procedure: showReleaseInfoAndExit
+
+void showReleaseInfoAndExit()
+{
+  showReleaseInfo("convoysim", "gpl");
+  exit(0);
+}
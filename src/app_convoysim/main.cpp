@@ -0,0 +1,75 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: main.cpp                                             */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <iostream>
+#include "MBUtils.h"
+#include "ConvoySim.h"
+#include "ConvoySim_Info.h"
+
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+  ConvoySim convoysim;
+
+  bool    verbose = false;
+  string  arg_summary = argv[0];
+
+  for(int i=1; i<argc; i++) {
+    bool   handled = false;
+    
+    string argi = argv[i];
+    arg_summary += " " + argi;
+
+    if((argi=="-v") || (argi=="--version") || (argi=="-version"))
+      showReleaseInfoAndExit();
+    else if((argi=="-h") || (argi == "--help") || (argi=="-help"))
+      showHelpAndExit();
+    else if(argi=="--verbose") {
+      verbose=true;
+      handled = true;
+    }
+    else if(strBegins(argi, "--vehicles="))
+      handled = convoysim.setVehicles(argi.substr(11));
+    else if(strBegins(argi, "--duration="))
+      handled = convoysim.setDuration(argi.substr(11));
+    else if(strBegins(argi, "--dt="))
+      handled = convoysim.setTimeStep(argi.substr(5));
+    else if(strBegins(argi, "--spacing="))
+      handled = convoysim.setSpacing(argi.substr(10));
+    else if(strBegins(argi, "--lead_spd="))
+      handled = convoysim.setLeadSpeed(argi.substr(11));
+    else if(strBegins(argi, "--lead_path="))
+      handled = convoysim.setLeadPath(argi.substr(12));
+    else if(strBegins(argi, "--model="))
+      handled = convoysim.setModel(argi.substr(8));
+    else if(strBegins(argi, "--param="))
+      handled = convoysim.addAgentParam(argi.substr(8));
+    else if(strBegins(argi, "--eval="))
+      handled = convoysim.addEvalParam(argi.substr(7));
+    else if(strBegins(argi, "--format="))
+      handled = convoysim.setFormat(argi.substr(9));
+    else if(strBegins(argi, "--label="))
+      handled = convoysim.setLabel(argi.substr(8));
+
+    if(!handled) {
+      cout << "Unhandled arg: " << argi << endl;
+      return(1);
+    }
+  }
+
+  convoysim.setArgSummary(arg_summary);
+  convoysim.setVerbose(verbose);
+  if(!convoysim.run())
+    return(1);
+
+  return(0);
+}
@@ -63,18 +63,41 @@ void showHelpAndExit()
   cout << "     Display the release version of pickpos.         " << endl;
   cout << "  --verbose                                          " << endl;
   cout << "     Produce more verbose output                     " << endl;
+  cout << "  --seed=<num>                                       " << endl;
+  cout << "     Seed for the random choices. The same seed and  " << endl;
+  cout << "     arguments give the same output. If not given, a " << endl;
+  cout << "     seed is made and shown with --hdrs or --verbose." << endl;
+  cout << "  --batch=<num>                                      " << endl;
+  cout << "     Make this many independent scenarios in one run." << endl;
+  cout << "     Each has its own seed drawn from --seed, shown  " << endl;
+  cout << "     in a \"# scenario=N, seed=S\" line before it.    " << endl;
+  cout << "  --batch_file=<filename>                            " << endl;
+  cout << "     Write all batch scenarios to this file rather   " << endl;
+  cout << "     than to the terminal.                           " << endl;
+  cout << "  --batch_dir=<dir>                                  " << endl;
+  cout << "     Write each batch scenario to its own file, e.g.," << endl;
+  cout << "     dir/scenario_0001.txt.                          " << endl;
+  cout << "  --threads=<num>                                    " << endl;
+  cout << "     Threads used in batch mode (default=per core).  " << endl;
   cout << "  --amt=<num>                                        " << endl;
   cout << "     Specify number of points to make (default=10)   " << endl;
   cout << "  --buffer=<num>                                     " << endl;
-  cout << "     Distance between random points if selecting from" << endl;
-  cout << "     a polygon(s). May not always be able to respect " << endl;
-  cout << "     this distance depending on size of poly and pts." << endl;
+  cout << "     Min distance between random points if selecting" << endl;
+  cout << "     from a polygon(s). Points are spread evenly over" << endl;
+  cout << "     the region and never closer than this distance. " << endl;
+  cout << "     Exits with an error if the region is too small. " << endl;
   cout << "     The default value is 10.                        " << endl;
   cout << "  --maxtries=<num>                                   " << endl;
-  cout << "     The number of times the random number generator " << endl;
-  cout << "     will retry to make a new random point if the one" << endl;
-  cout << "     chosen is less than the buffer dist to any pts. " << endl;
+  cout << "     The number of times a set of positions will be  " << endl;
+  cout << "     redrawn if any two are closer than --min_sep.   " << endl;
   cout << "     The default value is 1000.                      " << endl;
+  cout << "  --min_sep=<num>                                    " << endl;
+  cout << "     Min distance between any two picked positions,  " << endl;
+  cout << "     for any pick mode. Sets that violate it are     " << endl;
+  cout << "     redrawn, and it is an error if none is found.   " << endl;
+  cout << "  --sep_hist=<num>                                   " << endl;
+  cout << "     Append a histogram, as # comment lines, of the  " << endl;
+  cout << "     nearest neighbor distances with this bin width. " << endl;
   cout << "  --posfile=<filename>                               " << endl;
   cout << "     Name of file from which to make random subset of" << endl;
   cout << "     points. File must contain more lines than points" << endl;
@@ -151,6 +174,7 @@ void showHelpAndExit()
   cout << "  pickpos --amt=5 --polygon=\"60,-40:60,-160:150,-160:180,-100\" --hdg=-45:45" << endl;
   cout << "  pickpos --amt=5 --polygon=\"60,-40:60,-160:150,-160:180,-100\" --hdg=-10,10,-45 --spd=1:5" << endl;
   cout << "  pickpos --amt=5 --polygon=\"60,-40:60,-160:150,-160:180,-100\" --buffer=10 --maxtries=200 " << endl;
+  cout << "  pickpos --amt=5 --polygon=\"60,-40:60,-160:150,-160:180,-100\" --batch=1000 --batch_dir=runs" << endl;
   cout << "                                                     " << endl;
   cout << "Notes:                                               " << endl;
   cout << "  (1) The --spd switch can be used for generating a  " << endl;
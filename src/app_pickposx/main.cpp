@@ -61,6 +61,16 @@ int main(int argc, char *argv[])
       handled = pickpos.setMultiLine();
     else if((argi == "--reverse_names") || (argi=="-r"))
       handled = pickpos.setReverseNames();
+    else if(strBegins(argi, "--seed="))
+      handled = pickpos.setSeed(argi.substr(7));
+    else if(strBegins(argi, "--batch="))
+      handled = pickpos.setBatchAmt(argi.substr(8));
+    else if(strBegins(argi, "--batch_file="))
+      handled = pickpos.setBatchFile(argi.substr(13));
+    else if(strBegins(argi, "--batch_dir="))
+      handled = pickpos.setBatchDir(argi.substr(12));
+    else if(strBegins(argi, "--threads="))
+      handled = pickpos.setThreads(argi.substr(10));
     else if(strBegins(argi, "--amt="))
       handled = pickpos.setPickAmt(argi.substr(6));
     else if(strBegins(argi, "--vix="))
@@ -75,6 +85,10 @@ int main(int argc, char *argv[])
       handled = pickpos.addPolygon(argi.substr(7));
     else if(strBegins(argi, "--buffer="))
       handled = pickpos.setBufferDist(argi.substr(9));
+    else if(strBegins(argi, "--min_sep="))
+      handled = pickpos.setMinSep(argi.substr(10));
+    else if(strBegins(argi, "--sep_hist="))
+      handled = pickpos.setSepHist(argi.substr(11));
     else if(strBegins(argi, "--maxtries="))
       handled = pickpos.setMaxTries(argi.substr(11));
     else if(strBegins(argi, "--hdg="))
@@ -125,7 +139,13 @@ int main(int argc, char *argv[])
 
   pickpos.setArgSummary(arg_summary);
   pickpos.setVerbose(verbose);
-  pickpos.pick();
+  int result = pickpos.pick();
+  if(result != PICK_OK) {
+    cout << pickpos.getError() << endl;
+    if(result == PICK_ERR_REGION_FULL)
+      return(2);
+    return(1);
+  }
 
   return(0);
 }
@@ -0,0 +1,284 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: TourBench.cpp                                        */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include "TourBench.h"
+#include "TourPlanner.h"
+#include "PointRegistry.h"
+#include "MBUtils.h"
+#include "ACTable.h"
+
+using namespace std;
+
+//---------------------------------------------------------
+// Constructor()
+
+TourBench::TourBench()
+{
+  // Config vars
+  m_seed      = 1;
+  m_kicks     = -1;
+  m_neighbors = 8;
+  m_min_gain  = 0;
+  setSizes("1000,10000,50000");
+}
+
+//---------------------------------------------------------
+// Procedure: setSizes()
+//   Example: "1000,10000"
+
+bool TourBench::setSizes(string str)
+{
+  vector<string> svector = parseString(str, ',');
+  if(svector.empty())
+    return(false);
+
+  m_sizes.clear();
+  for(unsigned int i=0; i<svector.size(); i++) {
+    string size = stripBlankEnds(svector[i]);
+    int ival = atoi(size.c_str());
+    if(!isNumber(size) || (ival <= 0))
+      return(false);
+    m_sizes.push_back((unsigned int)(ival));
+  }
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setSeed()
+
+bool TourBench::setSeed(string str)
+{
+  if(!isNumber(str) || (str.find_first_not_of("0123456789") != string::npos))
+    return(false);
+  m_seed = strtoull(str.c_str(), 0, 10);
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setKicks()
+//      Note: -1 leaves the planner default of one per point
+
+bool TourBench::setKicks(string str)
+{
+  int ival = atoi(str.c_str());
+  if(!isNumber(str) || (ival < -1))
+    return(false);
+  m_kicks = ival;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setNeighbors()
+
+bool TourBench::setNeighbors(string str)
+{
+  int ival = atoi(str.c_str());
+  if(!isNumber(str) || (ival < 2))
+    return(false);
+  m_neighbors = (unsigned int)(ival);
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setMinGain()
+//      Note: Percent the improved tour must be shorter than the
+//            greedy tour, for every size, or run() fails
+
+bool TourBench::setMinGain(string str)
+{
+  if(!isNumber(str))
+    return(false);
+  m_min_gain = atof(str.c_str());
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: run()
+//   Returns: true if every tour was valid and met the min gain
+
+bool TourBench::run()
+{
+  m_rng.seed(m_seed);
+  for(unsigned int i=0; i<m_sizes.size(); i++)
+    runSize(m_sizes[i]);
+
+  cout << "Seed=" << m_seed << ", neighbors=" << m_neighbors;
+  cout << ", kicks=" << intToString(m_kicks) << endl << endl;
+
+  unsigned int fails = 0;
+  ACTable actab(7);
+  actab << "Points | Greedy | Improved | Gain% | Build ms | Improve ms | Moves";
+  actab.addHeaderLines();
+  for(unsigned int i=0; i<m_points.size(); i++) {
+    double gain = 0;
+    if(m_greedy_lens[i] > 0)
+      gain = 100 * (1 - (m_final_lens[i] / m_greedy_lens[i]));
+    if(!m_valid[i] || (gain < m_min_gain))
+      fails++;
+
+    actab << uintToString(m_points[i]);
+    actab << doubleToStringX(m_greedy_lens[i], 1);
+    if(m_valid[i])
+      actab << doubleToStringX(m_final_lens[i], 1);
+    else
+      actab << "invalid";
+    actab << doubleToString(gain, 1);
+    actab << doubleToString(m_build_secs[i] * 1000, 1);
+    actab << doubleToString(m_improve_secs[i] * 1000, 1);
+    actab << uintToString(m_moves[i]);
+  }
+  cout << actab.getFormattedString() << endl;
+
+  if(!checkIDs()) {
+    cout << "FAILED: point ids did not round trip" << endl;
+    return(false);
+  }
+  cout << "Point ids round trip: ok" << endl;
+
+  if(fails > 0) {
+    cout << "FAILED: " << fails << " tours were invalid or gained less ";
+    cout << "than " << doubleToStringX(m_min_gain, 1) << "%" << endl;
+    return(false);
+  }
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: runSize()
+//      Note: Points are uniform over a square sized for about one
+//            point per 100 square meters, starting from a corner.
+//            The tour length is checked from the returned order
+//            rather than taken from the planner.
+
+void TourBench::runSize(unsigned int points)
+{
+  double side = 10 * sqrt((double)(points));
+  uniform_real_distribution<double> coord(0, side);
+
+  vector<double> xs(points);
+  vector<double> ys(points);
+  for(unsigned int i=0; i<points; i++) {
+    xs[i] = coord(m_rng);
+    ys[i] = coord(m_rng);
+  }
+
+  TourPlanner planner;
+  planner.setNeighbors(m_neighbors);
+  planner.setKicks(m_kicks);
+  planner.setStart(0, 0);
+  planner.addPoints(xs, ys);
+
+  chrono::steady_clock::time_point t0 = chrono::steady_clock::now();
+  planner.buildTour();
+  chrono::steady_clock::time_point t1 = chrono::steady_clock::now();
+  while(!planner.improve(1.0));
+  chrono::steady_clock::time_point t2 = chrono::steady_clock::now();
+
+  vector<unsigned int> tour = planner.getTour();
+  bool valid = isPermutation(tour, points);
+
+  double total = 0;
+  double px = 0;
+  double py = 0;
+  for(unsigned int i=0; valid && (i<tour.size()); i++) {
+    total += hypot(xs[tour[i]] - px, ys[tour[i]] - py);
+    px = xs[tour[i]];
+    py = ys[tour[i]];
+  }
+
+  m_points.push_back(points);
+  m_greedy_lens.push_back(planner.getGreedyLength());
+  m_final_lens.push_back(total);
+  m_build_secs.push_back(chrono::duration<double>(t1 - t0).count());
+  m_improve_secs.push_back(chrono::duration<double>(t2 - t1).count());
+  m_moves.push_back(planner.getMoves());
+  m_valid.push_back(valid);
+}
+
+//---------------------------------------------------------
+// Procedure: checkIDs()
+//      Note: Follows the path of a point id from pPointAssign to
+//            pGenPath and back. Points are loaded from labeled specs
+//            as pGenPath takes them, captures are matched from bare
+//            HITPTS positions, and the id reported for each must be
+//            the one pPointAssign gives the label. One point is then
+//            missed and put back, as pGenPath does.
+//   Returns: true if every visit reported the id of its label
+
+bool TourBench::checkIDs()
+{
+  vector<string> labels = {"3", "41", "alpha", "beta_2", "1x", "pt 9"};
+
+  PointRegistry points;
+  for(unsigned int i=0; i<labels.size(); i++) {
+    string spec = "x=" + intToString(10 * i);
+    spec += ",y=" + intToString(5 * (i % 2));
+    spec += ",label=" + labels[i];
+    double x, y;
+    uint64_t id;
+    if(!PointRegistry::parsePoint(spec, "label", x, y, id))
+      return(false);
+    if(points.add(id, x, y) < 0)
+      return(false);
+  }
+
+  TourPlanner planner;
+  planner.setStart(0, 0);
+  planner.addPoints(points.getXs(), points.getYs());
+  planner.buildTour();
+
+  // Visit in tour order, then miss the first one and visit it again
+  vector<unsigned int> visits = planner.getTour();
+  visits.push_back(visits[0]);
+
+  for(unsigned int i=0; i<visits.size(); i++) {
+    if((i+1) == visits.size()) {
+      points.repeat(visits[i]);
+      planner.insertPoint(points.getX(visits[i]), points.getY(visits[i]));
+    }
+
+    string label  = labels[visits[i]];
+    string hitpts = "x=" + intToString(10 * visits[i]);
+    hitpts += ",y=" + intToString(5 * (visits[i] % 2));
+
+    double x, y;
+    uint64_t id;
+    if(!PointRegistry::parsePoint(hitpts, "label", x, y, id))
+      return(false);
+    int index = planner.findPoint(x, y);
+    if((index < 0) || !planner.visitPoint(index))
+      return(false);
+    if(points.getID(index) != PointRegistry::labelID(label))
+      return(false);
+  }
+  return(planner.getRemaining().empty());
+}
+
+//---------------------------------------------------------
+// Procedure: isPermutation()
+
+bool TourBench::isPermutation(const vector<unsigned int>& tour,
+			      unsigned int points) const
+{
+  if(tour.size() != points)
+    return(false);
+
+  vector<bool> seen(points, false);
+  for(unsigned int i=0; i<tour.size(); i++) {
+    if((tour[i] >= points) || seen[tour[i]])
+      return(false);
+    seen[tour[i]] = true;
+  }
+  return(true);
+}
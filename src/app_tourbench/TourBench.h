@@ -0,0 +1,59 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: TourBench.h                                          */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef TOUR_BENCH_HEADER
+#define TOUR_BENCH_HEADER
+
+#include <string>
+#include <vector>
+#include <random>
+
+class TourBench
+{
+ public:
+  TourBench();
+  virtual ~TourBench() {}
+
+  bool setSizes(std::string);
+  bool setSeed(std::string);
+  bool setKicks(std::string);
+  bool setNeighbors(std::string);
+  bool setMinGain(std::string);
+
+ public:
+  bool run();
+
+ protected:
+  void runSize(unsigned int points);
+  bool checkIDs();
+  bool isPermutation(const std::vector<unsigned int>& tour,
+		     unsigned int points) const;
+
+ protected: // Config variables
+  std::vector<unsigned int> m_sizes;
+  unsigned long long        m_seed;
+  int                       m_kicks;
+  unsigned int              m_neighbors;
+  double                    m_min_gain;
+
+ protected: // State variables
+  std::mt19937_64 m_rng;
+
+  std::vector<unsigned int> m_points;
+  std::vector<double>       m_greedy_lens;
+  std::vector<double>       m_final_lens;
+  std::vector<double>       m_build_secs;
+  std::vector<double>       m_improve_secs;
+  std::vector<unsigned int> m_moves;
+  std::vector<bool>         m_valid;
+};
+
+#endif
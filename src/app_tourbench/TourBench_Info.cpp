@@ -0,0 +1,83 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: TourBench_Info.cpp                                   */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cstdlib> 
+#include <iostream>
+#include "ColorParse.h"
+#include "ReleaseInfo.h"
+#include "TourBench_Info.h"
+
+using namespace std;
+
+//----------------------------------------------------------------
+// Procedure: showSynopsis
+
+void showSynopsis()
+{
+  blk("SYNOPSIS:                                                       ");
+  blk("------------------------------------                            ");
+  blk("  tourbench plans open tours through uniform random points      ");
+  blk("  with a TourPlanner, the greedy tour first and then improve()  ");
+  blk("  run to completion, and reports how much shorter the improved  ");
+  blk("  tour is than the greedy one and how long each step took.      ");
+  blk("  Exits with 1 if a tour is not a visit order of all points, or ");
+  blk("  gains less than the --min_gain percent.                       ");
+  blk("                                                                ");
+  blk("  It also checks that the point ids pGenPath reports on a visit ");
+  blk("  match the ids pPointAssign gives the same point labels.       ");
+}
+
+//----------------------------------------------------------------
+// Procedure: showHelpAndExit
+
+void showHelpAndExit()
+{
+  cout << "=====================================================" << endl;
+  cout << "Usage: tourbench [OPTIONS]                           " << endl;
+  cout << "=====================================================" << endl;
+  cout << "                                                     " << endl;
+  showSynopsis();
+  cout << "                                                     " << endl;
+  cout << "Options:                                             " << endl;
+  cout << "  --help, -h                                         " << endl;
+  cout << "     Display this help message.                      " << endl;
+  cout << "  --version,-v                                       " << endl;
+  cout << "     Display the release version of tourbench.       " << endl;
+  cout << "  --sizes=<num,num,...>                              " << endl;
+  cout << "     Numbers of points to plan tours through. The    " << endl;
+  cout << "     default is 1000,10000,50000.                    " << endl;
+  cout << "  --seed=<num>                                       " << endl;
+  cout << "     Seed for the random points. The default is 1.   " << endl;
+  cout << "  --kicks=<num>                                      " << endl;
+  cout << "     Kicks tried once at a local optimum. The default" << endl;
+  cout << "     -1 is one per point, 0 is local search only.    " << endl;
+  cout << "  --neighbors=<num>                                  " << endl;
+  cout << "     Near neighbors per point for candidate moves.   " << endl;
+  cout << "     The default is 8.                               " << endl;
+  cout << "  --min_gain=<pct>                                   " << endl;
+  cout << "     Fail if a tour is not this much shorter than    " << endl;
+  cout << "     the greedy tour. The default is 0.              " << endl;
+  cout << "                                                     " << endl;
+  cout << "Examples:                                            " << endl;
+  cout << "  $ tourbench                                        " << endl;
+  cout << "  $ tourbench --sizes=10000 --min_gain=15            " << endl;
+  cout << "                                                     " << endl;
+  exit(0);
+}
+
+//----------------------------------------------------------------
+// Procedure: showReleaseInfoAndExit
+
+void showReleaseInfoAndExit()
+{
+  showReleaseInfo("tourbench", "gpl");
+  exit(0);
+}
@@ -0,0 +1,19 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: TourBench_Info.h                                     */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+ 
+#ifndef TOUR_BENCH_INFO_HEADER
+#define TOUR_BENCH_INFO_HEADER
+
+void showSynopsis();
+void showHelpAndExit();
+void showReleaseInfoAndExit();
+
+#endif
@@ -0,0 +1,53 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: main.cpp                                             */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <iostream>
+#include "MBUtils.h"
+#include "TourBench.h"
+#include "TourBench_Info.h"
+
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+  TourBench tourbench;
+
+  for(int i=1; i<argc; i++) {
+    bool   handled = false;
+    
+    string argi = argv[i];
+
+    if((argi=="-v") || (argi=="--version") || (argi=="-version"))
+      showReleaseInfoAndExit();
+    else if((argi=="-h") || (argi == "--help") || (argi=="-help"))
+      showHelpAndExit();
+    else if(strBegins(argi, "--sizes="))
+      handled = tourbench.setSizes(argi.substr(8));
+    else if(strBegins(argi, "--seed="))
+      handled = tourbench.setSeed(argi.substr(7));
+    else if(strBegins(argi, "--kicks="))
+      handled = tourbench.setKicks(argi.substr(8));
+    else if(strBegins(argi, "--neighbors="))
+      handled = tourbench.setNeighbors(argi.substr(12));
+    else if(strBegins(argi, "--min_gain="))
+      handled = tourbench.setMinGain(argi.substr(11));
+
+    if(!handled) {
+      cout << "Unhandled arg: " << argi << endl;
+      return(1);
+    }
+  }
+
+  if(!tourbench.run())
+    return(1);
+
+  return(0);
+}
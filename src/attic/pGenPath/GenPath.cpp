@@ -6,6 +6,7 @@
 /************************************************************/
 
 #include <iterator>
+#include <cstdlib>
 #include "MBUtils.h"
 #include "ACTable.h"
 #include "GenPath.h"
@@ -62,56 +63,55 @@ bool GenPath::OnNewMail(MOOSMSG_LIST &NewMail)
     if (key == "VISIT_POINT")
     {
       m_ticks_since_update = 0;
-      string sval = msg.GetString();
-      vector<string> contents = parseString(sval, ',');
-      double x, y;
-      string unique_id;
-      for (auto idx = contents.begin(); idx != contents.end(); idx++)
+      add_visit_point(msg.GetString());
+    }
+    //A batch of points from pPointAssign, "seq=N#x=..,y=..,label=..#...", which we acknowledge so it is not sent again
+    else if (key == "VISIT_POINTS")
+    {
+      m_ticks_since_update = 0;
+      vector<string> batch = parseString(msg.GetString(), '#');
+      if (batch.size() > 0)
       {
-        string param = biteStringX(*idx, '=');
-        string value = *idx;
-        if (tolower(param) == "x")
-        {
-          x = stod(value);
-        }
-        else if (tolower(param) == "y")
+        string seq = tokStringParse(batch[0], "seq", ',', '=');
+        for (size_t i = 1; i < batch.size(); i++)
         {
-          y = stod(value);
+          add_visit_point(batch[i]);
         }
-        else if (tolower(param) == "label")
+        if (isNumber(seq))
         {
-          unique_id = value;
+          Notify("VISIT_POINTS_ACK", atof(seq.c_str()));
         }
       }
-      if (m_ids.count(unique_id) == 0)
-      {
-        m_points.push_back(XYPoint(x, y, unique_id));
-        m_ids.insert(unique_id);
-      }
+    }
+    //pPointAssign handed these points to another vehicle, so they are passed over here
+    else if (key == "VISIT_POINTS_DROP")
+    {
+      drop_points(msg.GetString());
     }
     //If the waypoint behavior claims to have captured a waypoint (by either direct capture or slip condition), we save this latest capture point
     else if (key == "HITPTS")
     {
-      string sval = msg.GetString();
-      vector<string> contents = parseString(sval, ',');
+      //HITPTS carries no label, so the point is matched by position and its id taken from m_points
       double x, y;
-      string unique_id;
-      for (auto idx = contents.begin(); idx != contents.end(); idx++)
+      uint64_t unique_id;
+      if (!PointRegistry::parsePoint(msg.GetString(), "label", x, y, unique_id))
       {
-        string param = biteStringX(*idx, '=');
-        string value = *idx;
-        if (tolower(param) == "x")
-        {
-          x = stod(value);
-        }
-        else if (tolower(param) == "y")
-        {
-          y = stod(value);
-        }
+        continue;
       }
       //Here we also reset our condition for if it is a successful capture by the genpath criteria, to evaluate later in the iterate loop
       m_latest_captured_point = XYPoint(x, y, "CAPTURED");
       m_successful_capture = false;
+
+      //Mark the point, and any the behavior passed over before it, as visited in the live tour
+      m_latest_captured_index = -1;
+      if (m_state == m_monitor_mode)
+      {
+        m_latest_captured_index = m_planner.findPoint(x, y);
+        if (m_latest_captured_index >= 0)
+        {
+          m_planner.visitPoint(m_latest_captured_index);
+        }
+      }
     }
     else if (key == "DELIVERED")
     {
@@ -123,6 +123,16 @@ bool GenPath::OnNewMail(MOOSMSG_LIST &NewMail)
       }
     }
 
+    //The waypoint behavior missed an edit to its list, so send it the whole list next
+    else if (key == "WPT_EDITS_RESYNC")
+    {
+      m_edits.forceFull();
+      if (m_state == m_monitor_mode)
+      {
+        post_remaining();
+      }
+    }
+
     //If the waypoint behavior says that it completes a tour of the first round of points, we update our state manager
     else if (key == "TOUR_COMPLETE")
     {
@@ -209,65 +219,161 @@ void GenPath::post_beam(bool captured, XYPoint target)
 }
 
 /**
- * @brief Sorts the points for the traveling salesman problem - returns a list of consecutively 
- * greedy close points to one another using the euclidean distance, i.e. if init is 7 and points are 9 10 4 2, it'll return
- * 7 9 10 4 2
+ * @brief Loads the points into the tour planner and builds a greedy nearest-neighbor
+ * tour from the initial point, using a grid index rather than rescanning every point
  * 
  * @param init_point 
- * @return std::vector<XYPoint> Collection of XYPoints
  */
 
-std::vector<XYPoint> GenPath::sort_points(XYPoint init_point)
+void GenPath::plan_points(XYPoint init_point)
 {
-  // Could be more efficient, but no problem on my machine! 
+  m_planner.clear();
+  m_planner.setStart(init_point.x(), init_point.y());
+  m_planner.addPoints(m_points.getXs(), m_points.getYs());
+  m_planner.buildTour();
+}
+
+/**
+ * @brief Posts the points of the live tour not yet visited as the new waypoint list.
+ * The waypoint behavior restarts from the first point given, so this is the whole
+ * suffix of the tour from the vehicle onwards. With wpt_edits, only the changes since
+ * the last post go out on WPT_EDITS, for BHV_TourWaypoint, keyed by registry index
+ */
 
-  // Instantiate a sequence to be returned
-  std::vector<XYPoint> seq;
-  uint16_t min_idx = -1;
-  double min_dist = 999999999.0;
+void GenPath::post_remaining()
+{
+  std::vector<unsigned int> remaining = m_planner.getRemaining();
+  if (remaining.size() == 0)
+  {
+    return;
+  }
 
-  // Find the first closest point in the set of points w/rt the initial point
-  for (uint16_t i = 0; i < m_points.size(); i++)
+  if (m_wpt_edits)
   {
-    double dist = rel_dist(init_point, m_points[i]);
-    if (dist < min_dist)
+    std::string edits = m_edits.encode(remaining, m_points.getXs(), m_points.getYs());
+    if (edits != "")
     {
-      min_dist = dist;
-      min_idx = i;
+      Notify("WPT_EDITS", edits);
     }
+    return;
   }
 
-  // Add these two points to the sequence
-  seq.push_back(XYPoint(m_points[min_idx]));
+  XYSegList seglist;
+  for (size_t i = 0; i < remaining.size(); i++)
+  {
+    seglist.add_vertex(m_points.getX(remaining[i]), m_points.getY(remaining[i]));
+  }
 
-  // Delete this from the set of points
-  m_points.erase(m_points.begin() + min_idx);
+  std::string color;
+  if (m_vname.compare("HENRY"))
+  {
+    color = "yellow";
+  }
+  else
+  {
+    color = "blue";
+  }
+  seglist.set_edge_color(color);
+  std::string update_str = "points = " + seglist.get_spec();
 
-  // Iterate through and consume the vector while creating a copy
-  while (m_points.size() > 0)
+  Notify("UPDATES_WPTS", update_str);
+}
+
+/**
+ * @brief Puts a missed point back into the live tour at its cheapest place among the
+ * points not yet visited, and re-posts the waypoints from there on
+ * 
+ * @param index Index of the missed point in the tour
+ */
+
+void GenPath::revisit_point(unsigned int index)
+{
+  m_points.repeat(index);
+  m_planner.insertPoint(m_points.getX(index), m_points.getY(index));
+  post_remaining();
+}
+
+/**
+ * @brief Adds a visit point to the registry, unless one with the same label has been
+ * seen already, as when a batch is sent again. Once a tour is being followed the point
+ * goes straight into it at its cheapest place, keeping registry and planner indices
+ * the same
+ * 
+ * @param spec The point, "x=..,y=..,label=.."
+ */
+
+void GenPath::add_visit_point(const string &spec)
+{
+  double x, y;
+  uint64_t unique_id;
+  if (!PointRegistry::parsePoint(spec, "label", x, y, unique_id))
   {
-    // for each point, find the next closest point compared to the last minimum index
-    uint16_t min_idx = -1;
-    double min_dist = 999999999.0;
-    for (uint16_t j = 0; j < m_points.size(); j++)
-    {
-      double dist = rel_dist(seq[seq.size() - 1], m_points[j]);
-      // if we found a new minimum, update the minimum index
-      if (dist < min_dist)
-      {
-        min_dist = dist;
-        min_idx = j;
-      }
-    }
+    return;
+  }
+  if (m_dropped.count(unique_id))
+  {
+    return;
+  }
+  if (m_points.add(unique_id, x, y) < 0)
+  {
+    return;
+  }
+  if (m_state == m_monitor_mode)
+  {
+    m_planner.insertPoint(x, y);
+    m_new_point = true;
+  }
+}
 
-    // We found this next minimum
-    seq.push_back(XYPoint(m_points[min_idx]));
+/**
+ * @brief Takes a point out of the live tour, if it is in it and not yet visited
+ * 
+ * @param unique_id Id of the point, as in its label
+ * @return true if the point was taken out
+ */
 
-    // Remove this from the source sequence - this what I would suspect to be inefficient, and we could probably swap indices, but am not
-    m_points.erase(m_points.begin() + min_idx);
+bool GenPath::drop_point(uint64_t unique_id)
+{
+  int index = m_points.find(unique_id);
+  if (index < 0)
+  {
+    return (false);
   }
-  return seq;
-};
+  return (m_planner.dropPoint(index));
+}
+
+/**
+ * @brief Handles VISIT_POINTS_DROP, "id,id,...", the points pPointAssign has moved to
+ * another vehicle. They are remembered so they are not added again from a batch sent
+ * before the drop, and are only taken out of the tour once it is being followed, since
+ * until then they would just be planned in again
+ * 
+ * @param ids Comma separated point ids
+ */
+
+void GenPath::drop_points(const string &ids)
+{
+  bool dropped = false;
+  vector<string> svector = parseString(ids, ',');
+  for (size_t i = 0; i < svector.size(); i++)
+  {
+    string id = stripBlankEnds(svector[i]);
+    if (!isNumber(id))
+    {
+      continue;
+    }
+    uint64_t unique_id = strtoull(id.c_str(), 0, 10);
+    m_dropped.insert(unique_id);
+    if ((m_state == m_monitor_mode) && drop_point(unique_id))
+    {
+      dropped = true;
+    }
+  }
+  if (dropped)
+  {
+    post_remaining();
+  }
+}
 
 bool GenPath::Iterate()
 {
@@ -276,7 +382,7 @@ bool GenPath::Iterate()
       Active - Starts on active, and if sufficient conditions for posting the sorted sequence are met, we post this update, transition to monitor mode
 
       Monitor - while in monitor mode, when the waypoint behavior posts an update claiming it has captured a point by either capture radii or slip radii, we compare the point to 
-        GenPaths visit point conditions, and determine whether or not it should be put back into the revisit queue
+        GenPaths visit point conditions, and determine whether or not it should be put back into the live tour
 
       Idle - If all points have been visited by our criteria, then we simply go to an idle mode
   */
@@ -288,35 +394,31 @@ bool GenPath::Iterate()
   //ACTIVE MODE
   if (m_state == m_active_mode && m_points.size() != 0 && (m_ticks_since_update >= 50) && m_all_points_received && (m_captured_x && m_captured_y))
   {
-    m_missed_points = 0;
-
-    XYSegList m_seglist;
-
-    m_points = sort_points(current_point);
-
-    post_pulse();
-
-    for (auto element : m_points)
+    //Build the greedy tour once, then improve it for at most plan_budget seconds per
+    //iterate, picking up where it left off until no improving move remains
+    if (!m_planner.isBuilt() || (m_planner.size() != m_points.size()))
     {
-      m_seglist.add_vertex(XYPoint(element));
+      plan_points(current_point);
     }
-
-    std::string color;
-    if (m_vname.compare("HENRY"))
+    if (!m_planner.improve(m_plan_budget))
     {
-      color = "yellow";
+      m_ticks_since_update++;
+      AppCastingMOOSApp::PostReport();
+      return (true);
     }
-    else
+
+    m_missed_points = 0;
+
+    //Points moved to another vehicle while this one was planning
+    for (auto unique_id : m_dropped)
     {
-      color = "blue";
+      drop_point(unique_id);
     }
-    m_seglist.set_edge_color(color);
-    std::string update_str = "points = " + m_seglist.get_spec();
 
-    Notify("UPDATES_WPTS", update_str);
+    post_pulse();
+    post_remaining();
 
     m_state = m_monitor_mode;
-    m_points.clear();
   }
   //MONITOR MODE
   else if (m_state == m_monitor_mode && (m_captured_x && m_captured_y))
@@ -330,28 +432,42 @@ bool GenPath::Iterate()
     // If the capture distance is greater than the visit radius, and it is a new point, then push it to the queue
     if (!m_successful_capture && m_latest_capture_distance >= m_visit_radius && rel_dist(m_last_missed_point, m_latest_captured_point) > 1)
     {
-      m_points_to_revisit.push_back(m_latest_captured_point);
       m_last_missed_point = XYPoint(m_latest_captured_point);
 
       post_beam(false, m_latest_captured_point);
 
       m_missed_points++;
+
+      //Rather than waiting for the tour to complete, put the missed point straight back
+      //into the live tour
+      if (m_latest_captured_index >= 0)
+      {
+        revisit_point(m_latest_captured_index);
+      }
     }
     else
     {
       post_beam(true, m_latest_captured_point);
+      //Report each visit once, so pPointAssign knows how far along this vehicle is
+      if (!m_successful_capture && (m_latest_captured_index >= 0))
+      {
+        Notify("VISITED_POINT", "id=" + to_string(m_points.getID(m_latest_captured_index)));
+      }
       m_successful_capture = true;
     }
 
-    //While monitoring, if the waypoint behavior claims that it completes the first queue, but by our criteria some points have been missed, then reconstruct our points queue and transition to active mode
-    if (m_tour_complete && m_points_to_revisit.size() > 0)
+    //Points that arrived since the last post were put into the live tour, so post what remains
+    if (m_new_point)
     {
-      for (auto point_it = m_points_to_revisit.rbegin(); m_points_to_revisit.size() > 0; point_it++)
-      {
-        m_points.push_back(XYPoint(*point_it));
-        m_points_to_revisit.pop_back();
-      }
-      m_state = m_active_mode;
+      post_remaining();
+      m_new_point = false;
+    }
+
+    //While monitoring, if the waypoint behavior claims that it completes its list, but points remain in the live tour (e.g. a point missed at the very end), then post them again
+    if (m_tour_complete && (m_planner.size() > m_planner.getVisited()))
+    {
+      m_edits.forceFull();
+      post_remaining();
       m_tour_complete = false;
     }
     //Otherwise, if tour is complete but we have no points to revisit, we tell the vessel to return
@@ -392,6 +508,7 @@ bool GenPath::OnStartUp()
 
   m_vname = "NONAME";
   m_visit_radius = 10;
+  m_plan_budget = 0.05;
   m_current_x = -10;
   m_current_y = -10;
   m_tour_complete = false;
@@ -413,6 +530,20 @@ bool GenPath::OnStartUp()
       m_visit_radius = stod(value);
       handled = true;
     }
+    else if (param == "plan_budget")
+    {
+      handled = setNonNegDoubleOnString(m_plan_budget, value);
+    }
+    else if (param == "wpt_edits")
+    {
+      handled = setBooleanOnString(m_wpt_edits, value);
+    }
+    else if (param == "wpt_checkpoint")
+    {
+      unsigned int msgs = 0;
+      handled = setUIntOnString(msgs, value);
+      m_edits.setCheckpoint(msgs);
+    }
 
     if (!handled)
       reportUnhandledConfigWarning(orig);
@@ -441,11 +572,14 @@ void GenPath::registerVariables()
 {
   AppCastingMOOSApp::RegisterVariables();
   Register("VISIT_POINT", 0);
+  Register("VISIT_POINTS", 0);
+  Register("VISIT_POINTS_DROP", 0);
   Register("DELIVERED", 0);
   Register("NAV_X", 0);
   Register("NAV_Y", 0);
   Register("HITPTS", 0);
   Register("TOUR_COMPLETE", 0);
+  Register("WPT_EDITS_RESYNC", 0);
 }
 
 //------------------------------------------------------------
@@ -462,9 +596,10 @@ bool GenPath::buildReport()
   actab << m_vname << '\n';
   actab.addHeaderLines();
   actab << "Visit Radius: " + to_string(m_visit_radius) + "\n";
-  actab << "Number of points in queue:" + std::to_string(m_points.size()) + "\n";
+  actab << "Number of points:" + std::to_string(m_points.size()) + "\n";
+  actab << "Tour moves: " + std::to_string(m_planner.getMoves()) + "\n";
   actab << "Nav_X/Y Received: " + std::to_string(m_captured_x & m_captured_y);
-  actab << "Points Visited: N/A\n";
+  actab << "Points Visited: " + std::to_string(m_planner.getVisited()) + "\n";
   actab << "Latest Capture Distance:" + std::to_string(m_latest_capture_distance) + "\n";
   actab << "Missed Points:" + std::to_string(m_missed_points) << '\n';
   m_msgs << actab.getFormattedString();
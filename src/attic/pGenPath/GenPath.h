@@ -11,9 +11,12 @@
 #include "MOOS/libMOOS/Thirdparty/AppCasting/AppCastingMOOSApp.h"
 #include <vector>
 #include <string>
+#include <set>
 #include "XYPoint.h"
 #include "XYSegList.h"
-#include <set>
+#include "TourPlanner.h"
+#include "PointRegistry.h"
+#include "TourEdits.h"
 #include <iostream>
 #include <fstream>
 #include <chrono>
@@ -24,7 +27,12 @@ class GenPath : public AppCastingMOOSApp
  public:
    GenPath();
    ~GenPath();
-   std::vector<XYPoint> sort_points(XYPoint init_point);
+   void plan_points(XYPoint init_point);
+   void post_remaining();
+   void revisit_point(unsigned int index);
+   void add_visit_point(const std::string &spec);
+   bool drop_point(uint64_t unique_id);
+   void drop_points(const std::string &ids);
    void post_pulse();
    void post_beam(bool captured, XYPoint missed);
 
@@ -41,10 +49,16 @@ class GenPath : public AppCastingMOOSApp
    void registerVariables();
 
  private: // Configuration variables
+ double m_plan_budget;
+ bool m_wpt_edits = false;
 
  private: // State variables
- std::vector<XYPoint> m_points;
- std::vector<XYPoint> m_points_to_revisit;
+ PointRegistry m_points;
+ TourPlanner m_planner;
+ bool m_new_point = false;
+ TourEdits m_edits;
+ int m_latest_captured_index = -1;
+ std::set<uint64_t> m_dropped;
  XYPoint m_last_missed_point;
  bool m_tour_complete = false;
  int m_missed_points = 0;
@@ -59,7 +73,6 @@ class GenPath : public AppCastingMOOSApp
  XYPoint m_latest_captured_point;
 
  std::string m_vname;
- std::set<std::string> m_ids;
  uint64_t m_ticks_since_update = 0;
  FILE *fptr;
  char buffer [120];
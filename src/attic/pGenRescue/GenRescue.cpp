@@ -56,50 +56,57 @@ bool GenRescue::OnNewMail(MOOSMSG_LIST &NewMail) {
     // and collect the XYPoint in the points buffer
     if (key == "SWIMMER_ALERT") {
       m_ticks_since_update = 0;
-      string sval = msg.GetString();
-      vector<string> contents = parseString(sval, ',');
       double x, y;
-      string unique_id;
-      for (auto idx = contents.begin(); idx != contents.end(); idx++) {
-        string param = biteStringX(*idx, '=');
-        string value = *idx;
-        if (tolower(param) == "x") {
-          x = stod(value);
-        } else if (tolower(param) == "y") {
-          y = stod(value);
-        } else if (tolower(param) == "id") {
-          unique_id = value;
-        }
+      uint64_t unique_id;
+      if (!PointRegistry::parsePoint(msg.GetString(), "id", x, y,
+                                     unique_id)) {
+        continue;
       }
-      Notify("PARSED_COORD", XYPoint(x, y, unique_id).get_spec());
-      if (m_ids.count(unique_id) == 0) {
+      // Points are kept in the order they arrived, which is also their index
+      // in the planner once the first tour is adopted
+      if (m_points.add(unique_id, x, y) >= 0) {
         m_unique_ids++;
-        m_points.push_back(XYPoint(x, y, unique_id));
-        post_pulse(m_points.back().x(), m_points.back().y());
-        m_ids.insert(unique_id);
+        post_pulse(x, y);
         m_new_point = true;
+        m_replan = true;
+        // Once a tour is being followed, new points go straight into it at
+        // their cheapest place, until the worker has a better plan
+        if (m_state == m_monitor_mode) {
+          m_planner.insertPoint(x, y);
+        }
       }
     }
     // If the waypoint behavior claims to have captured a waypoint (by either
     // direct capture or slip condition), we save this latest capture point
     else if (key == "HITPTS") {
-      string sval = msg.GetString();
-      vector<string> contents = parseString(sval, ',');
       double x, y;
-      string unique_id;
-      for (auto idx = contents.begin(); idx != contents.end(); idx++) {
-        string param = biteStringX(*idx, '=');
-        string value = *idx;
-        if (tolower(param) == "x") {
-          x = stod(value);
-        } else if (tolower(param) == "y") {
-          y = stod(value);
-        }
+      uint64_t unique_id;
+      if (!PointRegistry::parsePoint(msg.GetString(), "id", x, y,
+                                     unique_id)) {
+        continue;
       }
       // Here we also reset our condition for if it is a successful capture by
       // the genpath criteria, to evaluate later in the iterate loop
       m_latest_captured_point = XYPoint(x, y, "CAPTURED");
       m_successful_capture = false;
+
+      // Mark the point, and any the behavior passed over before it, as
+      // visited in the live tour
+      m_latest_captured_index = -1;
+      if (m_state == m_monitor_mode) {
+        m_latest_captured_index = m_planner.findPoint(x, y);
+        if (m_latest_captured_index >= 0) {
+          m_planner.visitPoint(m_latest_captured_index);
+        }
+      }
+    }
+    // The waypoint behavior missed an edit to its list, so send it the whole
+    // list next
+    else if (key == "WPT_EDITS_RESYNC") {
+      m_edits.forceFull();
+      if (m_state == m_monitor_mode) {
+        post_remaining();
+      }
     }
     // If the waypoint behavior says that it completes a tour of the first round
     // of points, we update our state manager
@@ -175,61 +182,127 @@ void GenRescue::post_beam(bool captured, XYPoint target) {
 }
 
 /**
- * @brief Sorts the points for the traveling salesman problem - returns a list
- * of consecutively greedy close points to one another using the euclidean
- * distance, i.e. if init is 7 and points are 9 10 4 2, it'll return 7 9 10 4 2
+ * @brief Hands the points to the worker thread to plan a tour through. Before
+ * the first tour this is all the points, and after it the unvisited points in
+ * their current order, for the worker to improve on. Tried again next iterate
+ * if the worker queue is full
  *
- * @param init_point
- * @return std::vector<XYPoint> Collection of XYPoints
+ * @param start Position to plan from
  */
 
-std::vector<XYPoint> GenRescue::sort_points(XYPoint init_point) {
-  // Could be more efficient, but no problem on my machine!
-
-  // Instantiate a sequence to be returned
-  std::vector<XYPoint> seq;
-  uint16_t min_idx = -1;
-  double min_dist = 999999999.0;
+void GenRescue::request_plan(XYPoint start) {
+  TourRequest request;
+  request.start_x = start.x();
+  request.start_y = start.y();
 
-  // Find the first closest point in the set of points w/rt the initial point
-  for (uint16_t i = 0; i < m_points.size(); i++) {
-    double dist = rel_dist(init_point, m_points[i]);
-    if (dist < min_dist) {
-      min_dist = dist;
-      min_idx = i;
+  std::vector<unsigned int> plan_map;
+  if (m_planner.isBuilt()) {
+    plan_map = m_planner.getRemaining();
+    request.warm = true;
+  } else {
+    for (unsigned int i = 0; i < m_points.size(); i++) {
+      plan_map.push_back(i);
     }
   }
 
-  // Add these two points to the sequence
-  seq.push_back(XYPoint(m_points[min_idx]));
-
-  // Delete this from the set of points
-  m_points.erase(m_points.begin() + min_idx);
-
-  // Iterate through and consume the vector while creating a copy
-  while (m_points.size() > 0) {
-    // for each point, find the next closest point compared to the last minimum
-    // index
-    uint16_t min_idx = -1;
-    double min_dist = 999999999.0;
-    for (uint16_t j = 0; j < m_points.size(); j++) {
-      double dist = rel_dist(seq[seq.size() - 1], m_points[j]);
-      // if we found a new minimum, update the minimum index
-      if (dist < min_dist) {
-        min_dist = dist;
-        min_idx = j;
-      }
-    }
+  for (size_t i = 0; i < plan_map.size(); i++) {
+    request.xs.push_back(m_points.getX(plan_map[i]));
+    request.ys.push_back(m_points.getY(plan_map[i]));
+  }
 
-    // We found this next minimum
-    seq.push_back(XYPoint(m_points[min_idx]));
+  if (m_worker.request(request) == 0) {
+    return;
+  }
+  m_plan_map = plan_map;
+  m_plan_x = start.x();
+  m_plan_y = start.y();
+  m_replan = false;
+  m_plan_done = false;
+}
+
+/**
+ * @brief Takes the latest tour from the worker, if there is one for the latest
+ * request. The first becomes the live tour, and later ones reorder its
+ * unvisited points
+ *
+ * @return true if the live tour changed
+ */
+
+bool GenRescue::adopt_plan() {
+  TourResult result;
+  if (m_replan || !m_worker.getResult(result)) {
+    return false;
+  }
+  m_plan_done = result.done;
+  if (result.tour.size() == 0) {
+    return false;
+  }
+
+  std::vector<unsigned int> order;
+  for (size_t i = 0; i < result.tour.size(); i++) {
+    order.push_back(m_plan_map[result.tour[i]]);
+  }
+
+  if (m_planner.isBuilt()) {
+    return m_planner.setRemaining(order);
+  }
+
+  // The planner refers to points by their index in the registry, which stays
+  // fixed as the tour is followed
+  m_planner.clear();
+  m_planner.setStart(m_plan_x, m_plan_y);
+  m_planner.addPoints(m_points.getXs(), m_points.getYs());
+  return m_planner.setTour(order);
+}
+
+/**
+ * @brief Posts the points of the live tour not yet visited as the new waypoint
+ * list. The waypoint behavior restarts from the first point given, so this is
+ * the whole suffix of the tour from the vehicle onwards. With wpt_edits, only
+ * the changes since the last post go out on WPT_EDITS, for BHV_TourWaypoint,
+ * keyed by registry index
+ */
 
-    // Remove this from the source sequence - this what I would suspect to be
-    // inefficient, and we could probably swap indices, but am not
-    m_points.erase(m_points.begin() + min_idx);
+void GenRescue::post_remaining() {
+  std::vector<unsigned int> remaining = m_planner.getRemaining();
+  if (remaining.size() == 0) {
+    return;
   }
-  return seq;
-};
+
+  if (m_wpt_edits) {
+    std::string edits =
+        m_edits.encode(remaining, m_points.getXs(), m_points.getYs());
+    if (edits != "") {
+      Notify("WPT_EDITS", edits);
+    }
+    return;
+  }
+
+  XYSegList seglist;
+  for (size_t i = 0; i < remaining.size(); i++) {
+    seglist.add_vertex(m_points.getX(remaining[i]),
+                       m_points.getY(remaining[i]));
+  }
+
+  std::string update_str = "points = " + seglist.get_spec();
+
+  Notify("UPDATES_WPTS", update_str);
+}
+
+/**
+ * @brief Puts a missed point back into the live tour at its cheapest place
+ * among the points not yet visited, and re-posts the waypoints from there on
+ *
+ * @param index Index of the missed point in the tour
+ */
+
+void GenRescue::revisit_point(unsigned int index) {
+  m_points.repeat(index);
+  m_planner.insertPoint(m_points.getX(index), m_points.getY(index));
+  m_replan = true;
+  post_remaining();
+}
+
 //---------------------------------------------------------
 // Procedure: Iterate()
 //            happens AppTick times per second
@@ -243,7 +316,7 @@ bool GenRescue::Iterate() {
       Monitor - while in monitor mode, when the waypoint behavior posts an
     update claiming it has captured a point by either capture radii or slip
     radii, we compare the point to GenRescues visit point conditions, and
-    determine whether or not it should be put back into the revisit queue
+    determine whether or not it should be put back into the live tour
 
       Idle - If all points have been visited by our criteria, then we simply go
     to an idle mode
@@ -255,27 +328,32 @@ bool GenRescue::Iterate() {
   // ACTIVE MODE
   if (m_state == m_active_mode && m_points.size() != 0 &&
       (m_ticks_since_update >= 50) && (m_captured_x && m_captured_y)) {
-    m_missed_points = 0;
-
-    XYSegList m_seglist;
-
-    m_points = sort_points(current_point);
-
-    post_pulse(m_captured_x, m_captured_y);
-
-    for (auto element : m_points) {
-      m_seglist.add_vertex(XYPoint(element));
+    // Planning runs on the worker thread so this never waits on it. New
+    // points since the request cancel it and start a new one.
+    if (m_replan) {
+      request_plan(current_point);
     }
+    if (adopt_plan()) {
+      m_missed_points = 0;
 
-    std::string update_str = "points = " + m_seglist.get_spec();
-
-    Notify("UPDATES_WPTS", update_str);
+      post_pulse(m_captured_x, m_captured_y);
+      post_remaining();
 
-    m_state = m_monitor_mode;
-    m_new_point = false;
+      m_state = m_monitor_mode;
+      m_new_point = false;
+    }
   }
   // MONITOR MODE
   else if (m_state == m_monitor_mode && (m_captured_x && m_captured_y)) {
+    // The worker keeps improving the tour, or replans the unvisited points
+    // after points were added, and each better tour is posted as it arrives
+    if (m_replan) {
+      request_plan(current_point);
+    }
+    if (adopt_plan()) {
+      post_remaining();
+    }
+
     // Capture condition
 
     // Get the distance between the current point and the latest captured point
@@ -283,45 +361,45 @@ bool GenRescue::Iterate() {
         rel_dist(current_point, m_latest_captured_point);
 
     // If the capture distance is greater than the visit radius, and it is a new
-    // point, then push it to the queue
+    // point, then put it straight back into the live tour
     if (!m_successful_capture && m_latest_capture_distance >= m_visit_radius &&
         rel_dist(m_last_missed_point, m_latest_captured_point) > 1) {
-      // m_points_to_revisit.push_back(m_latest_captured_point);
       m_last_missed_point = XYPoint(m_latest_captured_point);
 
       post_beam(false, m_latest_captured_point);
-      m_capture_idx++; // skip to next point where the point will remain in the
-                       // queue
+      if (m_latest_captured_index >= 0) {
+        revisit_point(m_latest_captured_index);
+      }
       m_missed_points++;
     } else {
       post_beam(true, m_latest_captured_point);
-      // a captured point gets erased from the collection of points
-      if (m_points.size() == 0) {
-        // waiting for points
-      } else {
-        m_points.erase(m_points.begin() + m_capture_idx);
-        m_successful_capture = true;
-        char buff[32];
-        memset(buff, '\0', 32);
-        snprintf(buff, 32, "id=%s, finder=%s",
-                 m_latest_captured_point.get_spec().c_str(), m_vname.c_str());
-        // Notify("FOUND_SWIMMER", buff);
-      }
+      // a captured point was already marked visited in the live tour
+      m_successful_capture = true;
+      char buff[32];
+      memset(buff, '\0', 32);
+      snprintf(buff, 32, "id=%s, finder=%s",
+               m_latest_captured_point.get_spec().c_str(), m_vname.c_str());
+      // Notify("FOUND_SWIMMER", buff);
     }
 
-    // While monitoring, if the waypoint behavior claims that it completes the
-    // first queue, but by our criteria some points have been missed, then
-    // reconstruct our points queue and transition to active mode
-
+    // While monitoring, if the waypoint behavior claims that it completes its
+    // list, but points remain in the live tour (e.g. a point missed at the
+    // very end), then post them again
+    if (m_tour_complete && (m_planner.size() > m_planner.getVisited())) {
+      m_edits.forceFull();
+      post_remaining();
+    }
+    m_tour_complete = false;
   }
   // IDLE MODE
   else {
     // Nothing to do
   }
-  if (m_new_point) {
-    m_state = m_active_mode;
-    m_tour_complete = false;
-    m_capture_idx = 0;
+  // New points were put into the live tour as they arrived, so post what
+  // remains. Before the first tour they wait for the active mode plan.
+  if (m_new_point && (m_state == m_monitor_mode)) {
+    post_remaining();
+    m_new_point = false;
   }
   m_ticks_since_update++;
   // fclose(fptr);
@@ -347,6 +425,8 @@ bool GenRescue::OnStartUp() {
 
   m_vname = "NONAME";
   m_visit_radius = 10;
+  m_plan_budget = 0.05;
+  m_worker.setSlice(m_plan_budget);
   m_current_x = -10;
   m_current_y = -10;
   m_tour_complete = false;
@@ -363,6 +443,15 @@ bool GenRescue::OnStartUp() {
     } else if (param == "visit_radius") {
       m_visit_radius = stod(value);
       handled = true;
+    } else if (param == "plan_budget") {
+      handled = setNonNegDoubleOnString(m_plan_budget, value);
+      m_worker.setSlice(m_plan_budget);
+    } else if (param == "wpt_edits") {
+      handled = setBooleanOnString(m_wpt_edits, value);
+    } else if (param == "wpt_checkpoint") {
+      unsigned int msgs = 0;
+      handled = setUIntOnString(msgs, value);
+      m_edits.setCheckpoint(msgs);
     }
 
     if (!handled)
@@ -397,6 +486,7 @@ void GenRescue::registerVariables() {
   Register("NAV_Y", 0);
   Register("HITPTS", 0);
   Register("TOUR_COMPLETE", 0);
+  Register("WPT_EDITS_RESYNC", 0);
 }
 
 //------------------------------------------------------------
@@ -411,14 +501,15 @@ bool GenRescue::buildReport() {
 
   actab << m_vname << '\n';
   actab.addHeaderLines();
-  actab << "Number of points in queue:" + std::to_string(m_points.size());
+  actab << "Number of points:" + std::to_string(m_points.size());
   actab << "Nav_X/Y Received: " + std::to_string(m_captured_x & m_captured_y);
   actab << "Latest Capture Distance:" +
                std::to_string(m_latest_capture_distance);
   actab << "Missed Points:" + std::to_string(m_missed_points);
   actab << "New Point: " + std::to_string(m_new_point);
-  actab << "Queue size: " + std::to_string(m_points.size());
+  actab << "Points visited: " + std::to_string(m_planner.getVisited());
   actab << "State: " + std::to_string(m_state);
+  actab << "Tour plan: " + std::string(m_plan_done ? "done" : "improving");
   actab << "Unique ids: " + std::to_string(m_unique_ids);
   m_msgs << actab.getFormattedString();
 
@@ -11,11 +11,14 @@
 #include "MOOS/libMOOS/Thirdparty/AppCasting/AppCastingMOOSApp.h"
 #include "XYPoint.h"
 #include "XYSegList.h"
-#include <_types/_uint32_t.h>
+#include "PointRegistry.h"
+#include "TourEdits.h"
+#include "TourPlanner.h"
+#include "TourWorker.h"
 #include <chrono>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
-#include <set>
 #include <string>
 #include <time.h>
 #include <vector>
@@ -24,7 +27,10 @@ class GenRescue : public AppCastingMOOSApp {
 public:
   GenRescue();
   ~GenRescue();
-  std::vector<XYPoint> sort_points(XYPoint init_point);
+  void request_plan(XYPoint start);
+  bool adopt_plan();
+  void post_remaining();
+  void revisit_point(unsigned int index);
   void post_pulse(double x, double y);
   void post_beam(bool captured, XYPoint missed);
 
@@ -41,9 +47,19 @@ protected:
   void registerVariables();
 
 private: // Configuration variables
+  double m_plan_budget;
+  bool m_wpt_edits = false;
+
 private: // State variables
-  std::vector<XYPoint> m_points;
-  std::vector<XYPoint> m_points_to_revisit;
+  PointRegistry m_points;
+  TourPlanner m_planner;
+  TourEdits m_edits;
+  TourWorker m_worker;
+  std::vector<unsigned int> m_plan_map;
+  double m_plan_x = 0, m_plan_y = 0;
+  bool m_replan = false;
+  bool m_plan_done = false;
+  int m_latest_captured_index = -1;
   XYPoint m_last_missed_point;
   bool m_tour_complete = false;
   int m_missed_points = 0;
@@ -58,13 +74,11 @@ private: // State variables
   XYPoint m_latest_captured_point;
 
   std::string m_vname;
-  std::set<std::string> m_ids;
   uint64_t m_ticks_since_update = 0;
   FILE *fptr;
   char buffer[120];
 
   int m_state;
-  uint32_t m_capture_idx = 0;
   int m_active_mode = 0;
   int m_monitor_mode = 1;
   int m_idle_mode = 2;
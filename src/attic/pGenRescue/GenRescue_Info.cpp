@@ -71,6 +71,11 @@ void showExampleConfigAndExit() {
   blk("  AppTick   = 4                                                 ");
   blk("  CommsTick = 4                                                 ");
   blk("                                                                ");
+  blk("  visit_radius = 10                                             ");
+  blk("  plan_budget  = 0.05   // Secs of tour improvement per update  ");
+  blk("  wpt_edits      = false // Post WPT_EDITS for BHV_TourWaypoint");
+  blk("  wpt_checkpoint = 20    // Full list every N edit posts       ");
+  blk("                                                                ");
   blk("}                                                               ");
   blk("                                                                ");
   exit(0);
@@ -17,6 +17,11 @@ using namespace std;
 
 Hydrolink::Hydrolink()
 {
+  m_suffix     = "_LINK";
+  m_mail_lag   = 0.5;
+  m_start_time = 0;
+  m_horizon    = 0;
+  m_late       = 0;
 }
 
 //---------------------------------------------------------
@@ -48,9 +53,34 @@ bool Hydrolink::OnNewMail(MOOSMSG_LIST &NewMail)
     bool   mstr  = msg.IsString();
 #endif
 
-     if(key == "FOO") 
-       cout << "great!";
-
+     int ix = findLink(key);
+     if(ix >= 0) {
+       LinkMsg lmsg;
+       lmsg.key = m_dests[ix];
+       if(lmsg.key == "")
+	 lmsg.key = key + m_suffix;
+       lmsg.is_double = msg.IsDouble();
+       if(lmsg.is_double)
+	 lmsg.dval = msg.GetDouble();
+       else
+	 lmsg.sval = msg.GetString();
+
+       // Enters the link when posted, once Iterate() knows no
+       // earlier post is still on its way. Older mail handed over
+       // on registering enters as of startup, and mail later than
+       // mail_lag enters as of the link time already reached.
+       lmsg.time = msg.GetTime();
+       if(lmsg.time < m_start_time)
+	 lmsg.time = m_start_time;
+       if(lmsg.time < m_horizon) {
+	 lmsg.time = m_horizon;
+	 m_late++;
+       }
+       lmsg.queue = ix;
+       m_held.insert(make_pair(lmsg.time, lmsg));
+     }
+     else if(isRepost(key))
+       continue; // Our own, handed back by a pattern registration
      else if(key != "APPCAST_REQ") // handled by AppCastingMOOSApp
        reportRunWarning("Unhandled Mail: " + key);
    }
@@ -70,11 +100,39 @@ bool Hydrolink::OnConnectToServer()
 //---------------------------------------------------------
 // Procedure: Iterate()
 //            happens AppTick times per second
+//      Note: The link is only run up to mail_lag seconds ago. Mail
+//            posted before then should have reached us, so it goes
+//            into the link in post order, and priorities and link
+//            timing hold whatever order mail from different posters
+//            arrives in. The cost is mail_lag of extra delay.
 
 bool Hydrolink::Iterate()
 {
   AppCastingMOOSApp::Iterate();
-  // Do your thing here!
+
+  double horizon = MOOSTime() - m_mail_lag;
+  if(horizon > m_horizon)
+    m_horizon = horizon;
+
+  while(!m_held.empty() && (m_held.begin()->first <= m_horizon)) {
+    LinkMsg lmsg = m_held.begin()->second;
+    m_held.erase(m_held.begin());
+    m_link.push(lmsg.queue, lmsg);
+  }
+
+  m_link.update(m_horizon);
+  vector<LinkMsg> delivered = m_link.popDelivered();
+  for(unsigned int i=0; i<delivered.size(); i++) {
+    if(delivered[i].is_double)
+      Notify(delivered[i].key, delivered[i].dval);
+    else
+      Notify(delivered[i].key, delivered[i].sval);
+  }
+
+  Notify("HYDROLINK_QUEUE", m_link.getDepth());
+  Notify("HYDROLINK_DROPS", m_link.getDrops());
+  Notify("HYDROLINK_BPS", m_link.getThroughput());
+
   AppCastingMOOSApp::PostReport();
   return(true);
 }
@@ -100,10 +158,48 @@ bool Hydrolink::OnStartUp()
     string value = line;
 
     bool handled = false;
-    if(param == "foo") {
-      handled = true;
+    double dval = 0;
+    if(param == "link")
+      handled = handleConfigLink(value);
+    else if(param == "bytes_per_sec") {
+      handled = setNonNegDoubleOnString(dval, value);
+      m_link.setBytesPerSec(dval);
+    }
+    else if(param == "delay") {
+      handled = setNonNegDoubleOnString(dval, value);
+      m_link.setDelay(dval);
     }
-    else if(param == "bar") {
+    else if(param == "jitter") {
+      handled = setNonNegDoubleOnString(dval, value);
+      m_link.setJitter(dval);
+    }
+    else if(param == "loss") {
+      handled = setNonNegDoubleOnString(dval, value) && (dval <= 1);
+      m_link.setLoss(dval);
+    }
+    else if(param == "rate_window") {
+      handled = setPosDoubleOnString(dval, value);
+      m_link.setRateWindow(dval);
+    }
+    else if(param == "mtu") {
+      unsigned int mtu = 0;
+      handled = setUIntOnString(mtu, value);
+      m_link.setMTU(mtu);
+    }
+    else if(param == "fragment") {
+      bool fragment = true;
+      handled = setBooleanOnString(fragment, value);
+      m_link.setFragment(fragment);
+    }
+    else if(param == "seed") {
+      unsigned int seed = 0;
+      handled = setUIntOnString(seed, value);
+      m_link.setSeed(seed);
+    }
+    else if(param == "mail_lag")
+      handled = setNonNegDoubleOnString(m_mail_lag, value);
+    else if((param == "suffix") && (value != "")) {
+      m_suffix = value;
       handled = true;
     }
 
@@ -111,7 +207,9 @@ bool Hydrolink::OnStartUp()
       reportUnhandledConfigWarning(orig);
 
   }
-  
+
+  m_start_time = MOOSTime();
+  m_horizon    = m_start_time;
   registerVariables();	
   return(true);
 }
@@ -122,23 +220,132 @@ bool Hydrolink::OnStartUp()
 void Hydrolink::registerVariables()
 {
   AppCastingMOOSApp::RegisterVariables();
-  // Register("FOOBAR", 0);
+  for(unsigned int i=0; i<m_srcs.size(); i++) {
+    if(strEnds(m_srcs[i], "*"))
+      Register(m_srcs[i], "*", 0);
+    else
+      Register(m_srcs[i], 0);
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: handleConfigLink()
+//   Example: link = src=NODE_MESSAGE_LOCAL, priority=5, queue=10
+//   Example: link = src=AGENT_INFO_*, priority=2
+//      Note: A link reposts its source as dest, or as the source
+//            plus the suffix if no dest is given or src is a
+//            pattern. Higher priority links go first. A dest that
+//            a link would pick up again is rejected, whichever of
+//            the two is configured first.
+
+bool Hydrolink::handleConfigLink(string str)
+{
+  string src  = tokStringParse(str, "src", ',', '=');
+  string dest = tokStringParse(str, "dest", ',', '=');
+  string spri = tokStringParse(str, "priority", ',', '=');
+  string sque = tokStringParse(str, "queue", ',', '=');
+
+  if((src == "") || (src == dest))
+    return(false);
+  bool pattern = strEnds(src, "*");
+  if(pattern && (dest != ""))
+    return(false);
+  if(m_exact.count(src) || (findLink(src) >= 0))
+    return(false);
+  if((dest != "") && (findLink(dest) >= 0))
+    return(false);
+  for(unsigned int i=0; i<m_dests.size(); i++) {
+    if(m_dests[i] == src)
+      return(false);
+    if(pattern && strBegins(m_dests[i], src.substr(0, src.size()-1)) &&
+       !strEnds(m_dests[i], m_suffix))
+      return(false);
+  }
+
+  unsigned int priority = 0;
+  unsigned int depth = 10;
+  if((spri != "") && !setUIntOnString(priority, spri))
+    return(false);
+  if((sque != "") && (!setUIntOnString(depth, sque) || (depth == 0)))
+    return(false);
+
+  unsigned int ix = m_link.addQueue(src, priority, depth);
+  m_srcs.push_back(src);
+  m_dests.push_back(dest);
+  if(pattern)
+    m_prefixes.push_back(make_pair(src.substr(0, src.size()-1), ix));
+  else
+    m_exact[src] = ix;
+  return(true);
 }
 
+//---------------------------------------------------------
+// Procedure: findLink()
+//   Returns: Index of the link the var goes over, or -1. Our own
+//            reposts are never matched by a pattern.
+
+int Hydrolink::findLink(const string& key) const
+{
+  map<string, unsigned int>::const_iterator p = m_exact.find(key);
+  if(p != m_exact.end())
+    return(p->second);
+
+  if(strEnds(key, m_suffix))
+    return(-1);
+  for(unsigned int i=0; i<m_prefixes.size(); i++) {
+    if(strBegins(key, m_prefixes[i].first))
+      return(m_prefixes[i].second);
+  }
+  return(-1);
+}
+
+//---------------------------------------------------------
+// Procedure: isRepost()
+//   Returns: true if the var is one this app posts from a link
+
+bool Hydrolink::isRepost(const string& key) const
+{
+  if(strEnds(key, m_suffix))
+    return(true);
+  for(unsigned int i=0; i<m_dests.size(); i++) {
+    if(m_dests[i] == key)
+      return(true);
+  }
+  return(false);
+}
 
 //------------------------------------------------------------
 // Procedure: buildReport()
 
 bool Hydrolink::buildReport() 
 {
-  m_msgs << "============================================" << endl;
-  m_msgs << "File:                                       " << endl;
-  m_msgs << "============================================" << endl;
-
-  ACTable actab(4);
-  actab << "Alpha | Bravo | Charlie | Delta";
+  m_msgs << "Link: " << doubleToStringX(m_link.getBytesPerSec(), 1) << " B/s, "
+	 << "delay " << doubleToStringX(m_link.getDelay(), 3) << "s, "
+	 << "jitter " << doubleToStringX(m_link.getJitter(), 3) << "s, "
+	 << "loss " << doubleToStringX(m_link.getLoss(), 3) << ", "
+	 << "mtu " << uintToString(m_link.getMTU()) << endl;
+  m_msgs << "Throughput: " << doubleToStringX(m_link.getThroughput(), 1)
+	 << " B/s, Queued: " << uintToString(m_link.getDepth())
+	 << ", Dropped: " << m_link.getDrops() << endl;
+  m_msgs << "Held: " << uintToString(m_held.size())
+	 << ", Late: " << m_late << " (mail_lag "
+	 << doubleToStringX(m_mail_lag, 3) << "s)" << endl;
+  double busy = m_link.getBusyUntil() - m_horizon;
+  if(busy > 0)
+    m_msgs << "Busy for: " << doubleToStringX(busy, 1) << "s" << endl;
+  m_msgs << endl;
+
+  ACTable actab(10);
+  actab << "Link | Pri | Queue | Max | In | Sent | Dlvd | Full | Lost | Size";
   actab.addHeaderLines();
-  actab << "one" << "two" << "three" << "four";
+  for(unsigned int i=0; i<m_link.size(); i++) {
+    const LinkQueue& queue = m_link.getQueue(i);
+    actab << queue.name << uintToString(queue.priority);
+    actab << uintToString(queue.msgs.size()) << uintToString(queue.max_seen);
+    actab << to_string(queue.enqueued) << to_string(queue.sent);
+    actab << to_string(queue.delivered) << to_string(queue.drop_full);
+    actab << to_string(queue.drop_loss) << to_string(queue.drop_size);
+  }
   m_msgs << actab.getFormattedString();
 
   return(true);
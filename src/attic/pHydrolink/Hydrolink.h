@@ -8,7 +8,11 @@
 #ifndef Hydrolink_HEADER
 #define Hydrolink_HEADER
 
+#include <string>
+#include <vector>
+#include <map>
 #include "MOOS/libMOOS/Thirdparty/AppCasting/AppCastingMOOSApp.h"
+#include "LinkModel.h"
 
 class Hydrolink : public AppCastingMOOSApp
 {
@@ -27,10 +31,31 @@ class Hydrolink : public AppCastingMOOSApp
 
  protected:
    void registerVariables();
+   bool handleConfigLink(std::string);
+   int  findLink(const std::string& key) const;
+   bool isRepost(const std::string& key) const;
 
  private: // Configuration variables
+   std::string m_suffix;
+
+   // Per link, the source var or pattern and an optional dest
+   std::vector<std::string> m_srcs;
+   std::vector<std::string> m_dests;
+
+   std::map<std::string, unsigned int> m_exact;
+   std::vector<std::pair<std::string, unsigned int> > m_prefixes;
+
+   double m_mail_lag;
 
  private: // State variables
+   LinkModel m_link;
+   double    m_start_time;
+
+   // Mail held until no earlier post can still be on its way, by
+   // post time, and the link time it has been pushed up to
+   std::multimap<double, LinkMsg> m_held;
+   double        m_horizon;
+   unsigned long m_late;
 };
 
 #endif 
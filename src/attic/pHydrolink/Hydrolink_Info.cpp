@@ -20,11 +20,20 @@ void showSynopsis()
 {
   blk("SYNOPSIS:                                                       ");
   blk("------------------------------------                            ");
-  blk("  The pHydrolink application is used for               ");
-  blk("                                                                ");
-  blk("                                                                ");
-  blk("                                                                ");
-  blk("                                                                ");
+  blk("  The pHydrolink application is used for emulating a narrow     ");
+  blk("  link, such as an acoustic modem, on a laptop. Each configured ");
+  blk("  var is queued and reposted as <var>_LINK once it has crossed  ");
+  blk("  a link of the given bytes per second, delay, jitter, loss and ");
+  blk("  MTU. pShare or uFldNodeBroker then bridge the _LINK vars in   ");
+  blk("  place of the originals. Queues go in priority order and drop  ");
+  blk("  their oldest message when full. Queue depths, drops and the   ");
+  blk("  achieved throughput are posted and shown in the appcast.      ");
+  blk("                                                                ");
+  blk("  Mail enters the link as of its post time, but the link is only");
+  blk("  run up to mail_lag seconds ago, so mail from several posters  ");
+  blk("  is taken in post order. Mail that arrives later than that is  ");
+  blk("  counted as late and enters as of the link time reached, so    ");
+  blk("  mail_lag should cover how long mail may take to reach us.     ");
 }
 
 //----------------------------------------------------------------
@@ -74,6 +83,21 @@ void showExampleConfigAndExit()
   blk("  AppTick   = 4                                                 ");
   blk("  CommsTick = 4                                                 ");
   blk("                                                                ");
+  blk("  bytes_per_sec = 200     // Link rate, 0 is unlimited          ");
+  blk("  delay         = 1.0     // Secs of propagation delay          ");
+  blk("  jitter        = 0.2     // Secs of uniform extra delay, max   ");
+  blk("  loss          = 0.05    // Chance each frame is lost          ");
+  blk("  mtu           = 64      // Bytes per frame, 0 is unlimited    ");
+  blk("  fragment      = true    // If false, drop msgs over the mtu   ");
+  blk("  seed          = 0       // Seed for loss and jitter           ");
+  blk("  rate_window   = 10      // Secs the throughput is taken over  ");
+  blk("  mail_lag      = 0.5     // Secs mail may take to reach us     ");
+  blk("  suffix        = _LINK   // Added to reposted var names        ");
+  blk("                                                                ");
+  blk("  link = src=NODE_MESSAGE_LOCAL, priority=5, queue=10           ");
+  blk("  link = src=CONVOY_RECAP, priority=3, queue=2                  ");
+  blk("  link = src=HIT_MARKER, priority=1                             ");
+  blk("  link = src=AGENT_INFO_*, priority=2                           ");
   blk("}                                                               ");
   blk("                                                                ");
   exit(0);
@@ -94,12 +118,18 @@ void showInterfaceAndExit()
   blk("                                                                ");
   blk("SUBSCRIPTIONS:                                                  ");
   blk("------------------------------------                            ");
-  blk("  NODE_MESSAGE = src_node=alpha,dest_node=bravo,var_name=FOO,   ");
-  blk("                 string_val=BAR                                 ");
+  blk("  The src var or pattern of each link, e.g.                     ");
+  blk("  NODE_MESSAGE_LOCAL = src_node=alpha,dest_node=bravo,          ");
+  blk("                       var_name=FOO,string_val=BAR              ");
   blk("                                                                ");
   blk("PUBLICATIONS:                                                   ");
   blk("------------------------------------                            ");
-  blk("  Publications are determined by the node message content.      ");
+  blk("  <src>_LINK, or the link dest, once across the link, e.g.      ");
+  blk("  NODE_MESSAGE_LOCAL_LINK = src_node=alpha,dest_node=bravo,     ");
+  blk("                            var_name=FOO,string_val=BAR         ");
+  blk("  HYDROLINK_QUEUE = 4         Messages waiting in all queues    ");
+  blk("  HYDROLINK_DROPS = 17        Dropped when full, lost or too big");
+  blk("  HYDROLINK_BPS   = 187.5     Bytes/sec delivered lately        ");
   blk("                                                                ");
   exit(0);
 }
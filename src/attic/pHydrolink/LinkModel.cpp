@@ -0,0 +1,253 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: LinkModel.cpp                                        */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include "LinkModel.h"
+
+using namespace std;
+
+//---------------------------------------------------------
+// Constructor()
+
+LinkModel::LinkModel() : m_uniform(0.0, 1.0)
+{
+  m_bytes_per_sec = 0;
+  m_delay    = 0;
+  m_jitter   = 0;
+  m_loss     = 0;
+  m_mtu      = 0;
+  m_fragment = true;
+  m_rate_window = 10;
+
+  m_free_at = 0;
+  m_last_delivery = 0;
+  m_now = 0;
+}
+
+//---------------------------------------------------------
+// Procedure: setLoss()
+
+void LinkModel::setLoss(double v)
+{
+  if(v < 0)
+    v = 0;
+  if(v > 1)
+    v = 1;
+  m_loss = v;
+}
+
+//---------------------------------------------------------
+// Procedure: addQueue()
+//   Returns: Index of the new queue
+
+unsigned int LinkModel::addQueue(const string& name,
+				 unsigned int priority,
+				 unsigned int max_depth)
+{
+  LinkQueue queue;
+  queue.name = name;
+  queue.priority  = priority;
+  queue.max_depth = (max_depth == 0) ? 1 : max_depth;
+  m_queues.push_back(queue);
+  return(m_queues.size() - 1);
+}
+
+//---------------------------------------------------------
+// Procedure: push()
+//      Note: The message time is when it entered the queue. The
+//            link is brought up to that time first, so a queue is
+//            only full if it would have been full then. A message
+//            older than the link time enters as of the link time.
+
+bool LinkModel::push(unsigned int ix, LinkMsg msg)
+{
+  if(ix >= m_queues.size())
+    return(false);
+  if(msg.time > m_now)
+    update(msg.time);
+  else
+    msg.time = m_now;
+
+  LinkQueue& queue = m_queues[ix];
+  msg.queue = ix;
+  msg.bytes = msg.key.size() + (msg.is_double ? 8 : msg.sval.size());
+  if(!m_fragment && (m_mtu > 0) && (msg.bytes > m_mtu)) {
+    queue.drop_size++;
+    return(false);
+  }
+
+  if(queue.msgs.size() >= queue.max_depth) {
+    queue.msgs.pop_front();
+    queue.drop_full++;
+  }
+  queue.msgs.push_back(msg);
+  queue.enqueued++;
+  if(queue.msgs.size() > queue.max_seen)
+    queue.max_seen = queue.msgs.size();
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: update()
+//      Note: Sends everything the link would have started by
+//            now, then hands over what has arrived by now
+
+void LinkModel::update(double now)
+{
+  m_now = now;
+
+  double start = 0;
+  int ix = nextQueue(start);
+  while((ix >= 0) && (start <= now)) {
+    transmit(ix, start);
+    ix = nextQueue(start);
+  }
+
+  while(!m_in_flight.empty() && (m_in_flight.front().time <= now)) {
+    LinkMsg& msg = m_in_flight.front();
+    LinkQueue& queue = m_queues[msg.queue];
+    queue.delivered++;
+    queue.bytes_delivered += msg.bytes;
+    m_history.push_back(make_pair(msg.time, msg.bytes));
+    m_delivered.push_back(msg);
+    m_in_flight.pop_front();
+  }
+
+  while(!m_history.empty() && ((now - m_history.front().first) > m_rate_window))
+    m_history.pop_front();
+}
+
+//---------------------------------------------------------
+// Procedure: popDelivered()
+
+vector<LinkMsg> LinkModel::popDelivered()
+{
+  vector<LinkMsg> delivered;
+  delivered.swap(m_delivered);
+  return(delivered);
+}
+
+//---------------------------------------------------------
+// Procedure: nextQueue()
+//   Returns: Queue of the message to send next, or -1 if none,
+//            with start set to when the link takes it. Only
+//            messages queued by then are candidates.
+
+int LinkModel::nextQueue(double& start) const
+{
+  bool   any = false;
+  double first = 0;
+  for(unsigned int i=0; i<m_queues.size(); i++) {
+    if(m_queues[i].msgs.empty())
+      continue;
+    double t = m_queues[i].msgs.front().time;
+    if(!any || (t < first))
+      first = t;
+    any = true;
+  }
+  if(!any)
+    return(-1);
+
+  start = (first > m_free_at) ? first : m_free_at;
+
+  int best = -1;
+  for(unsigned int i=0; i<m_queues.size(); i++) {
+    if(m_queues[i].msgs.empty())
+      continue;
+    double t = m_queues[i].msgs.front().time;
+    if(t > start)
+      continue;
+    if((best < 0) ||
+       (m_queues[i].priority > m_queues[best].priority) ||
+       ((m_queues[i].priority == m_queues[best].priority) &&
+	(t < m_queues[best].msgs.front().time)))
+      best = i;
+  }
+  return(best);
+}
+
+//---------------------------------------------------------
+// Procedure: transmit()
+
+void LinkModel::transmit(unsigned int ix, double start)
+{
+  LinkQueue& queue = m_queues[ix];
+  LinkMsg msg = queue.msgs.front();
+  queue.msgs.pop_front();
+  queue.sent++;
+
+  double end = start;
+  if(m_bytes_per_sec > 0)
+    end += (double)(msg.bytes) / m_bytes_per_sec;
+  m_free_at = end;
+
+  unsigned int frames = 1;
+  if(m_mtu > 0)
+    frames = (msg.bytes + m_mtu - 1) / m_mtu;
+  if(frames == 0)
+    frames = 1;
+
+  if(m_loss > 0) {
+    for(unsigned int i=0; i<frames; i++) {
+      if(m_uniform(m_rng) < m_loss) {
+	queue.drop_loss++;
+	return;
+      }
+    }
+  }
+
+  double arrival = end + m_delay;
+  if(m_jitter > 0)
+    arrival += m_jitter * m_uniform(m_rng);
+  if(arrival < m_last_delivery)
+    arrival = m_last_delivery;
+  m_last_delivery = arrival;
+
+  msg.time = arrival;
+  m_in_flight.push_back(msg);
+}
+
+//---------------------------------------------------------
+// Procedure: getDepth()
+//   Returns: Messages waiting in all queues
+
+unsigned int LinkModel::getDepth() const
+{
+  unsigned int total = 0;
+  for(unsigned int i=0; i<m_queues.size(); i++)
+    total += m_queues[i].msgs.size();
+  return(total);
+}
+
+//---------------------------------------------------------
+// Procedure: getDrops()
+//   Returns: Messages dropped for any reason in all queues
+
+unsigned long LinkModel::getDrops() const
+{
+  unsigned long total = 0;
+  for(unsigned int i=0; i<m_queues.size(); i++) {
+    const LinkQueue& queue = m_queues[i];
+    total += queue.drop_full + queue.drop_loss + queue.drop_size;
+  }
+  return(total);
+}
+
+//---------------------------------------------------------
+// Procedure: getThroughput()
+//   Returns: Bytes per second delivered over the rate window
+
+double LinkModel::getThroughput() const
+{
+  unsigned long bytes = 0;
+  for(unsigned int i=0; i<m_history.size(); i++)
+    bytes += m_history[i].second;
+  return((double)(bytes) / m_rate_window);
+}
@@ -0,0 +1,145 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: LinkModel.h                                          */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef LINK_MODEL_HEADER
+#define LINK_MODEL_HEADER
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <random>
+
+// A message crossing the link. bytes is its size on the link,
+// the key plus the value, with a double counted as 8 bytes.
+struct LinkMsg
+{
+  LinkMsg() {dval=0; is_double=false; bytes=0; time=0; queue=0;}
+
+  std::string  key;
+  std::string  sval;
+  double       dval;
+  bool         is_double;
+  unsigned int bytes;
+  double       time;    // Entered the queue, then delivery time
+  unsigned int queue;
+};
+
+// One queue per configured link, with its counts
+struct LinkQueue
+{
+  LinkQueue() {priority=0; max_depth=10; max_seen=0; enqueued=0;
+    sent=0; delivered=0; drop_full=0; drop_loss=0; drop_size=0;
+    bytes_delivered=0;}
+
+  std::string  name;
+  unsigned int priority;
+  unsigned int max_depth;
+  unsigned int max_seen;
+
+  unsigned long enqueued;
+  unsigned long sent;
+  unsigned long delivered;
+  unsigned long drop_full;
+  unsigned long drop_loss;
+  unsigned long drop_size;
+  unsigned long bytes_delivered;
+
+  std::deque<LinkMsg> msgs;
+};
+
+//---------------------------------------------------------------
+// LinkModel: a narrow serial link, such as an acoustic modem.
+// One message is on the air at a time, taking bytes/bytes_per_sec
+// seconds, split into frames of at most mtu bytes. Each frame is
+// lost with the given probability, and a message with a lost
+// frame is lost. A message too big for one frame is dropped
+// instead if fragmenting is off. Delivery follows the end of
+// transmission by the delay plus a uniform jitter, but never
+// before an earlier message, so order is kept.
+//
+// The link is modelled in its own time from the times messages
+// are queued, not from when update() is called. As long as each
+// message is pushed before the link is updated past its time, the
+// rate, delays and order do not depend on how often it is called.
+// A message pushed late is taken as queued at the current link
+// time, since the link cannot go back. When the link
+// frees up, the highest priority queue holding a message goes
+// next, the oldest message first among equals. A full queue drops
+// its oldest message to make room.
+
+class LinkModel
+{
+ public:
+  LinkModel();
+  ~LinkModel() {}
+
+  void setBytesPerSec(double v) {m_bytes_per_sec = (v < 0) ? 0 : v;}
+  void setDelay(double v)       {m_delay  = (v < 0) ? 0 : v;}
+  void setJitter(double v)      {m_jitter = (v < 0) ? 0 : v;}
+  void setLoss(double v);
+  void setMTU(unsigned int v)   {m_mtu = v;}
+  void setFragment(bool v)      {m_fragment = v;}
+  void setSeed(unsigned int v)  {m_rng.seed(v);}
+  void setRateWindow(double v)  {m_rate_window = (v <= 0) ? 1 : v;}
+
+  unsigned int addQueue(const std::string& name, unsigned int priority,
+			unsigned int max_depth);
+
+  // Returns false if the message was dropped for its size
+  bool push(unsigned int queue, LinkMsg msg);
+  void update(double now);
+  std::vector<LinkMsg> popDelivered();
+
+  unsigned int     size() const {return(m_queues.size());}
+  const LinkQueue& getQueue(unsigned int ix) const {return(m_queues[ix]);}
+
+  unsigned int  getDepth() const;
+  unsigned long getDrops() const;
+  double getThroughput() const;
+  double getBusyUntil() const {return(m_free_at);}
+
+  double getBytesPerSec() const {return(m_bytes_per_sec);}
+  double getDelay() const       {return(m_delay);}
+  double getJitter() const      {return(m_jitter);}
+  double getLoss() const        {return(m_loss);}
+  unsigned int getMTU() const   {return(m_mtu);}
+  bool   getFragment() const    {return(m_fragment);}
+
+ protected:
+  int  nextQueue(double& start) const;
+  void transmit(unsigned int queue, double start);
+
+ private: // Configuration
+  double       m_bytes_per_sec;   // 0 is unlimited
+  double       m_delay;
+  double       m_jitter;
+  double       m_loss;
+  unsigned int m_mtu;             // 0 is unlimited
+  bool         m_fragment;
+  double       m_rate_window;
+
+ private: // State
+  std::vector<LinkQueue> m_queues;
+
+  double m_free_at;               // Link time the channel frees up
+  double m_last_delivery;
+  std::deque<LinkMsg> m_in_flight;
+  std::vector<LinkMsg> m_delivered;
+
+  // Delivery times and sizes, for the throughput
+  std::deque<std::pair<double, unsigned int> > m_history;
+  double m_now;
+
+  std::mt19937 m_rng;
+  std::uniform_real_distribution<double> m_uniform;
+};
+
+#endif
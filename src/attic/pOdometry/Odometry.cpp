@@ -17,12 +17,6 @@ using namespace std;
 
 Odometry::Odometry()
 {
-  m_first_reading = false;
-  m_current_x = 0;
-  m_current_y = 0;
-  m_previous_x = 0;
-  m_previous_y = 0;
-  m_total_distance = 0;
 }
 
 //---------------------------------------------------------
@@ -54,29 +48,16 @@ bool Odometry::OnNewMail(MOOSMSG_LIST &NewMail)
     bool   mstr  = msg.IsString();
 #endif
     /*
-      Accrues the total distance traveled by the vehicle between app ticks while reading mail
+      Each sample goes to the odometer with its own timestamp, so the
+      distance is summed fix by fix regardless of the app tick
     */
      if(key == "NAV_X") 
-     {
-      m_previous_x = m_current_x;
-      m_current_x = msg.GetDouble();
-      m_delta_x += m_current_x-m_previous_x;
-     }
+       m_odometer.updateX(msg.GetDouble(), msg.GetTime());
      else if (key == "NAV_Y")
-     {
-        m_previous_y = m_current_y;
-        m_current_y = msg.GetDouble();
-        m_delta_y += m_current_y-m_previous_y;
-     }
+       m_odometer.updateY(msg.GetDouble(), msg.GetTime());
      else if(key != "APPCAST_REQ") // handled by AppCastingMOOSApp
        reportRunWarning("Unhandled Mail: " + key);
    }
-	
-  if (((m_current_x != m_previous_x) || 
-      (m_current_y != m_previous_y)) &&
-      (m_first_reading == false)) {
-        m_first_reading = true;
-      }
 
    return(true);
 }
@@ -97,13 +78,10 @@ bool Odometry::OnConnectToServer()
 bool Odometry::Iterate()
 {
   AppCastingMOOSApp::Iterate();
-  // If we've received at least one reading, update the total distance and reset the temporary variables
-  if (m_first_reading) {
-    
-    m_total_distance += sqrt(pow(m_delta_x, 2.0)+pow(m_delta_y, 2.0));
-    Notify("ODOMETRY_DIST", m_total_distance);
-    m_delta_x = 0;
-    m_delta_y = 0;
+  // Once a fix has been made, post the distance summed so far
+  if (m_odometer.getFixes() > 0) {
+    Notify("ODOMETRY_DIST", m_odometer.getDist());
+    Notify("ODOMETRY_RATE", m_odometer.getRate());
   }
   AppCastingMOOSApp::PostReport();
   return(true);
@@ -130,11 +108,15 @@ bool Odometry::OnStartUp()
     string value = line;
 
     bool handled = false;
-    if(param == "foo") {
-      handled = true;
+    if(param == "pair_tol") {
+      double secs = 0;
+      handled = setNonNegDoubleOnString(secs, value);
+      m_odometer.setPairTol(secs);
     }
-    else if(param == "bar") {
-      handled = true;
+    else if(param == "rate_window") {
+      double secs = 0;
+      handled = setPosDoubleOnString(secs, value);
+      m_odometer.setRateWindow(secs);
     }
 
     if(!handled)
@@ -162,14 +144,14 @@ void Odometry::registerVariables()
 
 bool Odometry::buildReport() 
 {
-  m_msgs << "============================================" << endl;
-  m_msgs << "File:                                       " << endl;
-  m_msgs << "============================================" << endl;
-
-  ACTable actab(4);
-  actab << "Alpha | Bravo | Charlie | Delta";
+  ACTable actab(2);
+  actab << "Odometry | Value";
   actab.addHeaderLines();
-  actab << "one" << "two" << "three" << "four";
+  actab << "Distance" << doubleToStringX(m_odometer.getDist(), 2);
+  actab << "Rate"     << doubleToStringX(m_odometer.getRate(), 2);
+  actab << "Fixes"    << uintToString(m_odometer.getFixes());
+  actab << "Unpaired" << uintToString(m_odometer.getUnpaired());
+  actab << "Dropped"  << uintToString(m_odometer.getDropped());
   m_msgs << actab.getFormattedString();
 
   return(true);
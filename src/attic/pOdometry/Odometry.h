@@ -9,6 +9,7 @@
 #define Odometry_HEADER
 
 #include "MOOS/libMOOS/Thirdparty/AppCasting/AppCastingMOOSApp.h"
+#include "PathOdometer.h"
 
 class Odometry : public AppCastingMOOSApp
 {
@@ -31,18 +32,7 @@ class Odometry : public AppCastingMOOSApp
  private: // Configuration variables
 
  private: // State variables
- bool m_first_reading;
- double m_current_x;
- double m_current_y;
- double m_current_depth;
- double m_previous_x;
- double m_previous_y;
- double m_previous_depth;
- double m_total_distance;
- double m_delta_x;
- double m_delta_y;
- double m_delta_depth;
- double m_depth_threshold;
+ PathOdometer m_odometer;
 };
 
 #endif 
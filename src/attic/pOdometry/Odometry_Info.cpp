@@ -74,6 +74,9 @@ void showExampleConfigAndExit()
   blk("  AppTick   = 4                                                 ");
   blk("  CommsTick = 4                                                 ");
   blk("                                                                ");
+  blk("  pair_tol     = 0.05   // Secs apart X/Y may be paired         ");
+  blk("  rate_window  = 10     // Secs of fixes the rate is taken over ");
+  blk("                                                                ");
   blk("}                                                               ");
   blk("                                                                ");
   exit(0);
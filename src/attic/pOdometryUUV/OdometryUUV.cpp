@@ -17,15 +17,8 @@ using namespace std;
 
 OdometryUUV::OdometryUUV()
 {
-  m_first_reading = false;
-  m_current_x = 0;
-  m_current_y = 0;
-  m_previous_x = 0;
-  m_previous_y = 0;
-  m_delta_x = 0;
-  m_delta_y = 0;
-  m_total_distance = 0;
-  m_depth_threshold = 0;
+  // Fixes wait on NAV_DEPTH so each is gated on its own depth
+  m_odometer.setUseDepth(true);
 }
 
 //---------------------------------------------------------
@@ -57,45 +50,18 @@ bool OdometryUUV::OnNewMail(MOOSMSG_LIST &NewMail)
     bool   mstr  = msg.IsString();
 #endif
     /*
-      Accrues the total distance traveled by the vehicle between app ticks while reading mail
+      Each sample goes to the odometer with its own timestamp, so the
+      distance is summed fix by fix regardless of the app tick
     */
      if(key == "NAV_X") 
-     {
-      if(m_current_depth >= m_depth_threshold) {
-        m_previous_x = m_current_x;
-        m_current_x = msg.GetDouble();
-        if ((m_previous_x_depth > m_depth_threshold) && (m_previous_y_depth > m_depth_threshold)) {
-          m_delta_x += m_current_x-m_previous_x;
-        }
-      }
-     }
+       m_odometer.updateX(msg.GetDouble(), msg.GetTime());
      else if (key == "NAV_Y")
-     {
-      if(m_current_depth >= m_depth_threshold) {
-        m_previous_y = m_current_y;
-        m_current_y = msg.GetDouble();
-        if ((m_previous_x_depth > m_depth_threshold) && (m_previous_y_depth > m_depth_threshold)) {
-          m_delta_y += m_current_y-m_previous_y;
-        }
-      }
-     }
+       m_odometer.updateY(msg.GetDouble(), msg.GetTime());
      else if (key == "NAV_DEPTH")
-     {
-        double depth = msg.GetDouble();
-        m_previous_depth = m_current_depth;
-        m_previous_y_depth = m_current_depth;
-        m_previous_x_depth = m_current_depth;
-        m_current_depth = msg.GetDouble();
-     }
+       m_odometer.updateDepth(msg.GetDouble(), msg.GetTime());
      else if(key != "APPCAST_REQ") // handled by AppCastingMOOSApp
        reportRunWarning("Unhandled Mail: " + key);
    }
-  if (((m_current_x != m_previous_x) || 
-      (m_current_y != m_previous_y) || 
-      (m_current_depth != m_previous_depth)) &&
-      (m_first_reading == false)) {
-        m_first_reading = true;
-      }
 
    return(true);
 }
@@ -116,13 +82,13 @@ bool OdometryUUV::OnConnectToServer()
 bool OdometryUUV::Iterate()
 {
   AppCastingMOOSApp::Iterate();
-  // If we've received at least one reading, update the total distance and reset the temporary variables
-  if (m_first_reading) {
-    m_total_distance += sqrt(pow(m_delta_x, 2.0)+pow(m_delta_y, 2.0));
-    Notify("ODOMETRY_DIST", m_total_distance);
-    Notify("ODOMETRY_DIST_AT_DEPTH", m_current_depth - m_depth_threshold);
-    m_delta_x = 0;
-    m_delta_y = 0;
+  // Once a fix has been made, post the distances summed so far
+  if (m_odometer.getFixes() > 0) {
+    Notify("ODOMETRY_DIST", m_odometer.getDist());
+    Notify("ODOMETRY_DIST_AT_DEPTH", m_odometer.getDistAtDepth());
+    Notify("ODOMETRY_RATE", m_odometer.getRate());
+    Notify("ODOMETRY_SEGMENTS", m_odometer.getSegments());
+    Notify("ODOMETRY_SEGMENT_DIST", m_odometer.getSegmentDist());
   }
   AppCastingMOOSApp::PostReport();
   return(true);
@@ -148,10 +114,26 @@ bool OdometryUUV::OnStartUp()
     string param = tolower(biteStringX(line, '='));
     string value = line;
 
-    bool handled = true;
+    bool handled = false;
     if(param == "depth_thresh") {
-      m_depth_threshold = atof(value.c_str());
-      handled = true;
+      double depth = 0;
+      handled = setDoubleOnString(depth, value);
+      m_odometer.setDepthThresh(depth);
+    }
+    else if(param == "use_3d") {
+      bool use_3d = false;
+      handled = setBooleanOnString(use_3d, value);
+      m_odometer.setUse3D(use_3d);
+    }
+    else if(param == "pair_tol") {
+      double secs = 0;
+      handled = setNonNegDoubleOnString(secs, value);
+      m_odometer.setPairTol(secs);
+    }
+    else if(param == "rate_window") {
+      double secs = 0;
+      handled = setPosDoubleOnString(secs, value);
+      m_odometer.setRateWindow(secs);
     }
 
     if(!handled)
@@ -160,6 +142,7 @@ bool OdometryUUV::OnStartUp()
   }
   Notify("ODOMETRY_DIST", 0.0);
   Notify("ODOMETRY_DIST_AT_DEPTH", 0.0);
+  Notify("ODOMETRY_SEGMENTS", 0.0);
   registerVariables();	
   return(true);
 }
@@ -181,14 +164,18 @@ void OdometryUUV::registerVariables()
 
 bool OdometryUUV::buildReport() 
 {
-  m_msgs << "============================================" << endl;
-  m_msgs << "File:                                       " << endl;
-  m_msgs << "============================================" << endl;
-
-  ACTable actab(4);
-  actab << "Alpha | Bravo | Charlie | Delta";
+  ACTable actab(2);
+  actab << "Odometry | Value";
   actab.addHeaderLines();
-  actab << "one" << "two" << "three" << "four";
+  actab << "Distance"     << doubleToStringX(m_odometer.getDist(), 2);
+  actab << "At depth"     << doubleToStringX(m_odometer.getDistAtDepth(), 2);
+  actab << "Segments"     << uintToString(m_odometer.getSegments());
+  actab << "Segment dist" << doubleToStringX(m_odometer.getSegmentDist(), 2);
+  actab << "Rate"         << doubleToStringX(m_odometer.getRate(), 2);
+  actab << "Depth"        << doubleToStringX(m_odometer.getDepth(), 2);
+  actab << "Fixes"        << uintToString(m_odometer.getFixes());
+  actab << "Unpaired"     << uintToString(m_odometer.getUnpaired());
+  actab << "Dropped"      << uintToString(m_odometer.getDropped());
   m_msgs << actab.getFormattedString();
 
   return(true);
@@ -74,6 +74,11 @@ void showExampleConfigAndExit()
   blk("  AppTick   = 4                                                 ");
   blk("  CommsTick = 4                                                 ");
   blk("                                                                ");
+  blk("  depth_thresh = 0      // Depth at or below which dist counts  ");
+  blk("  use_3d       = false  // Include depth change in the distance ");
+  blk("  pair_tol     = 0.05   // Secs apart X/Y/DEPTH may be paired   ");
+  blk("  rate_window  = 10     // Secs of fixes the rate is taken over ");
+  blk("                                                                ");
   blk("}                                                               ");
   blk("                                                                ");
   exit(0);
@@ -6,8 +6,11 @@
 /************************************************************/
 
 #include <iterator>
+#include <cstdlib>
+#include <algorithm>
 #include "MBUtils.h"
 #include "ACTable.h"
+#include "PointRegistry.h"
 #include "PointAssign.h"
 
 using namespace std;
@@ -82,7 +85,13 @@ bool PointAssign::OnNewMail(MOOSMSG_LIST &NewMail)
         }
       }
 
-      if (m_assign_by_region) {
+      if (m_assign_by_cluster) {
+        // Held until the last point, then placed as they come in
+        m_fleet_points.push_back(XYPoint(x, y, unique_id));
+        m_num_points++;
+        if (m_fleet.isPlanned())
+          fillQueue(m_fleet.assignPoint(x, y));
+      } else if (m_assign_by_region) {
         //for only two vehicles
         if(x < 88) {
           // Cycle over the vehicles and the points that they will receive, and then add the point to their queue
@@ -100,6 +109,33 @@ bool PointAssign::OnNewMail(MOOSMSG_LIST &NewMail)
       
     }
 
+    else if (key == "NODE_REPORT")
+    {
+      handleNodeReport(msg.GetString());
+    }
+    else if (strBegins(key, "VISIT_POINTS_ACK_"))
+    {
+      unsigned int seq = (unsigned int)(msg.GetDouble());
+      for (auto v : m_vehicles)
+      {
+        if (key == "VISIT_POINTS_ACK_" + v)
+        {
+          m_batches_out[v].erase(seq);
+          m_batch_times[v].erase(seq);
+          m_batch_resends[v].erase(seq);
+        }
+      }
+    }
+    else if (strBegins(key, "VISITED_POINT_"))
+    {
+      for (auto v : m_vehicles)
+      {
+        if (key == "VISITED_POINT_" + v)
+        {
+          handleVisitedPoint(v, msg.GetString());
+        }
+      }
+    }
     else if (key.find("READY") != std::string::npos)
     {
       for (auto v : m_vehicles)
@@ -143,36 +179,333 @@ bool PointAssign::Iterate()
 {
   AppCastingMOOSApp::Iterate();
 
+  if (m_assign_by_cluster)
+  {
+    if (!m_fleet.isPlanned() && m_all_points)
+    {
+      planFleet(m_vehicles);
+    }
+    else if (needRebalance())
+    {
+      // Spread what is left over the vehicles taking points
+      vector<string> ready;
+      for (auto v : m_vehicles)
+      {
+        if (isReady(v))
+          ready.push_back(v);
+      }
+      planFleet(ready);
+      m_replans++;
+    }
+  }
+
   // For each vehicle
   for (auto v : m_vehicles)
   {
+    if (m_batch_size > 0)
+    {
+      sendBatches(v);
+    }
     // Check if the vehicle is ready to receive its points
-    if (m_v_ready.count(v) && m_v_ready[v] == "true")
+    else if (isReady(v) && m_points_to_send[v].size() > 0)
     {
       // If its ready to receive its points, then we push a single point from its queue to the DB, and give it time to process future points while we work on the other vehicles
-      if (m_points_to_send[v].size() > 0)
-      {
-        // Append the name to the visit point message
-        string new_key = "VISIT_POINT_" + v;
-        // Notify the MOOSDB
-        Notify(new_key, m_points_to_send[v].back().get_spec());
-        // Add a special message to render it in pMarineViewer
-        postViewPoint(m_points_to_send[v].back(), m_colors[v]);
-        // Pop this message from its queue and move onto a next message which can be processed
-        m_points_to_send[v].pop_back();
-      } else if (m_points_to_send[v].size() == 0 && m_all_points == true)
-      {
-        Notify("DELIVERED_" + v, "true");
-      }
+      XYPoint point = popPoint(v);
+      // Append the name to the visit point message, and notify the MOOSDB
+      Notify("VISIT_POINT_" + v, point.get_spec());
     }
-    
-    Notify("POINTS_"+v, m_points_to_send[v].size());
-    Notify("ALL_POINTS", std::to_string(m_all_points));
+
+    // Delivered once all points are sent, and acknowledged if batched
+    if (m_all_points && m_points_to_send[v].size() == 0 &&
+        m_batches_out[v].size() == 0 && isReady(v))
+    {
+      notifyOnChange("DELIVERED_" + v, "true");
+    }
+    notifyOnChange("POINTS_" + v, m_points_to_send[v].size());
   }
+  notifyOnChange("ALL_POINTS", std::to_string(m_all_points));
   AppCastingMOOSApp::PostReport();
   return (true);
 }
 
+//---------------------------------------------------------
+// Procedure: isReady()
+//            batched, a vehicle is ready unless a batch to it had
+//            to be sent again, otherwise when it has posted READY
+
+bool PointAssign::isReady(string v)
+{
+  if (m_batch_size == 0)
+    return (m_v_ready.count(v) && m_v_ready[v] == "true");
+  return (m_batch_resends[v].size() == 0);
+}
+
+//---------------------------------------------------------
+// Procedure: popPoint()
+//            the next point for a vehicle, drawn in pMarineViewer
+//            and taken off its queue. It counts as the vehicle's
+//            until the vehicle reports it visited
+
+XYPoint PointAssign::popPoint(string v)
+{
+  XYPoint point = m_points_to_send[v].back();
+  postViewPoint(point, m_colors[v]);
+  m_points_to_send[v].pop_back();
+  m_sent[v][pointID(point)] = point;
+  if (m_fleet_queue[v].size() > 0)
+  {
+    m_fleet.visitPoint(m_fleet_queue[v].back());
+    m_fleet_queue[v].pop_back();
+  }
+  return (point);
+}
+
+//---------------------------------------------------------
+// Procedure: sendBatches()
+//            points go out as VISIT_POINTS_<v> in batches of up to
+//            batch_size, "seq=N#x=..,y=..,label=..#x=..". Up to
+//            batch_window batches may be waiting for their
+//            VISIT_POINTS_ACK_<v> at once, and any not acknowledged
+//            within batch_timeout seconds are sent again.
+
+void PointAssign::sendBatches(string v)
+{
+  double now = MOOSTime();
+  for (auto batch : m_batches_out[v])
+  {
+    if ((now - m_batch_times[v][batch.first]) > m_batch_timeout)
+    {
+      Notify("VISIT_POINTS_" + v, batch.second);
+      m_batch_times[v][batch.first] = now;
+      m_batch_resends[v][batch.first]++;
+      m_batches_resent++;
+    }
+  }
+
+  while (m_batches_out[v].size() < m_batch_window &&
+         m_points_to_send[v].size() > 0)
+  {
+    unsigned int seq = ++m_batch_seq[v];
+    string batch = "seq=" + uintToString(seq);
+    for (unsigned int i = 0; i < m_batch_size && m_points_to_send[v].size() > 0; i++)
+      batch += "#" + popPoint(v).get_spec();
+
+    Notify("VISIT_POINTS_" + v, batch);
+    m_batches_out[v][seq] = batch;
+    m_batch_times[v][seq] = now;
+    m_batches_sent++;
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: notifyOnChange()
+//            posts only if the value differs from the last post
+
+void PointAssign::notifyOnChange(string key, string sval)
+{
+  if (m_posted.count(key) && m_posted[key] == sval)
+    return;
+  m_posted[key] = sval;
+  Notify(key, sval);
+}
+
+void PointAssign::notifyOnChange(string key, double dval)
+{
+  string sval = doubleToStringX(dval);
+  if (m_posted.count(key) && m_posted[key] == sval)
+    return;
+  m_posted[key] = sval;
+  Notify(key, dval);
+}
+
+//---------------------------------------------------------
+// Procedure: handleNodeReport()
+//            vehicle positions, for seeding the fleet plan
+
+void PointAssign::handleNodeReport(string report)
+{
+  string vname = tokStringParse(report, "NAME", ',', '=');
+  string xstr = tokStringParse(report, "X", ',', '=');
+  string ystr = tokStringParse(report, "Y", ',', '=');
+  if (vname == "" || !isNumber(xstr) || !isNumber(ystr))
+    return;
+
+  for (auto v : m_vehicles)
+  {
+    if (tolower(v) == tolower(vname))
+    {
+      m_v_x[v] = atof(xstr.c_str());
+      m_v_y[v] = atof(ystr.c_str());
+    }
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: handleVisitedPoint()
+//            "id=N", a point the vehicle reached, by the id its
+//            pGenPath gave it. The point is done whichever vehicle
+//            it was last sent to
+
+void PointAssign::handleVisitedPoint(string v, string sval)
+{
+  string id = tokStringParse(sval, "id", ',', '=');
+  if (!isNumber(id))
+    return;
+
+  uint64_t unique_id = strtoull(id.c_str(), 0, 10);
+  m_visited.insert(unique_id);
+  m_visits[v]++;
+  for (auto w : m_vehicles)
+    m_sent[w].erase(unique_id);
+}
+
+//---------------------------------------------------------
+// Procedure: pointID()
+//            the id pGenPath gives a point from its label, so the
+//            two agree on ids whether or not labels are numbers
+
+uint64_t PointAssign::pointID(XYPoint point)
+{
+  return (PointRegistry::labelID(point.get_label()));
+}
+
+//---------------------------------------------------------
+// Procedure: unvisited()
+//            points for a vehicle not yet sent, or sent and not
+//            reported visited
+
+unsigned int PointAssign::unvisited(string v)
+{
+  return (m_fleet_queue[v].size() + m_sent[v].size());
+}
+
+//---------------------------------------------------------
+// Procedure: planFleet()
+//            splits the points not yet visited among the given
+//            vehicles, other vehicles get no more points. Points
+//            already sent to a vehicle that stay with it are not
+//            sent again, and those that move to another vehicle
+//            are dropped with VISIT_POINTS_DROP_<v> = "id,id,..."
+
+void PointAssign::planFleet(vector<string> vehicles)
+{
+  // Points still queued or sent and not visited, or all of them
+  // on the first plan
+  vector<XYPoint> points;
+  if (!m_fleet.isPlanned())
+    points = m_fleet_points;
+  for (auto v : m_fleet_vehicles)
+  {
+    for (auto ix : m_fleet_queue[v])
+      points.push_back(m_fleet_points[ix]);
+  }
+  for (auto v : m_vehicles)
+  {
+    for (auto sent : m_sent[v])
+      points.push_back(sent.second);
+  }
+
+  m_fleet.clear();
+  m_fleet.setThreads(m_plan_threads);
+  m_fleet.setPlanBudget(m_plan_budget);
+  for (auto v : vehicles)
+  {
+    if (m_v_x.count(v))
+      m_fleet.addVehicle(m_v_x[v], m_v_y[v]);
+    else
+      m_fleet.addVehicle();
+  }
+  for (auto point : points)
+    m_fleet.addPoint(point.x(), point.y());
+  m_fleet.plan();
+
+  m_fleet_points = points;
+  m_fleet_vehicles = vehicles;
+  for (auto v : m_vehicles)
+  {
+    m_fleet_queue[v].clear();
+    m_points_to_send[v].clear();
+  }
+  for (unsigned int vix = 0; vix < vehicles.size(); vix++)
+    fillQueue(vix);
+
+  map<uint64_t, string> owner;
+  for (unsigned int vix = 0; vix < vehicles.size(); vix++)
+  {
+    for (auto ix : m_fleet.getTour(vix))
+      owner[pointID(m_fleet_points[ix])] = vehicles[vix];
+  }
+  for (auto v : m_vehicles)
+  {
+    string drops;
+    for (auto it = m_sent[v].begin(); it != m_sent[v].end();)
+    {
+      if (owner.count(it->first) && owner[it->first] == v)
+      {
+        it++;
+        continue;
+      }
+      if (drops != "")
+        drops += ",";
+      drops += to_string(it->first);
+      it = m_sent[v].erase(it);
+      m_points_moved++;
+    }
+    if (drops != "")
+      Notify("VISIT_POINTS_DROP_" + v, drops);
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: fillQueue()
+//            a vehicle's queue from its remaining tour, last
+//            point first since points are sent from the back.
+//            Points it was sent already, or that were visited,
+//            are left out
+
+void PointAssign::fillQueue(unsigned int vix)
+{
+  if (vix >= m_fleet_vehicles.size())
+    return;
+  string v = m_fleet_vehicles[vix];
+
+  vector<unsigned int> tour = m_fleet.getRemaining(vix);
+  reverse(tour.begin(), tour.end());
+  m_fleet_queue[v].clear();
+  m_points_to_send[v].clear();
+  for (auto ix : tour)
+  {
+    uint64_t unique_id = pointID(m_fleet_points[ix]);
+    if (m_sent[v].count(unique_id) || m_visited.count(unique_id))
+      continue;
+    m_fleet_queue[v].push_back(ix);
+    m_points_to_send[v].push_back(m_fleet_points[ix]);
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: needRebalance()
+//            true if a ready vehicle has no unvisited points while
+//            another has more than rebalance_gap left, counting
+//            those it was sent but has not reported visited
+
+bool PointAssign::needRebalance()
+{
+  if (!m_fleet.isPlanned())
+    return (false);
+
+  bool idle = false;
+  bool behind = false;
+  for (auto v : m_vehicles)
+  {
+    if (isReady(v) && unvisited(v) == 0)
+      idle = true;
+    if (unvisited(v) > m_rebalance_gap)
+      behind = true;
+  }
+  return (idle && behind);
+}
+
 //---------------------------------------------------------
 // Procedure: OnStartUp()
 //            happens before connection is open
@@ -224,7 +557,7 @@ bool PointAssign::OnStartUp()
         {
           string line_clean = line.substr(1, line.length() - 2);
           std::vector<std::string> colors = parseString(line_clean, ',');
-          for (int i = 0; i < m_vehicles.size(); i++)
+          for (unsigned int i = 0; (i < m_vehicles.size()) && (i < colors.size()); i++)
           {
             m_colors[m_vehicles[i]] = colors[i];
           }
@@ -250,6 +583,20 @@ bool PointAssign::OnStartUp()
       }
       
     } 
+    else if (param == "assign_by_cluster")
+      handled = setBooleanOnString(m_assign_by_cluster, value);
+    else if (param == "plan_threads")
+      handled = setUIntOnString(m_plan_threads, value);
+    else if (param == "plan_budget")
+      handled = setNonNegDoubleOnString(m_plan_budget, value);
+    else if (param == "rebalance_gap")
+      handled = setUIntOnString(m_rebalance_gap, value);
+    else if (param == "batch_size")
+      handled = setUIntOnString(m_batch_size, value);
+    else if (param == "batch_window")
+      handled = setUIntOnString(m_batch_window, value);
+    else if (param == "batch_timeout")
+      handled = setNonNegDoubleOnString(m_batch_timeout, value);
 
     if (!handled)
       reportUnhandledConfigWarning(orig);
@@ -267,9 +614,14 @@ void PointAssign::registerVariables()
 {
   AppCastingMOOSApp::RegisterVariables();
   Register("VISIT_POINT", 0);
+  if (m_assign_by_cluster)
+    Register("NODE_REPORT", 0);
   for (auto v : m_vehicles)
   {
     Register("READY_" + v, 0);
+    Register("VISITED_POINT_" + v, 0);
+    if (m_batch_size > 0)
+      Register("VISIT_POINTS_ACK_" + v, 0);
   }
 }
 
@@ -291,5 +643,35 @@ bool PointAssign::buildReport()
 
   m_msgs << actab.getFormattedString();
 
+  if (m_assign_by_cluster)
+  {
+    m_msgs << endl << "Fleet plan:" << endl;
+    if (!m_fleet.isPlanned())
+      m_msgs << "  Holding " << m_fleet_points.size() << " points" << endl;
+    for (unsigned int vix = 0; vix < m_fleet_vehicles.size(); vix++)
+    {
+      m_msgs << "  " << m_fleet_vehicles[vix] << ": "
+             << m_fleet.getClusterSize(vix) << " points, tour length "
+             << doubleToString(m_fleet.getTourLength(vix), 1) << endl;
+    }
+    m_msgs << "  Makespan: " << doubleToString(m_fleet.getMakespan(), 1)
+           << ", replans: " << m_replans << ", points moved: "
+           << m_points_moved << endl;
+    for (auto v : m_vehicles)
+    {
+      m_msgs << "  " << v << ": " << m_visits[v] << " visited, "
+             << m_sent[v].size() << " sent and unvisited, "
+             << m_fleet_queue[v].size() << " queued" << endl;
+    }
+  }
+
+  if (m_batch_size > 0)
+  {
+    m_msgs << endl << "Batches sent: " << m_batches_sent
+           << ", resent: " << m_batches_resent << endl;
+    for (auto v : m_vehicles)
+      m_msgs << "  " << v << ": " << m_batches_out[v].size() << " unacknowledged" << endl;
+  }
+
   return (true);
 }
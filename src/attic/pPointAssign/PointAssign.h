@@ -12,7 +12,10 @@
 #include <vector>
 #include <string>
 #include "XYPoint.h"
+#include "FleetPlanner.h"
 #include <map>
+#include <set>
+#include <cstdint>
 
 class PointAssign : public AppCastingMOOSApp
 {
@@ -32,6 +35,18 @@ class PointAssign : public AppCastingMOOSApp
  protected:
    void registerVariables();
    void postViewPoint(XYPoint point, std::string color);
+   void handleNodeReport(std::string report);
+   void handleVisitedPoint(std::string v, std::string sval);
+   uint64_t pointID(XYPoint point);
+   unsigned int unvisited(std::string v);
+   void planFleet(std::vector<std::string> vehicles);
+   void fillQueue(unsigned int vix);
+   bool needRebalance();
+   bool isReady(std::string v);
+   XYPoint popPoint(std::string v);
+   void sendBatches(std::string v);
+   void notifyOnChange(std::string key, std::string sval);
+   void notifyOnChange(std::string key, double dval);
 
  private: // Configuration variables
    std::vector<std::string> m_vehicles;
@@ -46,6 +61,40 @@ class PointAssign : public AppCastingMOOSApp
   std::map<std::string, std::string> m_colors;
   bool m_all_points = false;
   bool m_assign_by_region = false;
+
+  // Cluster assignment, see FleetPlanner
+  bool m_assign_by_cluster = false;
+  unsigned int m_plan_threads = 0;
+  double m_plan_budget = 0.5;
+  unsigned int m_rebalance_gap = 5;
+  FleetPlanner m_fleet;
+  std::vector<XYPoint> m_fleet_points;
+  std::vector<std::string> m_fleet_vehicles;
+  std::map<std::string, std::vector<unsigned int>> m_fleet_queue;
+  std::map<std::string, double> m_v_x;
+  std::map<std::string, double> m_v_y;
+  unsigned int m_replans = 0;
+
+  // Points sent to each vehicle and not yet reported visited on
+  // VISITED_POINT_<v>, by point id, see planFleet()
+  std::map<std::string, std::map<uint64_t, XYPoint>> m_sent;
+  std::map<std::string, unsigned int> m_visits;
+  std::set<uint64_t> m_visited;
+  unsigned int m_points_moved = 0;
+
+  // Batched delivery with acknowledgement, see sendBatches()
+  unsigned int m_batch_size = 0;
+  unsigned int m_batch_window = 4;
+  double m_batch_timeout = 2;
+  std::map<std::string, unsigned int> m_batch_seq;
+  std::map<std::string, std::map<unsigned int, std::string>> m_batches_out;
+  std::map<std::string, std::map<unsigned int, double>> m_batch_times;
+  std::map<std::string, std::map<unsigned int, unsigned int>> m_batch_resends;
+  unsigned int m_batches_sent = 0;
+  unsigned int m_batches_resent = 0;
+
+  // Last value posted, by variable
+  std::map<std::string, std::string> m_posted;
 };
 
 #endif 
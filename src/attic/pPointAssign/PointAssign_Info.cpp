@@ -74,6 +74,18 @@ void showExampleConfigAndExit()
   blk("  AppTick   = 4                                                 ");
   blk("  CommsTick = 4                                                 ");
   blk("                                                                ");
+  blk("  vehicles = [HENRY, GILDA]                                     ");
+  blk("  colors   = [yellow, red]                                      ");
+  blk("                                                                ");
+  blk("  assign_by_region  = false   // x < 88 split, two vehicles    ");
+  blk("  assign_by_cluster = false   // Balanced clusters and tours    ");
+  blk("  plan_threads      = 0       // Cluster tours, 0 = all cores   ");
+  blk("  plan_budget       = 0.5     // Secs to improve each tour      ");
+  blk("  rebalance_gap     = 5       // Points left to trigger replan  ");
+  blk("                                                                ");
+  blk("  batch_size    = 0   // Points per VISIT_POINTS_<V>, 0 = off     ");
+  blk("  batch_window  = 4   // Batches awaiting VISIT_POINTS_ACK_<V>    ");
+  blk("  batch_timeout = 2   // Secs before a batch is sent again        ");
   blk("}                                                               ");
   blk("                                                                ");
   exit(0);
@@ -0,0 +1,154 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: LatencyHist.cpp                                      */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cmath>
+#include "LatencyHist.h"
+
+using namespace std;
+
+// Bucket 0 holds values under 1us and the last holds 100s or more
+static const double       LOW_SECS   = 1e-6;
+static const unsigned int PER_DECADE = 20;
+static const unsigned int DECADES    = 8;
+
+//---------------------------------------------------------
+// Constructor()
+
+LatencyHist::LatencyHist()
+{
+  m_bins.resize(PER_DECADE * DECADES + 2, 0);
+  clear();
+}
+
+//---------------------------------------------------------
+// Procedure: clear()
+
+void LatencyHist::clear()
+{
+  for(unsigned int i=0; i<m_bins.size(); i++)
+    m_bins[i] = 0;
+  m_count = 0;
+  m_min = 0;
+  m_max = 0;
+  m_sum = 0;
+}
+
+//---------------------------------------------------------
+// Procedure: add()
+
+void LatencyHist::add(double secs)
+{
+  if(secs < 0)
+    secs = 0;
+
+  unsigned int ix = 0;
+  if(secs >= LOW_SECS) {
+    double pos = log10(secs / LOW_SECS) * PER_DECADE;
+    ix = (unsigned int)(pos) + 1;
+    if(ix >= m_bins.size())
+      ix = m_bins.size() - 1;
+  }
+  m_bins[ix]++;
+
+  if((m_count == 0) || (secs < m_min))
+    m_min = secs;
+  if((m_count == 0) || (secs > m_max))
+    m_max = secs;
+  m_sum += secs;
+  m_count++;
+}
+
+//---------------------------------------------------------
+// Procedure: merge()
+
+void LatencyHist::merge(const LatencyHist& hist)
+{
+  if(hist.m_count == 0)
+    return;
+
+  for(unsigned int i=0; i<m_bins.size(); i++)
+    m_bins[i] += hist.m_bins[i];
+
+  if((m_count == 0) || (hist.m_min < m_min))
+    m_min = hist.m_min;
+  if((m_count == 0) || (hist.m_max > m_max))
+    m_max = hist.m_max;
+  m_sum   += hist.m_sum;
+  m_count += hist.m_count;
+}
+
+//---------------------------------------------------------
+// Procedure: getMean()
+
+double LatencyHist::getMean() const
+{
+  if(m_count == 0)
+    return(0);
+  return(m_sum / (double)(m_count));
+}
+
+//---------------------------------------------------------
+// Procedure: getPercentile()
+//      Note: pct is in [0,100]. Within a bucket the value is
+//            interpolated in log scale by rank.
+
+double LatencyHist::getPercentile(double pct) const
+{
+  if(m_count == 0)
+    return(0);
+  if(pct <= 0)
+    return(m_min);
+  if(pct >= 100)
+    return(m_max);
+
+  double rank = (pct / 100) * (double)(m_count);
+  unsigned long cum = 0;
+  for(unsigned int i=0; i<m_bins.size(); i++) {
+    if(m_bins[i] == 0)
+      continue;
+    if((double)(cum + m_bins[i]) >= rank) {
+      double lo = getBucketLow(i);
+      double hi = getBucketHigh(i);
+      if(lo < m_min)
+	lo = m_min;
+      if(hi > m_max)
+	hi = m_max;
+      double frac = (rank - (double)(cum)) / (double)(m_bins[i]);
+      if((lo <= 0) || (hi <= lo))
+	return(lo + frac * (hi - lo));
+      return(lo * pow(hi / lo, frac));
+    }
+    cum += m_bins[i];
+  }
+  return(m_max);
+}
+
+//---------------------------------------------------------
+// Procedure: getBucketLow()
+
+double LatencyHist::getBucketLow(unsigned int ix) const
+{
+  if(ix == 0)
+    return(0);
+  return(LOW_SECS * pow(10.0, (double)(ix - 1) / PER_DECADE));
+}
+
+//---------------------------------------------------------
+// Procedure: getBucketHigh()
+//   Returns: Upper edge of the bucket, or the max seen for the
+//            last bucket which has none
+
+double LatencyHist::getBucketHigh(unsigned int ix) const
+{
+  if(ix + 1 >= m_bins.size())
+    return((m_max > getBucketLow(ix)) ? m_max : getBucketLow(ix));
+  return(LOW_SECS * pow(10.0, (double)(ix) / PER_DECADE));
+}
@@ -0,0 +1,55 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: LatencyHist.h                                        */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef LATENCY_HIST_HEADER
+#define LATENCY_HIST_HEADER
+
+#include <vector>
+
+//---------------------------------------------------------------
+// LatencyHist: a histogram of latencies in seconds, with buckets
+// spaced evenly in log scale, 20 per decade from 1us to 100s, so
+// each bucket is about 12% wide. Values outside that range go in
+// an end bucket. Percentiles are interpolated within the bucket
+// they fall in and clamped to the exact min and max.
+
+class LatencyHist
+{
+ public:
+  LatencyHist();
+  ~LatencyHist() {}
+
+  void clear();
+  void add(double secs);
+  void merge(const LatencyHist& hist);
+
+  unsigned long count() const {return(m_count);}
+  double getMin() const       {return(m_count ? m_min : 0);}
+  double getMax() const       {return(m_count ? m_max : 0);}
+  double getMean() const;
+  double getPercentile(double pct) const;
+
+  // Buckets, for writing out the full histogram
+  unsigned int  size() const {return(m_bins.size());}
+  double        getBucketLow(unsigned int ix) const;
+  double        getBucketHigh(unsigned int ix) const;
+  unsigned long getBucketCount(unsigned int ix) const {return(m_bins[ix]);}
+
+ private:
+  std::vector<unsigned long> m_bins;
+
+  unsigned long m_count;
+  double m_min;
+  double m_max;
+  double m_sum;
+};
+
+#endif
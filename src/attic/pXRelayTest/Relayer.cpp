@@ -21,11 +21,24 @@
 /*****************************************************************/
 
 #include <iterator>
+#include <cstdlib>
 #include "Relayer.h"
 #include "MBUtils.h"
  
 using namespace std;
 
+//---------------------------------------------------------
+// Procedure: benchSeq
+//      Note: Benchmark payloads carry the sequence number either
+//            as the double value or at the front of the string
+
+static unsigned long benchSeq(CMOOSMsg& msg)
+{
+  if(msg.IsDouble())
+    return((unsigned long)(msg.GetDouble()));
+  return(strtoul(msg.GetString().c_str(), 0, 10));
+}
+
 //---------------------------------------------------------
 // Constructor
 
@@ -38,6 +51,44 @@ Relayer::Relayer()
 
   m_start_time_postings   = 0;
   m_start_time_iterations = 0;
+
+  m_mode           = "relay";
+  m_bench_var      = "BENCH";
+  m_payload_string = false;
+  m_payload_bytes  = 16;
+  m_rate_start     = 10;
+  m_rate_max       = 10000;
+  m_rate_factor    = 2;
+  m_step_secs      = 10;
+  m_drain_secs     = 1;
+  m_start_delay    = 2;
+  m_max_latency    = 1;
+
+  m_seq            = 0;
+  m_send_bytes     = 8;
+  m_step_first_seq = 0;
+  m_step_recd      = 0;
+  m_step           = -1;
+  m_rate           = 0;
+  m_step_start     = 0;
+  m_drain_start    = 0;
+  m_connect_time   = 0;
+  m_draining       = false;
+  m_saturated      = false;
+  m_done           = false;
+}
+
+//---------------------------------------------------------
+// Procedure: setMode
+
+bool Relayer::setMode(string s)
+{
+  s = tolower(s);
+  if((s != "relay") && (s != "ping") && (s != "pong") &&
+     (s != "pub") && (s != "sub"))
+    return(false);
+  m_mode = s;
+  return(true);
 }
 
 //---------------------------------------------------------
@@ -51,10 +102,36 @@ bool Relayer::OnNewMail(MOOSMSG_LIST &NewMail)
     
     string key = msg.GetKey();
 
-    if(key == m_incoming_var_1)
-      m_tally_recd++;
-    if(key == m_incoming_var_2)
-      m_tally_recd++;
+    if(m_mode == "relay") {
+      if(key == m_incoming_var_1)
+	m_tally_recd++;
+      if(key == m_incoming_var_2)
+	m_tally_recd++;
+      continue;
+    }
+
+    // A pong echoes a ping right away, before any bookkeeping
+    if(key == m_bench_var + "_PING") {
+      if(msg.IsDouble())
+	Notify(m_bench_var + "_PONG", msg.GetDouble());
+      else
+	Notify(m_bench_var + "_PONG", msg.GetString());
+      handleArrival(msg);
+    }
+    else if(key == m_bench_var)
+      handleArrival(msg);
+    else if(key == m_bench_var + "_PONG")
+      handlePong(msg);
+    // Posts from before we connected, such as those handed over
+    // on registering, belong to an earlier run
+    else if(key == m_bench_var + "_STEP") {
+      if(msg.GetTime() >= m_connect_time)
+	handleStep(msg);
+    }
+    else if(key == m_bench_var + "_SAT") {
+      if((m_step >= 0) && (msg.GetTime() >= m_step_start))
+	m_saturated = true;
+    }
   }
   return(true);
 }
@@ -64,6 +141,7 @@ bool Relayer::OnNewMail(MOOSMSG_LIST &NewMail)
 
 bool Relayer::OnConnectToServer()
 {
+  m_connect_time = MOOSTime();
   RegisterVariables();  
   return(true);
 }
@@ -74,10 +152,26 @@ bool Relayer::OnConnectToServer()
 
 void Relayer::RegisterVariables()
 {
-  if(m_incoming_var_1 != "")
-    Register(m_incoming_var_1, 0);
-  if(m_incoming_var_2 != "")
-    Register(m_incoming_var_2, 0);
+  if(m_mode == "relay") {
+    if(m_incoming_var_1 != "")
+      Register(m_incoming_var_1, 0);
+    if(m_incoming_var_2 != "")
+      Register(m_incoming_var_2, 0);
+  }
+  else if(m_mode == "ping") {
+    Register(m_bench_var + "_PONG", 0);
+    Register(m_bench_var + "_SAT", 0);
+  }
+  else if(m_mode == "pong") {
+    Register(m_bench_var + "_PING", 0);
+    Register(m_bench_var + "_STEP", 0);
+  }
+  else if(m_mode == "pub")
+    Register(m_bench_var + "_SAT", 0);
+  else if(m_mode == "sub") {
+    Register(m_bench_var, 0);
+    Register(m_bench_var + "_STEP", 0);
+  }
 }
 
 
@@ -86,6 +180,13 @@ void Relayer::RegisterVariables()
 
 bool Relayer::Iterate()
 {
+  if((m_mode == "ping") || (m_mode == "pub")) {
+    iterateSweep();
+    return(true);
+  }
+  if(m_mode != "relay")
+    return(true);
+
   m_iterations++;
 
   unsigned int i, amt = (m_tally_recd - m_tally_sent);
@@ -119,6 +220,349 @@ bool Relayer::Iterate()
   return(true);
 }
 
+//---------------------------------------------------------
+// Procedure: iterateSweep()
+//      Note: Each step publishes at a fixed rate for step_secs,
+//            then waits drain_secs for stragglers before closing.
+//            Sends due since the last iteration go out together,
+//            so rates above the AppTick arrive in bursts.
+
+void Relayer::iterateSweep()
+{
+  if(m_done)
+    return;
+
+  double now = MOOSTime();
+  if(m_step < 0) {
+    if((m_connect_time == 0) || ((now - m_connect_time) < m_start_delay))
+      return;
+    m_step = 0;
+    m_rate = m_rate_start;
+    startStep();
+  }
+
+  if(m_draining) {
+    if((now - m_drain_start) >= m_drain_secs)
+      closeStep();
+    return;
+  }
+
+  string var = m_bench_var;
+  if(m_mode == "ping")
+    var += "_PING";
+
+  double elapsed = now - m_step_start;
+  if(elapsed > m_step_secs)
+    elapsed = m_step_secs;
+  unsigned long due = (unsigned long)(elapsed * m_rate);
+  while((m_seq - m_step_first_seq) < due)
+    sendBench(var);
+
+  if((now - m_step_start) >= m_step_secs) {
+    m_draining   = true;
+    m_drain_start = now;
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: startStep()
+//      Note: The step post carries the first sequence number of
+//            the step, so receivers can count losses at its ends
+
+void Relayer::startStep()
+{
+  m_step_start     = MOOSTime();
+  m_step_first_seq = m_seq;
+  m_step_recd      = 0;
+  m_draining       = false;
+  m_step_rtt.clear();
+  m_step_oneway.clear();
+
+  string msg = "step=" + uintToString(m_step);
+  msg += ",rate=" + doubleToStringX(m_rate, 3);
+  msg += ",seq=" + to_string(m_seq);
+  Notify(m_bench_var + "_STEP", msg);
+}
+
+//---------------------------------------------------------
+// Procedure: closeStep()
+//      Note: The sweep ends once a step saturates, by loss or
+//            latency here or a _SAT post from a receiver, or
+//            once the next rate would pass rate_max
+
+void Relayer::closeStep()
+{
+  bool is_string = m_payload_string || (m_mode == "ping");
+  unsigned int bytes = m_send_bytes;
+  unsigned long sent = m_seq - m_step_first_seq;
+
+  if(m_mode == "ping") {
+    unsigned long lost = 0;
+    if(sent > m_step_recd)
+      lost = sent - m_step_recd;
+    if(overLimit(m_step_rtt, lost))
+      m_saturated = true;
+    writeRow("rtt", GetAppName(), m_step, m_rate, is_string, bytes,
+	     sent, m_step_recd, lost, m_step_rtt, m_saturated);
+    writeRow("oneway", GetAppName(), m_step, m_rate, is_string, bytes,
+	     sent, m_step_recd, lost, m_step_oneway, m_saturated);
+    m_run_rtt.merge(m_step_rtt);
+    m_run_oneway.merge(m_step_oneway);
+  }
+  else
+    writeRow("sent", GetAppName(), m_step, m_rate, is_string, bytes,
+	     sent, 0, 0, m_step_rtt, m_saturated);
+
+  double next_rate = m_rate * m_rate_factor;
+  if(m_saturated || (m_rate_factor <= 1) || (next_rate > m_rate_max)) {
+    m_done = true;
+    m_draining = false;
+    Notify(m_bench_var + "_STEP", "step=done,seq=" + to_string(m_seq));
+
+    string result = "steps=" + uintToString(m_step + 1);
+    result += ",last_rate=" + doubleToStringX(m_rate, 3);
+    result += ",saturated=" + boolToString(m_saturated);
+    Notify(m_bench_var + "_SWEEP", result);
+    writeHistFile();
+    return;
+  }
+
+  m_step++;
+  m_rate = next_rate;
+  startStep();
+}
+
+//---------------------------------------------------------
+// Procedure: sendBench()
+//      Note: Pings are always strings, "seq:sender:" and then any
+//            padding, so pongs to other ping instances on the same
+//            bench_var can be told apart from our own
+
+void Relayer::sendBench(const string& var)
+{
+  unsigned long seq = m_seq++;
+  m_send_times[seq % m_send_times.size()] = MOOSTime();
+
+  bool ping = (m_mode == "ping");
+  if(!m_payload_string && !ping) {
+    m_send_bytes = 8;
+    Notify(var, (double)(seq));
+    return;
+  }
+
+  string payload = to_string(seq) + ":";
+  if(ping)
+    payload += GetAppName() + ":";
+  if(m_payload_string && (payload.size() < m_payload_bytes))
+    payload += m_padding.substr(0, m_payload_bytes - payload.size());
+  m_send_bytes = payload.size();
+  Notify(var, payload);
+}
+
+//---------------------------------------------------------
+// Procedure: handlePong()
+//      Note: Only a pong of a ping from us that is still awaiting
+//            its pong counts. Pongs to other ping instances, from
+//            before this step, echoed twice, or so old their send
+//            time slot was reused, are ignored.
+
+void Relayer::handlePong(CMOOSMsg& msg)
+{
+  if(m_done || (m_step < 0) || !msg.IsString())
+    return;
+
+  string sval   = msg.GetString();
+  string seqstr = biteString(sval, ':');
+  string sender = biteString(sval, ':');
+  if((sender != GetAppName()) || !isNumber(seqstr))
+    return;
+
+  unsigned long seq = strtoul(seqstr.c_str(), 0, 10);
+  if((seq < m_step_first_seq) || (seq >= m_seq))
+    return;
+  if((m_seq - seq) > m_send_times.size())
+    return;
+
+  // Cleared once answered, so a repeated pong is not counted
+  double& send_time = m_send_times[seq % m_send_times.size()];
+  if(send_time <= 0)
+    return;
+
+  double now = MOOSTime();
+  m_step_rtt.add(now - send_time);
+  m_step_oneway.add(now - msg.GetTime());
+  m_step_recd++;
+  send_time = 0;
+}
+
+//---------------------------------------------------------
+// Procedure: handleStep()
+//      Note: A step post from a publisher closes its previous
+//            step here, so each publisher is tracked on its own
+
+void Relayer::handleStep(CMOOSMsg& msg)
+{
+  string src  = msg.GetSource();
+  string sval = msg.GetString();
+  string step = tokStringParse(sval, "step", ',', '=');
+  unsigned long seq = strtoul(tokStringParse(sval, "seq", ',', '=').c_str(), 0, 10);
+
+  BenchSource& stats = m_sources[src];
+  if(stats.step >= 0)
+    closeSource(src, stats, seq);
+
+  if(step == "done") {
+    stats.step = -1;
+    writeHistFile();
+    return;
+  }
+
+  stats.step      = atoi(step.c_str());
+  stats.rate      = atof(tokStringParse(sval, "rate", ',', '=').c_str());
+  stats.first_seq = seq;
+  stats.expect    = seq;
+  stats.recd = 0;
+  stats.lost = 0;
+  stats.dups = 0;
+  stats.hist.clear();
+}
+
+//---------------------------------------------------------
+// Procedure: handleArrival()
+//      Note: MOOS delivers one client's posts in order, so a seq
+//            ahead of the one expected means those between were
+//            lost, and one behind is a repeat
+
+void Relayer::handleArrival(CMOOSMsg& msg)
+{
+  map<string, BenchSource>::iterator p = m_sources.find(msg.GetSource());
+  if((p == m_sources.end()) || (p->second.step < 0))
+    return;
+
+  double now = MOOSTime();
+  BenchSource& stats = p->second;
+  unsigned long seq = benchSeq(msg);
+  if(seq < stats.expect) {
+    stats.dups++;
+    return;
+  }
+
+  if(stats.recd == 0) {
+    stats.is_string = msg.IsString();
+    stats.bytes = stats.is_string ? msg.GetString().size() : 8;
+  }
+  stats.lost  += seq - stats.expect;
+  stats.expect = seq + 1;
+  stats.recd++;
+  stats.hist.add(now - msg.GetTime());
+}
+
+//---------------------------------------------------------
+// Procedure: closeSource()
+
+void Relayer::closeSource(const string& src, BenchSource& stats,
+			  unsigned long end_seq)
+{
+  if(end_seq > stats.expect)
+    stats.lost += end_seq - stats.expect;
+
+  unsigned long sent = 0;
+  if(end_seq > stats.first_seq)
+    sent = end_seq - stats.first_seq;
+
+  bool saturated = overLimit(stats.hist, stats.lost);
+  writeRow("oneway", src, stats.step, stats.rate, stats.is_string,
+	   stats.bytes, sent, stats.recd, stats.lost, stats.hist,
+	   saturated);
+  m_run_oneway.merge(stats.hist);
+
+  if(saturated)
+    Notify(m_bench_var + "_SAT", GetAppName());
+}
+
+//---------------------------------------------------------
+// Procedure: overLimit()
+//   Returns: true if a step lost messages, or its 90th percentile
+//            latency shows a backlog past max_latency
+
+bool Relayer::overLimit(const LatencyHist& hist, unsigned long lost) const
+{
+  if(lost > 0)
+    return(true);
+  return(hist.getPercentile(90) > m_max_latency);
+}
+
+//---------------------------------------------------------
+// Procedure: writeRow()
+//      Note: One CSV row per step and latency kind, with times in
+//            seconds. The row is also posted as <bench_var>_RESULT.
+
+void Relayer::writeRow(const string& kind, const string& src, int step,
+		       double rate, bool is_string, unsigned int bytes,
+		       unsigned long sent, unsigned long recd,
+		       unsigned long lost, const LatencyHist& hist,
+		       bool saturated)
+{
+  if(!m_report.is_open()) {
+    m_report.open(m_report_file.c_str());
+    m_report << "mode,kind,source,step,rate,payload,bytes,sent,recd,lost,"
+	     << "min,p50,p90,p99,p999,max,mean,saturated" << endl;
+  }
+
+  string row = m_mode + "," + kind + "," + src;
+  row += "," + intToString(step);
+  row += "," + doubleToStringX(rate, 3);
+  row += is_string ? ",string" : ",double";
+  row += "," + uintToString(bytes);
+  row += "," + to_string(sent);
+  row += "," + to_string(recd);
+  row += "," + to_string(lost);
+  row += "," + doubleToString(hist.getMin(), 6);
+  row += "," + doubleToString(hist.getPercentile(50), 6);
+  row += "," + doubleToString(hist.getPercentile(90), 6);
+  row += "," + doubleToString(hist.getPercentile(99), 6);
+  row += "," + doubleToString(hist.getPercentile(99.9), 6);
+  row += "," + doubleToString(hist.getMax(), 6);
+  row += "," + doubleToString(hist.getMean(), 6);
+  row += "," + boolToString(saturated);
+
+  m_report << row << endl;
+
+  string result = "kind=" + kind + ",src=" + src;
+  result += ",step=" + intToString(step);
+  result += ",rate=" + doubleToStringX(rate, 3);
+  result += ",recd=" + to_string(recd) + ",lost=" + to_string(lost);
+  result += ",p50=" + doubleToStringX(hist.getPercentile(50), 6);
+  result += ",p99=" + doubleToStringX(hist.getPercentile(99), 6);
+  Notify(m_bench_var + "_RESULT", result);
+}
+
+//---------------------------------------------------------
+// Procedure: writeHistFile()
+//      Note: Rewritten in full each time, with the buckets of all
+//            closed steps so far
+
+void Relayer::writeHistFile()
+{
+  if(m_hist_file == "")
+    return;
+
+  ofstream out(m_hist_file.c_str());
+  out << "kind,low,high,count" << endl;
+
+  const LatencyHist* hists[2] = {&m_run_rtt, &m_run_oneway};
+  const char* kinds[2] = {"rtt", "oneway"};
+  for(unsigned int k=0; k<2; k++) {
+    const LatencyHist& hist = *hists[k];
+    for(unsigned int i=0; i<hist.size(); i++) {
+      if(hist.getBucketCount(i) == 0)
+	continue;
+      out << kinds[k] << "," << doubleToString(hist.getBucketLow(i), 7)
+	  << "," << doubleToString(hist.getBucketHigh(i), 7)
+	  << "," << hist.getBucketCount(i) << endl;
+    }
+  }
+}
 
 
 //---------------------------------------------------------
@@ -142,8 +586,47 @@ bool Relayer::OnStartUp()
       m_incoming_var_2 = value;
     else if(param == "outgoing_var")
       m_outgoing_var = value;
+    else if(param == "mode")
+      setMode(value);
+    else if(param == "bench_var")
+      m_bench_var = toupper(value);
+    else if(param == "payload")
+      m_payload_string = (tolower(value) == "string");
+    else if(param == "payload_bytes")
+      setUIntOnString(m_payload_bytes, value);
+    else if(param == "rate_start")
+      setPosDoubleOnString(m_rate_start, value);
+    else if(param == "rate_max")
+      setPosDoubleOnString(m_rate_max, value);
+    else if(param == "rate_factor")
+      setPosDoubleOnString(m_rate_factor, value);
+    else if(param == "step_secs")
+      setPosDoubleOnString(m_step_secs, value);
+    else if(param == "drain_secs")
+      setNonNegDoubleOnString(m_drain_secs, value);
+    else if(param == "start_delay")
+      setNonNegDoubleOnString(m_start_delay, value);
+    else if(param == "max_latency")
+      setPosDoubleOnString(m_max_latency, value);
+    else if(param == "report_file")
+      m_report_file = value;
+    else if(param == "hist_file")
+      m_hist_file = value;
   }
 
+  // String payloads from 16B to 64KB, a double is always 8B
+  if(m_payload_bytes < 16)
+    m_payload_bytes = 16;
+  if(m_payload_bytes > 65536)
+    m_payload_bytes = 65536;
+  m_padding = string(m_payload_bytes, 'x');
+
+  // Enough send times to match pongs at 10K/sec over ~6 secs
+  m_send_times.resize(65536, 0);
+
+  if(m_report_file == "")
+    m_report_file = GetAppName() + "_bench.csv";
+
   RegisterVariables();
   return(true);
 }
@@ -23,7 +23,30 @@
 #ifndef P_RELAY_VAR_HEADER
 #define P_RELAY_VAR_HEADER
 
+#include <string>
+#include <vector>
+#include <map>
+#include <fstream>
 #include "MOOS/libMOOS/MOOSLib.h"
+#include "LatencyHist.h"
+
+// Arrivals from one publisher, over its current sweep step
+struct BenchSource
+{
+  BenchSource() {step=-1; rate=0; first_seq=0; expect=0;
+    recd=0; lost=0; dups=0; is_string=false; bytes=0;}
+
+  int           step;
+  double        rate;
+  unsigned long first_seq;
+  unsigned long expect;
+  unsigned long recd;
+  unsigned long lost;
+  unsigned long dups;
+  bool          is_string;
+  unsigned int  bytes;
+  LatencyHist   hist;
+};
 
 class Relayer : public CMOOSApp
 {
@@ -39,6 +62,26 @@ class Relayer : public CMOOSApp
 
   void setIncomingVar(std::string s) {m_incoming_var_1=s;};
   void setOutgoingVar(std::string s) {m_outgoing_var=s;};
+  bool setMode(std::string s);
+
+ protected: // Benchmark modes
+  void iterateSweep();
+  void startStep();
+  void closeStep();
+  void sendBench(const std::string& var);
+  void handlePong(CMOOSMsg& msg);
+  void handleStep(CMOOSMsg& msg);
+  void handleArrival(CMOOSMsg& msg);
+  void closeSource(const std::string& src, BenchSource& stats,
+		   unsigned long end_seq);
+
+  bool overLimit(const LatencyHist& hist, unsigned long lost) const;
+  void writeRow(const std::string& kind, const std::string& src,
+		int step, double rate, bool is_string,
+		unsigned int bytes, unsigned long sent,
+		unsigned long recd, unsigned long lost,
+		const LatencyHist& hist, bool saturated);
+  void writeHistFile();
 
  protected:
   unsigned long int m_tally_recd;
@@ -51,6 +94,48 @@ class Relayer : public CMOOSApp
 
   double            m_start_time_postings;
   double            m_start_time_iterations;
+
+ protected: // Benchmark configuration
+  std::string  m_mode;           // relay, ping, pong, pub or sub
+  std::string  m_bench_var;
+  bool         m_payload_string;
+  unsigned int m_payload_bytes;
+  double       m_rate_start;
+  double       m_rate_max;
+  double       m_rate_factor;
+  double       m_step_secs;
+  double       m_drain_secs;
+  double       m_start_delay;
+  double       m_max_latency;
+  std::string  m_report_file;
+  std::string  m_hist_file;
+
+ protected: // Benchmark state, publishing side
+  std::string         m_padding;
+  std::vector<double> m_send_times;   // By seq, modulo its size, 0
+                                      // once a ping is answered
+  unsigned int  m_send_bytes;
+  unsigned long m_seq;
+  unsigned long m_step_first_seq;
+  unsigned long m_step_recd;
+  int     m_step;
+  double  m_rate;
+  double  m_step_start;
+  double  m_drain_start;
+  double  m_connect_time;
+  bool    m_draining;
+  bool    m_saturated;
+  bool    m_done;
+
+  LatencyHist m_step_rtt;
+  LatencyHist m_step_oneway;
+
+ protected: // Benchmark state, receiving side
+  std::map<std::string, BenchSource> m_sources;
+
+  LatencyHist   m_run_rtt;
+  LatencyHist   m_run_oneway;
+  std::ofstream m_report;
 };
 
 #endif 
@@ -39,6 +39,21 @@ void showSynopsis()
   blk("  example of the MOOS publish-subscribe architecture. It is     ");
   blk("  typically run in conjunction with another instance of the same");
   blk("  process to send mail back and forth to each other.            ");
+  blk("                                                                ");
+  blk("  It also serves as a MOOSDB benchmark. A ping instance sweeps  ");
+  blk("  publish rates, each step rate_factor times the last, against  ");
+  blk("  a pong instance that echoes each message back. A pub instance ");
+  blk("  sweeps rates to any number of sub instances. Payloads are a   ");
+  blk("  double or a string of 16B to 64KB. Round-trip and one-way     ");
+  blk("  latency percentiles and losses are written per step to a CSV  ");
+  blk("  report. The sweep stops at the first step with loss, or with a");
+  blk("  90th percentile latency past max_latency. One-way latency uses");
+  blk("  the post time, so needs instances on one clock.               ");
+  blk("                                                                ");
+  blk("  Pings are always strings, \"seq:sender:\" padded out if the    ");
+  blk("  payload is a string, and a ping instance only counts pongs to ");
+  blk("  its own pings, once each. Several ping instances may share a  ");
+  blk("  pong instance as long as their app names differ.              ");
 }
 
 //----------------------------------------------------------------
@@ -65,6 +80,8 @@ void showHelpAndExit()
   blk("      Use <varname> as the Relay incoming variable              ");
   mag("  --interface, -i                                               ");
   blk("      Display MOOS publications and subscriptions.              ");
+  mag("  --mode","=<mode>                                              ");
+  blk("      Run as relay (default), ping, pong, pub or sub            ");
   mag("  --out","=<varname>                                            ");
   blk("      Use <varname> as the Relay outgoing variable              ");
   blk("                                                                ");
@@ -92,6 +109,20 @@ void showExampleConfigAndExit()
   blk("                                                                ");
   blk("  OUTGOING_VAR = APPLES                                         ");
   blk("  INCOMING_VAR = PEARS                                          ");
+  blk("                                                                ");
+  blk("  mode          = relay   // relay, ping, pong, pub or sub      ");
+  blk("  bench_var     = BENCH   // Prefix of all benchmark variables  ");
+  blk("  payload       = double  // double or string                   ");
+  blk("  payload_bytes = 16      // String size, 16 to 65536           ");
+  blk("  rate_start    = 10      // Msgs/sec of the first step         ");
+  blk("  rate_max      = 10000   // Msgs/sec not to be passed          ");
+  blk("  rate_factor   = 2       // Rate of each step over the last    ");
+  blk("  step_secs     = 10      // Secs of publishing per step        ");
+  blk("  drain_secs    = 1       // Secs to wait for stragglers        ");
+  blk("  start_delay   = 2       // Secs after connecting to start     ");
+  blk("  max_latency   = 1       // Secs of p90 latency deemed backlog ");
+  blk("  report_file   = <AppName>_bench.csv                           ");
+  blk("  hist_file     =         // Optional CSV of histogram buckets  ");
   blk("}                                                               ");
   blk("                                                                ");
   exit(0);
@@ -115,11 +146,26 @@ void showInterfaceAndExit()
   blk("  Whatever variable is specified by the INCOMING_VAR            ");
   blk("  configuration parameter.                                      ");
   blk("                                                                ");
+  blk("  In benchmark modes, with the default bench_var:               ");
+  blk("  BENCH_PONG = 12:ping:  (ping)   Echoed sequence and sender    ");
+  blk("  BENCH_PING = 12:ping:  (pong)   Sequence and sender to echo   ");
+  blk("  BENCH      = 12  (sub)          Sequence number               ");
+  blk("  BENCH_STEP = step=3,rate=80,seq=1200  (pong, sub)             ");
+  blk("  BENCH_SAT  = alpha  (ping, pub) A receiver saw loss or backlog");
+  blk("                                                                ");
   blk("PUBLICATIONS:                                                   ");
   blk("------------------------------------                            ");
   blk("  Whatever variable is specified by the OUTGOING_VAR            ");
   blk("  configuration parameter.                                      ");
   blk("                                                                ");
+  blk("  In benchmark modes, with the default bench_var:               ");
+  blk("  BENCH_PING, BENCH, BENCH_PONG   Payloads as above             ");
+  blk("  BENCH_STEP   = step=3,rate=80,seq=1200                        ");
+  blk("  BENCH_SAT    = pong             Step closed with loss/backlog ");
+  blk("  BENCH_RESULT = kind=rtt,src=ping,step=3,rate=80,recd=800,     ");
+  blk("                 lost=0,p50=0.004,p99=0.012                     ");
+  blk("  BENCH_SWEEP  = steps=8,last_rate=1280,saturated=true          ");
+  blk("                                                                ");
   exit(0);
 }
 
@@ -131,10 +131,6 @@ BHV_ConvoyPD::BHV_ConvoyPD(IvPDomain domain) : IvPBehavior(domain)
 
   // Add any variables this behavior needs to subscribe for
 
-  m_desired_speed = 1.2;       // meters per second
-  m_point_update_distance = 1; // meters
-  m_ideal_follow_range = 5;    // meters
-
   m_is_leader = false;
   m_is_midship = false;
   m_is_tail = false;
@@ -146,18 +142,17 @@ BHV_ConvoyPD::BHV_ConvoyPD(IvPDomain domain) : IvPBehavior(domain)
   m_osx = 0;
   m_osy = 0;
   m_osh = 0;
-  m_osx_prv = 0;
-  m_osy_prv = 0;
   m_osh_prv = 0;
-  m_interval_odo = 0;                           // meters
-  m_eps = 0.01;                                 // Meters - sufficient errors
   m_posted_points = 0;                          // counter
-  m_max_tail_length = 3 * m_ideal_follow_range; // maximum tail length to be left behind - we have this so the leaders trajectory will mostly be followed
+  m_max_tail_length = 3 * m_pd_policy.getIdealFollowRng(); // maximum tail length to be left behind - we have this so the leaders trajectory will mostly be followed
   m_color = "yellow";
   m_redudant_update_interval = 2; // by default, every two seconds, we will deliberately post a redundant message to our neighbors
 
   m_debug = true;
 
+  m_compact_wire = false;
+  m_ext_assign = false;
+
   m_debug_fname = "debug_" + m_us_name + ".txt";
 
   m_ownship = XYPoint(m_osx, m_osy);
@@ -232,14 +227,10 @@ bool BHV_ConvoyPD::setParam(string param, string val)
   {
     return setBooleanOnString(m_is_leader, val);
   }
-  else if (param == "desired_speed" && isNumber(val))
-  {
-    m_desired_speed = stod(val);
-    return true;
-  }
-  else if (param == "ideal_follow_range" && isNumber(val))
+  else if (m_pd_policy.setParam(param, val))
   {
-    m_ideal_follow_range = stod(val);
+    // desired_speed, ideal_follow_range, point_update_distance
+    // and the kp, kd, ki speed gains
     return true;
   }
   else if (param == "type")
@@ -247,26 +238,6 @@ bool BHV_ConvoyPD::setParam(string param, string val)
     m_type_assignment = val;
     return true;
   }
-  else if (param == "point_update_distance" && isNumber(val))
-  {
-    m_point_update_distance = stod(val);
-    return true;
-  }
-  else if (param == "kp_spd" && isNumber(val))
-  {
-    kp_spd = stod(val);
-    return true;
-  }
-  else if (param == "kd_spd" && isNumber(val))
-  {
-    kd_spd = stod(val);
-    return true;
-  }
-  else if (param == "ki_spd" && isNumber(val))
-  {
-    ki_spd = stod(val);
-    return true;
-  }
   else if (param == "kp_hdg" && isNumber(val))
   {
     kp_hdg = stod(val);
@@ -282,9 +253,22 @@ bool BHV_ConvoyPD::setParam(string param, string val)
     ki_hdg = stod(val);
     return true;
   }
+  else if (param == "compact_wire")
+  {
+    return setBooleanOnString(m_compact_wire, val);
+  }
+  else if (param == "wire_names")
+  {
+    return m_wire_names.setNames(val);
+  }
+  else if (param == "ext_assign")
+  {
+    return setBooleanOnString(m_ext_assign, val);
+  }
   else if (param == "updates")
   {
-    m_update_var = val;
+    m_updates_var_k = val;
+    addInfoVars(m_updates_var_k);
     return true;
   }
 
@@ -405,9 +389,8 @@ void BHV_ConvoyPD::updateCapturePoint()
   if (!m_is_leader && m_cpq.m_points.size() > 0)
   {
     XYPoint np = m_cpq.m_points.front().p;
-    double dist = hypot(np.get_vy() - m_osy, np.get_vx() - m_osx);
     // Captured
-    if (dist < 3)
+    if (m_pd_policy.pointCaptured(m_osx, m_osy, np.get_vx(), np.get_vy()))
     {
       ConvoyPoint prv_cp = m_cpq.dequeue();
       // dbg_print( "Points in queue:\n %s\n", m_cpq.repr("\n").c_str());
@@ -430,7 +413,10 @@ void BHV_ConvoyPD::propagatePoint(ConvoyPoint prv_cp)
   node_message.setSourceNode(m_us_name);
   node_message.setDestNode(m_follower);
   node_message.setVarName(m_lead_point_k);
-  node_message.setStringVal(prv_cp.repr());
+  if (m_compact_wire)
+    node_message.setStringVal(prv_cp.wire_repr());
+  else
+    node_message.setStringVal(prv_cp.repr());
   postRepeatableMessage("NODE_MESSAGE_LOCAL", node_message.getSpec());
 }
 
@@ -451,6 +437,11 @@ void BHV_ConvoyPD::updateCheckForContact()
 {
   m_task_state = tolower(getBufferStringVal(m_task_state_k));
 
+  // With an external assignment, task auction wins do not set
+  // who we follow
+  if (m_ext_assign)
+    return;
+
   // If we won the convoy bid, we know who we are trailing
   size_t idx1 = m_task_state.find("id=follow_");
   size_t idx2 = m_task_state.find("bidwon");
@@ -478,7 +469,10 @@ void BHV_ConvoyPD::updateCheckForContact()
 void BHV_ConvoyPD::updateLeadPoint()
 {
   std::string msg = getBufferStringVal(m_lead_point_k);
-  m_cpq.add_point(ConvoyPoint(msg));
+  ConvoyPoint point;
+  if(!point.unpack(msg))
+    return;
+  m_cpq.add_point(point);
   XYPoint cp = m_cpq.m_points.back().p;
   cp.set_vertex_color(m_color);
 
@@ -494,6 +488,9 @@ void BHV_ConvoyPD::updateFtoLMapping()
   addInfoVars("AGENT_INFO_" + toupper(agent_a));
   addInfoVars("AGENT_INFO_" + toupper(agent_b));
 
+  if (m_ext_assign)
+    return;
+
   m_follower_to_leader_mapping[agent_a] = agent_b;
   m_has_broadcast_leadership = false;
 
@@ -541,12 +538,12 @@ void BHV_ConvoyPD::handleUpdateVar()
     if (param == m_des_spd_k)
     {
       value = biteString(segment, '=');
-      m_desired_speed = stod(value);
+      m_pd_policy.setDesiredSpd(stod(value));
     }
     else if (param == m_point_update_dist_k)
     {
       value = biteString(segment, '=');
-      m_point_update_distance = stod(value);
+      m_pd_policy.setPointUpdateDist(stod(value));
     }
   }
 }
@@ -572,6 +569,7 @@ void BHV_ConvoyPD::postOrdering()
 
   // When we have a mapping of all known agents, we generate our ordering, and share it to all other nodes
 
+  m_leader_to_follower_mapping.clear();
   std::map<string, string>::iterator it = m_follower_to_leader_mapping.begin();
 
   for (; it != m_follower_to_leader_mapping.end(); ++it)
@@ -622,12 +620,17 @@ void BHV_ConvoyPD::postOrdering()
     m_is_midship = true;
   }
 
-  NodeMessage node_message;
-  node_message.setSourceNode(m_us_name);
-  node_message.setDestNode("all");
-  node_message.setVarName(m_ext_ordering_k);
-  node_message.setStringVal(m_ordering_str);
-  postRepeatableMessage("NODE_MESSAGE_LOCAL", node_message.getSpec());
+  // An external assignment is sent to every vehicle directly, so
+  // our copy of it is not re-shared
+  if (!m_ext_assign)
+  {
+    NodeMessage node_message;
+    node_message.setSourceNode(m_us_name);
+    node_message.setDestNode("all");
+    node_message.setVarName(m_ext_ordering_k);
+    node_message.setStringVal(m_ordering_str);
+    postRepeatableMessage("NODE_MESSAGE_LOCAL", node_message.getSpec());
+  }
 
   dbg_print("ordering: %s\n", m_ordering_str.c_str());
   postRepeatableMessage("ORDERING", m_ordering_str);
@@ -635,19 +638,8 @@ void BHV_ConvoyPD::postOrdering()
 
 void BHV_ConvoyPD::seedPoints()
 {
-  if ((abs(m_osx - m_osx_prv) > m_eps) &&
-      (abs(m_osy - m_osy_prv) > m_eps))
-  {
-    double dx = m_osx - m_osx_prv;
-    double dy = m_osy - m_osy_prv;
-    double dh = m_osh - m_osh_prv;
-
-    m_osx_prv = m_osx;
-    m_osy_prv = m_osy;
-    m_osh_prv = m_osh;
-    m_interval_odo += sqrt(dy * dy + dx * dx);
-  }
-  if (m_interval_odo >= m_point_update_distance)
+  // Odometry since the last seeded point is kept by the policy
+  if (m_pd_policy.seedPoint(m_osx, m_osy))
   {
 
     XYPoint cp(m_osx, m_osy);
@@ -670,14 +662,16 @@ void BHV_ConvoyPD::seedPoints()
     // m_cpq.add_point(cpp);
     ConvoyPoint cp_alt(cpp.repr()); // temporary
 
-    m_interval_odo = 0;
     double dist_between = m_cpq.get_dist_to_target();
 
     NodeMessage node_message;
     node_message.setSourceNode(m_us_name);
     node_message.setDestNode(m_follower);
     node_message.setVarName(m_lead_point_k);
-    node_message.setStringVal(cpp.repr());
+    if (m_compact_wire)
+      node_message.setStringVal(cpp.wire_repr());
+    else
+      node_message.setStringVal(cpp.repr());
     postRepeatableMessage("NODE_MESSAGE_LOCAL", node_message.getSpec());
     m_posted_points++;
   }
@@ -715,35 +709,90 @@ void BHV_ConvoyPD::scheduleRepost(std::string field)
   m_next_redundant_update[field] = m_latest_buffer_time + m_redudant_update_interval;
 }
 
-void BHV_ConvoyPD::clamp(double &value, double min, double max) {
-  if(value < min) {
-    value = min;
+//---------------------------------------------------------------
+// Procedure: updateExtOrdering()
+//   Example: EXT_ORDERING = abe,cal,ben,deb
+//      Note: Leader first. Without ext_assign it is a peer's view of
+//            the auction result, and its pairs are merged into ours
+//            only if it is longer than our own ordering. With
+//            ext_assign it comes from uFldConvoyAssign and a well-
+//            formed ordering replaces the whole follower-to-leader
+//            mapping, even when it is shorter (a vehicle dropped out).
+
+void BHV_ConvoyPD::updateExtOrdering()
+{
+  if (!m_ext_assign)
+  {
+    mergeExtOrdering();
+    return;
   }
-  if(value > max) {
-    value = max;
+
+  std::string ext_ordering = tolower(getBufferStringVal(m_ext_ordering_k));
+  vector<string> ext_order_vector = parseString(ext_ordering, ',');
+
+  std::map<string, string> mapping;
+  for (unsigned int i = 0; i < ext_order_vector.size(); i++)
+  {
+    string name = stripBlankEnds(ext_order_vector[i]);
+    if ((name == "") || mapping.count(name))
+    {
+      dbg_print("Faulty ordering: %s\n", ext_ordering.c_str());
+      return;
+    }
+    mapping[name] = (i == 0) ? "*" : stripBlankEnds(ext_order_vector[i - 1]);
+  }
+  if (mapping.empty())
+    return;
+
+  dbg_print("Our ordering: %s - their ordering %s\n", m_ordering_str.c_str(), ext_ordering.c_str());
+  m_follower_to_leader_mapping = mapping;
+
+  std::map<string, string>::iterator it = mapping.begin();
+  for (; it != mapping.end(); ++it)
+    addInfoVars("AGENT_INFO_" + toupper(it->first));
+
+  // Take our contact from the assignment. Points queued from a
+  // previous contact lead somewhere else, so drop them.
+  string us = tolower(m_us_name);
+  string contact = "";
+  if (mapping.count(us) && (mapping[us] != "*"))
+    contact = mapping[us];
+  if (contact != m_contact)
+  {
+    m_contact = contact;
+    m_cpq.clear();
+    dbg_print("Assigned contact: %s\n", m_contact.c_str());
   }
+  postOrdering();
 }
 
-void BHV_ConvoyPD::updateExtOrdering() {
+//---------------------------------------------------------------
+// Procedure: mergeExtOrdering()
+//      Note: Pairs already in our mapping but not in the peer's
+//            ordering are kept. A blank name ends the merge.
+
+void BHV_ConvoyPD::mergeExtOrdering()
+{
   std::string ext_ordering = getBufferStringVal(m_ext_ordering_k);
-  
-  if(ext_ordering.size() > m_ordering_str.size()) {
-    dbg_print("Our ordering: %s - their ordering %s\n", m_ordering_str.c_str(), ext_ordering.c_str());
-    vector<string> ext_order_vector = parseString(ext_ordering,',');
-    for(int i = 0; i < ext_order_vector.size()-1; i++) {
-      if(ext_order_vector[i] != "" && ext_order_vector[i+1] != "") {
-        string l = ext_order_vector[i];
-        string f = ext_order_vector[i+1];
-        m_follower_to_leader_mapping[f] = l;
-      } else {
-        
-        dbg_print("Faulty ordering\n");
-        break;
+  if (ext_ordering.size() <= m_ordering_str.size())
+    return;
 
-      }
+  dbg_print("Our ordering: %s - their ordering %s\n", m_ordering_str.c_str(), ext_ordering.c_str());
+  vector<string> ext_order_vector = parseString(ext_ordering, ',');
+  for (unsigned int i = 0; i + 1 < ext_order_vector.size(); i++)
+  {
+    string l = ext_order_vector[i];
+    string f = ext_order_vector[i + 1];
+    if ((l == "") || (f == ""))
+    {
+      dbg_print("Faulty ordering\n");
+      break;
     }
-    dbg_print("Corrected ordering\n");
+    m_follower_to_leader_mapping[f] = l;
+    addInfoVars("AGENT_INFO_" + toupper(l));
+    addInfoVars("AGENT_INFO_" + toupper(f));
   }
+  dbg_print("Corrected ordering\n");
 }
 
 //---------------------------------------------------------------
@@ -767,7 +816,10 @@ void BHV_ConvoyPD::postAgentInfo()
   node_message.setDestNode("all");
   node_message.setVarName(string("AGENT_INFO_") + toupper(m_us_name));
 
-  node_message.setStringVal(m_self_agent_info.repr());
+  if (m_compact_wire)
+    node_message.setStringVal(m_self_agent_info.wireRepr(&m_wire_names));
+  else
+    node_message.setStringVal(m_self_agent_info.repr());
   postRepeatableMessage("NODE_MESSAGE_LOCAL", node_message.getSpec());
 }
 
@@ -775,7 +827,12 @@ void BHV_ConvoyPD::updateAgentInfo(std::string name)
 {
   string msg = getBufferStringVal("AGENT_INFO_" + toupper(name));
 
-  m_contacts_lookup[name] = AgentInfo(msg);
+  AgentInfo info(msg, &m_wire_names);
+  // The sender's name is in the var name if our wire table
+  // could not resolve it
+  if(info.name == "")
+    info.name = name;
+  m_contacts_lookup[name] = info;
   auto it = m_contacts_lookup.begin();
   dbg_print("Ownship: %s\n", m_us_name.c_str());
   for (; it != m_contacts_lookup.end(); ++it)
@@ -848,7 +905,7 @@ IvPFunction *BHV_ConvoyPD::onRunState()
   {
     seedPoints();
     ZAIC_PEAK spd_zaic(m_domain, "speed");
-    spd_zaic.setSummit(m_desired_speed);
+    spd_zaic.setSummit(m_pd_policy.getDesiredSpd());
     spd_zaic.setPeakWidth(0.25);
     spd_zaic.setBaseWidth(0.5);
     spd_zaic.setSummitDelta(0.5);
@@ -875,13 +932,14 @@ IvPFunction *BHV_ConvoyPD::onRunState()
 
     //If our distance to the target is greater than our ideal follow range, we'll speed up, otherwise we'll slow down
     //If our current speed is less than the leaders speed at this point, we'll speed up, otherwise we'll slow down
-    double leader_speed = m_cpq.m_points.front().leader_speed;
-    double dist_err = dist_to_target - m_ideal_follow_range;
-    double speed_err = leader_speed - m_speed;
-    double set_spd = m_desired_speed + kp_spd*(dist_err) + kd_spd*(speed_err);
-    clamp(set_spd,0,2);
-    dbg_print("desired speed: %0.2f vs. set speed: %0.2f\n", m_desired_speed, set_spd);
-    dbg_print("dist: %0.2f vs. ifr: %0.2f\n", dist_to_target, m_ideal_follow_range);
+    double leader_speed = 0;
+    if (m_cpq.m_points.size() > 0)
+      leader_speed = m_cpq.m_points.front().leader_speed;
+    double ideal_follow_range = m_pd_policy.getIdealFollowRng();
+    double dist_err = dist_to_target - ideal_follow_range;
+    double set_spd = m_pd_policy.getSpdFromPolicy(dist_to_target, leader_speed, m_speed);
+    dbg_print("desired speed: %0.2f vs. set speed: %0.2f\n", m_pd_policy.getDesiredSpd(), set_spd);
+    dbg_print("dist: %0.2f vs. ifr: %0.2f\n", dist_to_target, ideal_follow_range);
     dbg_print("ls: %0.2f vs. mspd: %0.2f\n", leader_speed, m_speed);
     
     m_prev_err_point.set_active(false);
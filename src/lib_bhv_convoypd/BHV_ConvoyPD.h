@@ -13,6 +13,8 @@
 #include <list>
 #include <map>
 #include "ConvoyPointQueue.h"
+#include "ConvoyWire.h"
+#include "ConvoyPDPolicy.h"
 #include <cstdarg> //va_list, va_start, va_end
 
 class AgentInfo
@@ -48,7 +50,12 @@ public:
     color = "yellow";
   }
 
-  AgentInfo(std::string strrep) {
+  AgentInfo(std::string strrep, const ConvoyWireNames* names=0) {
+    if(isConvoyWire(strrep)) {
+      *this = AgentInfo();
+      unpackWire(strrep, names);
+      return;
+    }
     std::vector<std::string> fields;
     if(strrep.front() == '{' && strrep.back() == '}') {
       strrep.pop_back();
@@ -140,6 +147,49 @@ public:
     ;
     return result;
   }
+
+  // Compact wire form, same precision as repr()
+  std::string wireRepr(const ConvoyWireNames* names=0) {
+    ConvoyWireWriter writer(CWIRE_AGENT_INFO, names);
+    writer.putName(name);
+    writer.putFixed(x, 0.01);
+    writer.putFixed(x_dot, 0.01);
+    writer.putFixed(y, 0.01);
+    writer.putFixed(y_dot, 0.01);
+    writer.putFixed(z, 0.01);
+    writer.putFixed(z_dot, 0.01);
+    writer.putFixed(h, 0.01);
+    writer.putFixed(h_dot, 0.01);
+    writer.putFixed(u, 0.01);
+    writer.putFixed(v, 0.01);
+    writer.putFixed(utc, 0.001);
+    writer.putString(color);
+    if(!writer.ok())
+      return repr();
+    return writer.getSpec();
+  }
+
+  void unpackWire(std::string strrep, const ConvoyWireNames* names) {
+    ConvoyWireReader reader(strrep, names);
+    if(reader.getType() != CWIRE_AGENT_INFO)
+      return;
+    AgentInfo info;
+    info.name  = reader.getName();
+    info.x     = reader.getFixed(0.01);
+    info.x_dot = reader.getFixed(0.01);
+    info.y     = reader.getFixed(0.01);
+    info.y_dot = reader.getFixed(0.01);
+    info.z     = reader.getFixed(0.01);
+    info.z_dot = reader.getFixed(0.01);
+    info.h     = reader.getFixed(0.01);
+    info.h_dot = reader.getFixed(0.01);
+    info.u     = reader.getFixed(0.01);
+    info.v     = reader.getFixed(0.01);
+    info.utc   = reader.getFixed(0.001);
+    info.color = reader.getString();
+    if(reader.ok())
+      *this = info;
+  }
 };
 
 class BHV_ConvoyPD : public IvPBehavior
@@ -169,6 +219,7 @@ protected: // Local Utility functions
   void propagatePoint(ConvoyPoint prv_cp);
   void updateIsLeader();
   void updateExtOrdering();
+  void mergeExtOrdering();
   void updateContactList();
   void updateCheckForContact();
   void updateLeadPoint();
@@ -176,7 +227,6 @@ protected: // Local Utility functions
   void updateContactInfo();
   void handleUpdateVar();
   void handleNodeReport();
-  void clamp(double &value, double min, double max);
 
   void postLeadership();
   void postOrdering();
@@ -195,15 +245,13 @@ protected: // Configuration parameters
   // Parameters
   bool m_is_leader, m_is_midship, m_is_tail;
 
-  double m_desired_speed;
-  double m_point_update_distance;
-  double m_ideal_follow_range;
+  // Desired speed, follow range, point spacing and PD gains
+  ConvoyPDPolicy m_pd_policy;
   double m_max_tail_length;
 
   double m_redudant_update_interval;
   std::map<std::string, double> m_next_redundant_update;
 
-  double kp_spd, kd_spd, ki_spd;
   double kp_hdg, kd_hdg, ki_hdg;
 
   std::string m_des_spd_k;
@@ -211,7 +259,7 @@ protected: // Configuration parameters
 
 protected: // State variables
   double m_osx, m_osy, m_osh;
-  double m_osx_prv, m_osy_prv, m_osh_prv;
+  double m_osh_prv;
   double m_osx_tprv, m_osy_tprv, m_osh_tprv;
   double m_speed, m_osh_dot;
 
@@ -233,8 +281,6 @@ protected: // State variables
   FILE *m_cfile;
   std::string m_debug_fname;
 
-  double m_interval_odo;
-  double m_eps;
   unsigned long int m_posted_points;
   std::map<std::string, std::string> m_follower_to_leader_mapping;
   std::map<std::string, std::string> m_leader_to_follower_mapping;
@@ -263,6 +309,14 @@ protected: // State variables
   std::string m_whotowho_k;
   std::string m_updates_var_k;
   std::string m_updates_buffer;
+
+  // Optional compact wire format for AGENT_INFO and lead points
+  bool m_compact_wire;
+  ConvoyWireNames m_wire_names;
+
+  // Ordering assigned externally (uFldConvoyAssign) replaces the
+  // task auction as the source of who follows whom
+  bool m_ext_assign;
   XYPoint m_prev_err_point;
   double m_latest_buffer_time;
 };
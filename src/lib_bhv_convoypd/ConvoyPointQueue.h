@@ -4,6 +4,7 @@
 #include <map> 
 #include <string>
 #include "IvPBehavior.h"
+#include "ConvoyWire.h"
 
 class ConvoyPoint {
   public: 
@@ -70,7 +71,86 @@ class ConvoyPoint {
     return "{"+p.get_spec()+"}|"+meta_str;
   }
 
-  void unpack(std::string cp_str) {
+  // Compact wire form. Position at 0.01m, seed time at 1ms, and
+  // the leader speed/heading/rate metadata at 0.01. Any other
+  // metadata is carried as key/value strings. Of the visual
+  // properties only the label, id and vertex size are carried.
+  std::string wire_repr() {
+    ConvoyWireWriter writer(CWIRE_LEAD_POINT);
+    writer.putFixed(p.get_vx(), 0.01);
+    writer.putFixed(p.get_vy(), 0.01);
+    writer.putString(p.get_label());
+    writer.putString(p.get_id());
+    writer.putFixed(p.get_vertex_size(), 0.1);
+    writer.putFixed(seed_time, 0.001);
+    writer.putFixed(leader_speed, 0.01);
+    writer.putFixed(leader_heading, 0.01);
+    writer.putFixed(leader_heading_rate, 0.01);
+
+    std::map<std::string, std::string> extra_meta;
+    std::map<std::string, std::string>::iterator it;
+    for(it = meta.begin(); it != meta.end(); ++it) {
+      if((it->first != "seed_time") && (it->first != "leader_speed") &&
+         (it->first != "leader_heading") &&
+         (it->first != "leader_heading_rate"))
+        extra_meta[it->first] = it->second;
+    }
+    writer.putUInt(extra_meta.size());
+    for(it = extra_meta.begin(); it != extra_meta.end(); ++it) {
+      writer.putString(it->first);
+      writer.putString(it->second);
+    }
+
+    if(!writer.ok())
+      return repr();
+    return writer.getSpec();
+  }
+
+  // Decoded into locals first, so a truncated or corrupt message
+  // leaves the point untouched and returns false.
+  bool unpack_wire(std::string cp_str) {
+    ConvoyWireReader reader(cp_str);
+    if(!reader.ok() || (reader.getType() != CWIRE_LEAD_POINT))
+      return false;
+    double x = reader.getFixed(0.01);
+    double y = reader.getFixed(0.01);
+    std::string label = reader.getString();
+    std::string id = reader.getString();
+    double vsize = reader.getFixed(0.1);
+    double st  = reader.getFixed(0.001);
+    double spd = reader.getFixed(0.01);
+    double lh  = reader.getFixed(0.01);
+    double lhr = reader.getFixed(0.01);
+
+    std::vector<std::pair<std::string, std::string> > extra_meta;
+    unsigned long long extra = reader.getUInt();
+    for(unsigned long long i = 0; reader.ok() && (i < extra); i++) {
+      std::string k = reader.getString();
+      std::string v = reader.getString();
+      extra_meta.push_back(std::make_pair(k, v));
+    }
+    if(!reader.ok())
+      return false;
+
+    p.set_vx(x);
+    p.set_vy(y);
+    p.set_label(label);
+    p.set_id(id);
+    p.set_vertex_size(vsize);
+    set_st(st);
+    set_spd(spd);
+    set_lh(lh);
+    set_lhr(lhr);
+    for(unsigned int i = 0; i < extra_meta.size(); i++)
+      add_meta(extra_meta[i].first, extra_meta[i].second);
+    return true;
+  }
+
+  bool unpack(std::string cp_str) {
+    if(isConvoyWire(cp_str))
+      return unpack_wire(cp_str);
+    if(cp_str.find('|') == std::string::npos)
+      return false;
     std::vector<string> cp_partitioned = parseString(cp_str,"|");
     std::string xyp_spec = cp_partitioned[0]+",";
     std::string cp_meta = cp_partitioned[1];
@@ -136,6 +216,7 @@ class ConvoyPoint {
         leader_speed = stod(v);
       }
     }
+    return true;
   }
 
 
@@ -177,6 +258,10 @@ class ConvoyPointQueue {
       m_points.push_back(cp);
     }
 
+    void clear() {
+      m_points.clear();
+    }
+
     ConvoyPoint dequeue() {
       ConvoyPoint cp = m_points.front();
       m_points.pop_front();
@@ -42,28 +42,16 @@ BHV_ConvoyV21X::BHV_ConvoyV21X(IvPDomain gdomain) : IvPContactBehavior(gdomain)
   // ====================================================
   // Initialize State variables
   // ====================================================
-  m_wptx = 0;
-  m_wpty = 0;
   m_wpt_set = false;
-  m_set_speed = 0;
-
-  m_cnv_avg_2sec = 0;
-  m_cnv_avg_5sec = 0;
-
-  m_convoy_range = 1;
 
   m_post_recap_verbose = false;
 
+  m_compact_wire = false;
+
   // ====================================================
   // Initialize State variables (Metrics)
   // ====================================================
-  m_tail_range = -1;
-  m_tail_angle = -1;
-  m_marker_bng = -1;
-  m_alignment = -1;
-
   m_reached_markers = 0;
-  m_dropped_markers = 0;
 
   m_recap_index = 0;
   m_stat_recap_index = 0;
@@ -71,11 +59,7 @@ BHV_ConvoyV21X::BHV_ConvoyV21X(IvPDomain gdomain) : IvPContactBehavior(gdomain)
   // ====================================================
   // Initialize Config variables
   // ====================================================
-  m_capture_radius = 5; // meters
-  m_slip_radius = 20;   // meters
-  m_compression = 0;    // [0,1]
   m_patience = 50;      // [1,99]
-  m_aft_patience = false;
 
   m_hint_marker_color = "dodger_blue";
   m_hint_marker_label_color = "off";
@@ -99,31 +83,13 @@ bool BHV_ConvoyV21X::setParam(string param, string param_val)
   if (IvPContactBehavior::setParam(param, param_val))
     return (true);
 
+  // Radii, tail, speed policy, compression and aft_patience
+  if (m_follower.setParam(param, param_val))
+    return (true);
+
   bool handled = false;
-  if ((param == "nm_radius") || (param == "slip_radius"))
-    handled = setNonNegDoubleOnString(m_slip_radius, param_val);
-  else if ((param == "radius") || (param == "capture_radius"))
-    handled = setNonNegDoubleOnString(m_capture_radius, param_val);
-
-  else if (param == "tail_length_max")
-    handled = m_marker_tail.setMaxTailLength(param_val);
-  else if (param == "inter_mark_range")
-    handled = m_marker_tail.setInterMarkRange(param_val);
-
-  else if ((param == "full_stop_convoy_range") ||
-           (param == "slower_convoy_range") ||
-           (param == "ideal_convoy_range") ||
-           (param == "faster_convoy_range") ||
-           (param == "full_lag_convoy_range") ||
-           (param == "lag_speed_delta"))
-    handled = m_spd_policy_base.setParam(param, param_val);
-
-  else if (param == "visual_hints")
+  if (param == "visual_hints")
     return (handleParamVisualHints(param_val));
-  else if (param == "compression")
-    return (handleParamCompression(param_val));
-  else if (param == "aft_patience")
-    return (setBooleanOnString(m_aft_patience, param_val));
   else if (param == "holding_policy")
     return (handleConfigHoldingPolicy(param_val));
   else if (param == "is_leader")
@@ -140,6 +106,11 @@ bool BHV_ConvoyV21X::setParam(string param, string param_val)
   else if (param == "post_recap_verbose")
     handled = setBooleanOnString(m_post_recap_verbose, param_val);
 
+  else if (param == "compact_wire")
+    handled = setBooleanOnString(m_compact_wire, param_val);
+  else if (param == "wire_names")
+    handled = m_wire_names.setNames(param_val);
+
   else if (param == "active_convoying")
     handled = setBooleanOnString(m_active_convoying, param_val);
 
@@ -196,17 +167,7 @@ bool BHV_ConvoyV21X::handleConfigHoldingPolicy(string policy)
 
 string BHV_ConvoyV21X::checkParamCollective()
 {
-  string status = m_spd_policy_base.status();
-  if (status != "ok")
-    return ("base spd_policy: " + status);
-
-  if (m_slip_radius < m_capture_radius)
-    return ("slip_radius smaller than capture_radius");
-
-  if (m_marker_tail.getInterMarkRange() >= m_marker_tail.getMaxTailLength())
-    return ("tail_length_max should be greater than inter_mark_range");
-
-  return ("");
+  return (m_follower.checkParams());
 }
 
 //-----------------------------------------------------------
@@ -217,11 +178,9 @@ string BHV_ConvoyV21X::checkParamCollective()
 void BHV_ConvoyV21X::onSetParamComplete()
 {
   postEventMessage("onSetParamComplete");
-  // Prevailing speed policy is initially a copy of base policy
-  m_spd_policy = m_spd_policy_base;
-  // Then the current compression is applied
-  m_spd_policy.compress(m_compression);
-  m_spd_policy.setVName(tolower(m_us_name));
+  // Prevailing speed policy is a copy of the base policy, with
+  // the current compression applied
+  m_follower.onParamsComplete(m_us_name);
 }
 
 //-----------------------------------------------------------
@@ -238,9 +197,10 @@ IvPFunction *BHV_ConvoyV21X::onRunState()
 
   if (!updatePlatformInfo())
     return (0);
-  m_marker_tail.setPosCN(m_cnx, m_cny);
+  m_follower.setOwnship(m_osx, m_osy, m_osh);
+  m_follower.setContact(m_cnx, m_cny, m_cnh, m_cnv);
 
-  string spd_policy_status = m_spd_policy.status();
+  string spd_policy_status = m_follower.getSpdPolicy().status();
   if (spd_policy_status != "ok")
   {
     postWMessage("spd_policy error: " + spd_policy_status);
@@ -262,18 +222,15 @@ IvPFunction *BHV_ConvoyV21X::onRunState()
 // Sanity check. Should never have an empty marker tail,
 // unless inter marker gap bigger than max tail length.
 #if 0
-      if(m_marker_tail.empty()) {
+      if(m_follower.getMarkerTail().empty()) {
         postWMessage("Empty Marker Tail");
         return(0);
       }
 #endif
 
-  handleNewContactSpd(m_cnv);
-  m_set_speed = m_spd_policy.getSpdFromPolicy(m_cnv_avg_2sec,
-                                              m_contact_range,
-                                              m_convoy_range);
-
-  updateMetrics();
+  m_follower.handleNewContactSpd(m_cnv, getBufferCurrTime());
+  m_follower.updateSetSpeed();
+  m_follower.updateMetrics();
   postFlags(m_convoy_flags);
   postRecap(tail_modified);
   postSpdPolicy();
@@ -281,11 +238,8 @@ IvPFunction *BHV_ConvoyV21X::onRunState()
   // Generate the IvP function
   setCurrentMarker();
 
-  if (m_aft_patience)
-  {
-    if (!m_marker_tail.aftMarkerClosest(m_osx, m_osy))
-      return (0);
-  }
+  if (m_follower.holding())
+    return (0);
 
   IvPFunction *ipf = buildOF();
 
@@ -312,15 +266,16 @@ bool BHV_ConvoyV21X::handleMarkerUpdates()
 
   // If marker_tail is empty, then any newly added marker will be a
   // *new* aft marker.
-  if (m_marker_tail.empty())
+  MarkerTail &marker_tail = m_follower.getMarkerTail();
+  if (marker_tail.empty())
     new_aft_marker = true;
 
-  bool marker_added = m_marker_tail.handleNewContactPos(m_cnx, m_cny, m_cnh);
+  bool marker_added = marker_tail.handleNewContactPos(m_cnx, m_cny, m_cnh);
   // cout << "passive marker_added:" << boolToString(marker_added) << endl;;
 
   if (m_active_convoying)
   {
-    m_marker_tail.setPosCN(m_cnx, m_cny);
+    marker_tail.setPosCN(m_cnx, m_cny);
     bool ok;
     vector<string> msgs = getBufferStringVector("HIT_MARKER", ok);
     // cout << "HM_SIZE:" << msgs.size() << endl;
@@ -330,7 +285,7 @@ bool BHV_ConvoyV21X::handleMarkerUpdates()
     for (unsigned int i = 0; i < msgs.size(); i++)
     {
       // cout << "HIT_MARKER=" << msgs[i] << endl;
-      ConvoyMarker new_marker = string2ConvoyMarker(msgs[i]);
+      ConvoyMarker new_marker = string2ConvoyMarker(msgs[i], &m_wire_names);
       if (!new_marker.valid())
         postWMessage("Invalid marker rcvd: " + msgs[i]);
       else
@@ -340,9 +295,9 @@ bool BHV_ConvoyV21X::handleMarkerUpdates()
         if (tolower(new_marker.getVName()) == tolower(m_contact))
         {
           // cout << "Matching Marker    yessir !!!!" << endl;
-          m_marker_tail.handleNewActiveMarker(new_marker);
+          marker_tail.handleNewActiveMarker(new_marker);
 
-          list<ConvoyMarker> cleared_markers = m_marker_tail.getClearedMarkers();
+          list<ConvoyMarker> cleared_markers = marker_tail.getClearedMarkers();
           list<ConvoyMarker>::iterator p;
           for (p = cleared_markers.begin(); p != cleared_markers.end(); p++)
             eraseMarker(*p);
@@ -357,13 +312,13 @@ bool BHV_ConvoyV21X::handleMarkerUpdates()
 
   if (marker_added)
   {
-    ConvoyMarker marker = m_marker_tail.getLeadMarker();
+    ConvoyMarker marker = marker_tail.getLeadMarker();
     drawMarker(marker);
   }
 
   if (new_aft_marker)
   {
-    ConvoyMarker aft_marker = m_marker_tail.getAftMarker();
+    ConvoyMarker aft_marker = marker_tail.getAftMarker();
     drawMarker(aft_marker, m_hint_marker_size * 2);
   }
 
@@ -376,20 +331,10 @@ bool BHV_ConvoyV21X::handleMarkerUpdates()
 
 void BHV_ConvoyV21X::setCurrentMarker()
 {
-  if (m_marker_tail.size() != 0)
-  {
-    ConvoyMarker marker = m_marker_tail.getAftMarker();
-    m_wptx = marker.getX();
-    m_wpty = marker.getY();
-  }
-  else
-  {
-    m_wptx = m_cnx;
-    m_wpty = m_cny;
-  }
+  m_follower.setCurrentMarker();
 
-  string msg = "x=" + doubleToStringX(m_wptx, 1);
-  msg += "y=" + doubleToStringX(m_wpty, 1);
+  string msg = "x=" + doubleToStringX(m_follower.getWptX(), 1);
+  msg += "y=" + doubleToStringX(m_follower.getWptY(), 1);
   postRepeatableMessage("CONVOY_WPT", msg);
 
   m_wpt_set = true;
@@ -397,88 +342,44 @@ void BHV_ConvoyV21X::setCurrentMarker()
 
 //-----------------------------------------------------------
 // Procedure: checkDropAftMarker()
+//      Note: The three drop cases are in ConvoyFollower. Here the
+//            dropped marker is announced and erased.
 
 bool BHV_ConvoyV21X::checkDropAftMarker()
 {
-  if (m_marker_tail.empty())
+  const MarkerTail &marker_tail = m_follower.getMarkerTail();
+  if (marker_tail.empty())
     return (false);
 
-  ConvoyMarker aft_marker = m_marker_tail.getAftMarker();
-
-  double dist = m_marker_tail.distToAftMarker(m_osx, m_osy);
+  postRepeatableMessage("TAIL_SIZE", marker_tail.size());
 
-  bool marker_dropped = false;
+  bool marker_dropped = m_follower.checkDropAftMarker();
 
-  // Case 1: Simplest check is the capture radius
-  postRepeatableMessage("TAIL_SIZE", m_marker_tail.size());
-  if (dist < m_capture_radius)
+  postRepeatableMessage("DROP_DIST", m_follower.getDropDist());
+  if (m_follower.getDropAngle() >= 0)
   {
-    m_marker_tail.dropAftMarker();
-    postRepeatableMessage("DROP_REASON", "one");
-    marker_dropped = true;
-  }
-
-  postRepeatableMessage("DROP_DIST", dist);
-
-  // Case 2: If inside the slip radius, check if ownship crossed line
-  // perpendicular to line from aft marker to near-aft marker.
-  if (!marker_dropped && (dist < m_slip_radius))
-  {
-    // Calculate the next point on the marker list.
-    //
-    //               wpt             nextpt         |
-    //                 o----------------o           |
-    //                  \ angle                     |
-    //                   \                          |
-    //                    \                         |
-    //                     o--->                    |
-    //                  ownship                     |
-
-    // If only one marker, next "marker" will be contact position
-    double next_x = m_cnx;
-    double next_y = m_cny;
-
-    if (m_marker_tail.size() > 1)
-    {
-      ConvoyMarker marker = m_marker_tail.getNearAftMarker();
-      double next_x = marker.getX();
-      double next_y = marker.getY();
-    }
-    double angle = angleFromThreePoints(m_wptx, m_wpty, m_osx, m_osy,
-                                        next_x, next_y);
-
-    string amsg = "nx=" + doubleToStringX(next_x, 1);
-    amsg += "ny=" + doubleToStringX(next_y, 1);
-    amsg += "ang=" + doubleToStringX(angle, 1);
+    string amsg = "nx=" + doubleToStringX(m_follower.getDropNextX(), 1);
+    amsg += "ny=" + doubleToStringX(m_follower.getDropNextY(), 1);
+    amsg += "ang=" + doubleToStringX(m_follower.getDropAngle(), 1);
     postRepeatableMessage("DROP_ANG", amsg);
-    if (angle < 90)
-    {
-      m_marker_tail.dropAftMarker();
-      postRepeatableMessage("DROP_REASON", "two");
-      marker_dropped = true;
-    }
-  }
-
-  // Case 3: If aft marker was not captured, check if the aft marker
-  // should be dropped based on exceeding the max tail length.
-  if (!marker_dropped)
-  {
-    string msg;
-    marker_dropped = m_marker_tail.checkDropAftMarker(msg);
-    if (msg != "")
-      postRepeatableMessage("DROP_REASON", msg);
   }
+  if (m_follower.getDropReason() != "")
+    postRepeatableMessage("DROP_REASON", m_follower.getDropReason());
 
-  // Last step: If marker was dropped, count it and erase it.
+  // Last step: If marker was dropped, announce it and erase it.
   if (marker_dropped)
   {
     postRepeatableMessage("DROP_REASON", "three");
 
+    ConvoyMarker aft_marker = m_follower.getDroppedMarker();
     aft_marker.setUTC(getBufferCurrTime());
     aft_marker.setVName(m_us_name);
-    string msg = aft_marker.getSpec();
+    string msg;
+    if (m_compact_wire)
+      msg = aft_marker.getWireSpec("", &m_wire_names);
+    else
+      msg = aft_marker.getSpec();
     postXMessage("HIT_MARKER", msg);
-    m_dropped_markers++;
     m_wpt_set = false;
     eraseMarker(aft_marker);
   }
@@ -486,92 +387,6 @@ bool BHV_ConvoyV21X::checkDropAftMarker()
   return (marker_dropped);
 }
 
-//-----------------------------------------------------------
-// Procedure: handleNewContactSpd()
-
-void BHV_ConvoyV21X::handleNewContactSpd(double cnv)
-{
-  double curr_time = getBufferCurrTime();
-  m_cn_spd_value.push_front(cnv);
-  m_cn_spd_tstamp.push_front(curr_time);
-
-  // Part 1A: Ensure behavior spd queue is no older than 5 secs.
-  bool done = false;
-  while (!done && !m_cn_spd_tstamp.empty())
-  {
-    if ((curr_time - m_cn_spd_tstamp.back()) > 5)
-    {
-      m_cn_spd_value.pop_back();
-      m_cn_spd_tstamp.pop_back();
-    }
-    else
-      done = true;
-  }
-
-  // Part 1B: Get the 5 second average
-  double total_spd = 0;
-  unsigned int cnt = 0;
-  list<double>::iterator p;
-  for (p = m_cn_spd_value.begin(); p != m_cn_spd_value.end(); p++)
-  {
-    double this_spd = *p;
-    total_spd += this_spd;
-    cnt++;
-  }
-  if (cnt > 0)
-    m_cnv_avg_5sec = total_spd / (double)(cnt);
-
-  // Part 2A: Build a copy of the spd queue only over 2 secs
-  list<double> cn_spd_value = m_cn_spd_value;
-  list<double> cn_spd_tstamp = m_cn_spd_tstamp;
-  done = false;
-  while (!done && !cn_spd_tstamp.empty())
-  {
-    if ((curr_time - cn_spd_tstamp.back()) > 2)
-    {
-      cn_spd_value.pop_back();
-      cn_spd_tstamp.pop_back();
-    }
-    else
-      done = true;
-  }
-
-  // Part 2B: Get the 2 second average
-  total_spd = 0;
-  cnt = 0;
-  for (p = cn_spd_value.begin(); p != cn_spd_value.end(); p++)
-  {
-    double this_spd = *p;
-    total_spd += this_spd;
-    cnt++;
-  }
-  if (cnt > 0)
-    m_cnv_avg_2sec = total_spd / (double)(cnt);
-}
-
-//-----------------------------------------------------------
-// Procedure: updateMetrics()
-
-void BHV_ConvoyV21X::updateMetrics()
-{
-  // Part 1: Update direct raw metrics
-  m_tail_range = m_marker_tail.distToAftMarker(m_osx, m_osy);
-  m_tail_angle = m_marker_tail.tailAngle(m_osx, m_osy);
-  m_marker_bng = m_marker_tail.markerBearing(m_osx, m_osy, m_osh);
-  m_alignment = m_tail_angle + m_marker_bng;
-
-  if (m_marker_tail.size() == 0)
-    m_convoy_range = m_contact_range;
-  else
-    m_convoy_range = m_tail_range + m_marker_tail.getMarkerTailLen();
-
-  m_range_delta = m_convoy_range - m_spd_policy.getIdealConvoyRng();
-  if (m_range_delta < 0)
-    m_range_delta *= -1;
-
-  m_track_error = m_marker_tail.getTrackError(m_osx, m_osy);
-}
-
 //-----------------------------------------------------------
 // Procedure: buildOF()
 
@@ -583,34 +398,33 @@ IvPFunction *BHV_ConvoyV21X::buildOF()
   // Part 0: Determine if we are holding and waiting for marker tail
   // to evolve before moving.
   // ======================================================
-  bool holding = false;
-  if (m_aft_patience && !m_marker_tail.aftMarkerClosest(m_osx, m_osy))
-    holding = true;
+  bool holding = m_follower.holding();
 
   // ======================================================
   // Part 1: Build the Speed ZAIC
   // ======================================================
+  double set_speed = m_follower.getSetSpeed();
   if (holding)
-    m_set_speed = 0;
+    set_speed = 0;
 
   ZAIC_SPD spd_zaic(m_domain, "speed");
-  spd_zaic.setMedSpeed(m_set_speed);
+  spd_zaic.setMedSpeed(set_speed);
 
-  string mode = m_spd_policy.getCorrectionMode();
-  if (mode == "close")
+  ConvoyCorrMode mode = m_follower.getSpdPolicy().getCorrModeEnum();
+  if (mode == CMODE_CLOSE)
     spd_zaic.setMinSpdUtil(50);
-  else if (mode == "ideal_close")
+  else if (mode == CMODE_IDEAL_CLOSE)
     spd_zaic.setMinSpdUtil(25);
-  else if (mode == "ideal_far")
+  else if (mode == CMODE_IDEAL_FAR)
     spd_zaic.setMaxSpdUtil(25);
-  else if (mode == "far")
+  else if (mode == CMODE_FAR)
     spd_zaic.setMaxSpdUtil(50);
-  else if (mode == "full_lag")
+  else if (mode == CMODE_FULL_LAG)
     spd_zaic.setMaxSpdUtil(75);
   IvPFunction *spd_ipf = spd_zaic.extractIvPFunction();
   if (!spd_ipf)
   {
-    cout << "bld: 2: returning null IPF" << mode << endl;
+    cout << "bld: 2: returning null IPF" << corrModeToString(mode) << endl;
     postWMessage("Failure on the SPD ZAIC via ZAIC_SPD utility");
     return (0);
   }
@@ -619,7 +433,8 @@ IvPFunction *BHV_ConvoyV21X::buildOF()
   // Part 2: Build the Course ZAIC
   // ======================================================
   // ======================================================
-  double set_hdg = relAng(m_osx, m_osy, m_wptx, m_wpty);
+  double set_hdg = relAng(m_osx, m_osy, m_follower.getWptX(),
+                          m_follower.getWptY());
   if (holding)
   {
     if (m_holding_policy == "zero")
@@ -671,7 +486,7 @@ void BHV_ConvoyV21X::onRunToIdleState()
 void BHV_ConvoyV21X::clearMarkerTail()
 {
   // Part 1: Visuals: Get all markers so each can be erased.
-  list<ConvoyMarker> markers = m_marker_tail.getMarkers();
+  list<ConvoyMarker> markers = m_follower.getMarkerTail().getMarkers();
 
   list<ConvoyMarker>::iterator p;
   for (p = markers.begin(); p != markers.end(); p++)
@@ -681,7 +496,7 @@ void BHV_ConvoyV21X::clearMarkerTail()
   }
 
   // Part 2: Clear the markers from from the marker_tail
-  m_marker_tail.clear();
+  m_follower.getMarkerTail().clear();
 }
 
 //-----------------------------------------------------------
@@ -766,20 +581,6 @@ bool BHV_ConvoyV21X::handleParamVisualHints(string hints)
   return (true);
 }
 
-//-----------------------------------------------------------
-// Procedure: handleParamCompression()
-
-bool BHV_ConvoyV21X::handleParamCompression(string sval)
-{
-  double dval = atof(sval.c_str());
-  if ((dval < 0) || (dval > 1))
-    return (false);
-
-  m_compression = dval;
-
-  return (true);
-}
-
 //-----------------------------------------------------------
 // Procedure: postRecap()
 //      Note: Tail_changed info is passed in to allow non-verbose
@@ -802,11 +603,14 @@ void BHV_ConvoyV21X::postRecap(bool tail_changed)
   ConvoyStatRecap stat_recap;
   stat_recap.setLeader(tolower(m_contact));
   stat_recap.setFollower(tolower(m_us_name));
-  stat_recap.setIdealRng(m_spd_policy.getIdealConvoyRng());
-  stat_recap.setCompression(m_compression);
+  stat_recap.setIdealRng(m_follower.getSpdPolicy().getIdealConvoyRng());
+  stat_recap.setCompression(m_follower.getCompression());
   stat_recap.setIndex(m_stat_recap_index);
 
-  postMessage("CONVOY_STAT_RECAP", stat_recap.getSpec());
+  if (m_compact_wire)
+    postMessage("CONVOY_STAT_RECAP", stat_recap.getWireSpec(&m_wire_names));
+  else
+    postMessage("CONVOY_STAT_RECAP", stat_recap.getSpec());
 
   //========================================================
   // Part 2: Build recap of items likely to change often
@@ -815,32 +619,16 @@ void BHV_ConvoyV21X::postRecap(bool tail_changed)
     return;
 
   ConvoyRecap recap;
+  m_follower.buildRecap(recap);
   recap.setVName(tolower(m_us_name));
-  recap.setConvoyRng(m_convoy_range);
-  recap.setConvoyRngDelta(m_range_delta);
-  recap.setTailRng(m_tail_range);
-  recap.setTailAng(m_tail_angle);
-  recap.setMarkerBng(m_marker_bng);
-  recap.setTrackErr(m_track_error);
-  recap.setAlignment(m_alignment);
-  recap.setSetSpd(m_set_speed);
-  recap.setAvg2(m_cnv_avg_2sec);
-  recap.setAvg5(m_cnv_avg_5sec);
-  recap.setCorrMode(m_spd_policy.getCorrectionMode());
-  recap.setTailCnt(m_marker_tail.size());
   recap.setIndex(m_recap_index);
   recap.setTimeUTC(getBufferCurrTime());
 
-  if (!m_marker_tail.empty())
-  {
-    ConvoyMarker marker = m_marker_tail.getAftMarker();
-    recap.setMarkerX(marker.getX());
-    recap.setMarkerY(marker.getY());
-    recap.setMarkerID(marker.getID());
-  }
-
   m_recap_index++;
-  postMessage("CONVOY_RECAP", recap.getSpec());
+  if (m_compact_wire)
+    postMessage("CONVOY_RECAP", recap.getWireSpec(&m_wire_names));
+  else
+    postMessage("CONVOY_RECAP", recap.getSpec());
 }
 
 //-----------------------------------------------------------
@@ -848,7 +636,11 @@ void BHV_ConvoyV21X::postRecap(bool tail_changed)
 
 void BHV_ConvoyV21X::postSpdPolicy()
 {
-  string str_spd_policy = m_spd_policy.getSpec();
+  string str_spd_policy;
+  if (m_compact_wire)
+    str_spd_policy = m_follower.getSpdPolicy().getWireSpec(&m_wire_names);
+  else
+    str_spd_policy = m_follower.getSpdPolicy().getSpec();
   postMessage("CONVOY_SPD_POLICY", str_spd_policy);
 }
 
@@ -862,25 +654,25 @@ string BHV_ConvoyV21X::expandMacros(string sdata)
   // =======================================================
   sdata = IvPContactBehavior::expandMacros(sdata);
 
-  double ideal_convoy_rng = m_spd_policy.getIdealConvoyRng();
-  string correction_mode = m_spd_policy.getCorrectionMode();
+  double ideal_convoy_rng = m_follower.getSpdPolicy().getIdealConvoyRng();
+  string correction_mode = m_follower.getSpdPolicy().getCorrectionMode();
 
   sdata = macroExpand(sdata, "LEADER", tolower(m_contact));
-  sdata = macroExpand(sdata, "CONVOY_RNG", m_convoy_range);
-  sdata = macroExpand(sdata, "RNG_DELTA", m_range_delta);
+  sdata = macroExpand(sdata, "CONVOY_RNG", m_follower.getConvoyRange());
+  sdata = macroExpand(sdata, "RNG_DELTA", m_follower.getRangeDelta());
   sdata = macroExpand(sdata, "IDEAL_RNG", ideal_convoy_rng);
-  sdata = macroExpand(sdata, "COMP", m_compression);
+  sdata = macroExpand(sdata, "COMP", m_follower.getCompression());
 
-  sdata = macroExpand(sdata, "TAIL_RNG", m_tail_range);
-  sdata = macroExpand(sdata, "TAIL_ANG", m_tail_angle);
-  sdata = macroExpand(sdata, "TRK_ERR", m_track_error);
-  sdata = macroExpand(sdata, "MARKER_BNG", m_marker_bng);
-  sdata = macroExpand(sdata, "ALIGNMENT", m_alignment);
+  sdata = macroExpand(sdata, "TAIL_RNG", m_follower.getTailRange());
+  sdata = macroExpand(sdata, "TAIL_ANG", m_follower.getTailAngle());
+  sdata = macroExpand(sdata, "TRK_ERR", m_follower.getTrackError());
+  sdata = macroExpand(sdata, "MARKER_BNG", m_follower.getMarkerBng());
+  sdata = macroExpand(sdata, "ALIGNMENT", m_follower.getAlignment());
 
-  sdata = macroExpand(sdata, "SET_SPD", m_set_speed);
+  sdata = macroExpand(sdata, "SET_SPD", m_follower.getSetSpeed());
   sdata = macroExpand(sdata, "CMODE", correction_mode);
-  sdata = macroExpand(sdata, "AVG_SPD2", m_cnv_avg_2sec);
-  sdata = macroExpand(sdata, "AVG_SPD5", m_cnv_avg_5sec);
+  sdata = macroExpand(sdata, "AVG_SPD2", m_follower.getAvgSpd2());
+  sdata = macroExpand(sdata, "AVG_SPD5", m_follower.getAvgSpd5());
 
   // marker count / tail size
   // num dropped, num reached
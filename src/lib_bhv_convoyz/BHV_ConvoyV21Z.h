@@ -17,8 +17,8 @@
 #include "VarDataPair.h"
 #include "IvPContactBehavior.h"
 #include "ConvoyMarker.h"
-#include "ConvoySpdPolicy.h"
-#include "MarkerTail.h"
+#include "ConvoyFollower.h"
+#include "ConvoyWire.h"
 
 class IvPDomain;
 class BHV_ConvoyV21X : public IvPContactBehavior {
@@ -41,15 +41,11 @@ protected:
 
   bool   handleConfigHoldingPolicy(std::string);  
   bool   handleParamVisualHints(std::string);  
-  bool   handleParamCompression(std::string);  
-  void   handleNewContactSpd(double);
   
   void   drawMarker(ConvoyMarker, int vertex_size=-1,
 		    std::string color="");
   void   eraseMarker(ConvoyMarker);
 
-  void   updateMetrics();
-
   bool   checkDropAftMarker();
 
   void   setCurrentMarker();
@@ -61,48 +57,21 @@ protected:
   bool   handleMarkerUpdates();
 
 protected: // State variables
-  MarkerTail m_marker_tail;
+  // Marker tail, speed policy and metrics (in lib_convoyz)
+  ConvoyFollower m_follower;
 
-  std::list<double> m_cn_spd_value;
-  std::list<double> m_cn_spd_tstamp;
-  
-  double m_wptx;
-  double m_wpty;
   bool   m_wpt_set;
   bool m_is_leader;
-  
-  double m_set_speed;
-  
-  double m_cnv_avg_2sec;
-  double m_cnv_avg_5sec;
-
-protected: // State variables (metrics)
-  double m_convoy_range;
-  double m_range_delta;
-  double m_tail_range;
-  double m_tail_angle;
-  double m_marker_bng;
-  double m_track_error;
-  double m_alignment; 
 
   unsigned int m_reached_markers;
-  unsigned int m_dropped_markers;
 
   unsigned int m_recap_index;
   unsigned int m_stat_recap_index;
   
 private: // Configuration parameters
-  double m_capture_radius;
-  double m_slip_radius;
-  double m_compression;
-  bool   m_aft_patience;
-
   double m_patience; // [1,99]
 
   std::string m_holding_policy;
-  
-  ConvoySpdPolicy m_spd_policy_base;
-  ConvoySpdPolicy m_spd_policy;
 
   bool m_active_convoying;
   bool m_has_announced_contact;
@@ -115,6 +84,10 @@ private: // Config Visual hints, output
   std::string m_hint_marker_label_color;
   double      m_hint_marker_size;
   bool        m_post_recap_verbose;
+
+private: // Config wire format for convoy telemetry
+  bool            m_compact_wire;
+  ConvoyWireNames m_wire_names;
 };
 
 #define IVP_EXPORT_FUNCTION
@@ -17,6 +17,7 @@
 #include "MBUtils.h"
 #include "MacroUtils.h"
 #include "AngleUtils.h"
+#include "DubinsBidEngine.h"
 
 using namespace std;
 
@@ -25,6 +26,8 @@ using namespace std;
 
 BHV_TaskConvoy2::BHV_TaskConvoy2(IvPDomain domain) : IvPTaskBehavior(domain)
 {
+  m_turn_radius = 3; //meters
+  m_bid_model = "intercept";
 }
 
 
@@ -49,6 +52,25 @@ bool BHV_TaskConvoy2::setParam(string param, string param_val)
   if(IvPTaskBehavior::setParam(param, param_val))
     return(true);
 
+  param = tolower(param);
+  if((param == "turn_radius") && isNumber(param_val)) {
+    m_turn_radius = atof(param_val.c_str());
+    return(true);
+  }
+  else if(param == "bid_model") {
+    param_val = tolower(param_val);
+    if((param_val != "intercept") && (param_val != "heading"))
+      return(false);
+    m_bid_model = param_val;
+    return(true);
+  }
+  else if((param == "join_range") && isNumber(param_val))
+    return(m_intercept.setJoinRange(atof(param_val.c_str())));
+  else if((param == "join_speed") && isNumber(param_val))
+    return(m_intercept.setJoinSpeed(atof(param_val.c_str())));
+  else if((param == "max_join_time") && isNumber(param_val))
+    return(m_intercept.setMaxTime(atof(param_val.c_str())));
+
   return(false);
 }
 
@@ -73,21 +95,39 @@ IvPFunction *BHV_TaskConvoy2::onRunState()
 
 //-----------------------------------------------------------
 // Procedure: getTaskBid()
+//      Note: With bid_model=intercept (default), the bid is the time
+//            in seconds to join the contact on its projected track,
+//            given the turn radius (see InterceptBid).
 
 double BHV_TaskConvoy2::getTaskBid()
 {
-  //Get the angle between ownship and the target
-  double ang_to_target = atan2(m_cny - m_osy, m_cnx - m_osx);
+  m_intercept.updateContact(m_cnx, m_cny, getBufferCurrTime());
+  if(m_bid_model == "heading")
+    return(getHeadingBid());
+
+  DubinsBidEngine& engine = getSharedBidEngine();
+  engine.setPose(m_osx, m_osy, m_osh, m_turn_radius);
 
-  //Identify the angle between our current heading and the target - is between -pi and pi
-  double phi = fmod(m_osh - ang_to_target + M_PI, 2*M_PI);
+  bool ok = false;
+  double os_spd = getBufferDoubleVal("NAV_SPEED", ok);
+  return(m_intercept.getBid(engine, os_spd));
+}
+
+//-----------------------------------------------------------
+// Procedure: getHeadingBid()
+//      Note: The distance scaled by how complementary the angles
+//            are, from dist*0.5 when facing the contact to dist*1
+//            when facing away.
+
+double BHV_TaskConvoy2::getHeadingBid() const
+{
+  //The angle between our current heading and the target, in radians
+  double phi = relBearing(m_osx, m_osy, m_osh, m_cnx, m_cny) * M_PI / 180;
 
   //Compute the distance to the target
   double dist = hypot(m_osx - m_cnx, m_osy - m_cny);
 
-  //The bid is the distance scaled by how complementary the angles are. In the two cases, the distance is scaled [dist*0.5, dist*1] on whether or not the agent is facing that direction, or away from, respectively
-  double bid = dist*(3/4 - (1/4)*cos(phi));
-
+  double bid = dist * (0.75 - (0.25 * cos(phi)));
   return(bid);
 }
 
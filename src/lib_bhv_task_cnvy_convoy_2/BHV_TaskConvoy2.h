@@ -16,6 +16,7 @@
 #include <string>
 #include <vector>
 #include "IvPTaskBehavior.h"
+#include "InterceptBid.h"
 
 class IvPDomain;
 class BHV_TaskConvoy2 : public IvPTaskBehavior {
@@ -33,10 +34,15 @@ public:
   void         onIdleState();
   IvPFunction* onRunState();
 
+ protected:
+  double getHeadingBid() const;
+
  protected:  // Configuration Parameters
+  double      m_turn_radius;
+  std::string m_bid_model;
 
  protected:  // State Variables
-
+  InterceptBid m_intercept;
 };
 
 #ifdef WIN32
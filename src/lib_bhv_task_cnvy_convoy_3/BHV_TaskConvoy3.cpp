@@ -16,6 +16,9 @@
 #include "BHV_TaskConvoy3.h"
 #include "MBUtils.h"
 #include "MacroUtils.h"
+#include "DubinsPath.h"
+#include "DubinsBidEngine.h"
+#include "InterceptBid.h"
 #include "AngleUtils.h"
 
 using namespace std;
@@ -26,6 +29,22 @@ using namespace std;
 BHV_TaskConvoy3::BHV_TaskConvoy3(IvPDomain domain) : IvPTaskBehavior(domain)
 {
   m_turn_radius = 3; //meters
+  m_bid_slot = -1;
+
+  m_view_path = false;
+  m_view_path_interval = 2;
+  m_view_path_tstamp = 0;
+
+  m_bid_model = "intercept";
+}
+
+//-----------------------------------------------------------
+// Procedure: Destructor
+
+BHV_TaskConvoy3::~BHV_TaskConvoy3()
+{
+  if(m_bid_slot >= 0)
+    getSharedBidEngine().removeTarget(m_bid_slot);
 }
 
 //-----------------------------------------------------------
@@ -52,7 +71,33 @@ bool BHV_TaskConvoy3::setParam(string param, string value)
   if((param == "turn_radius") && isNumber(value)) {
     m_turn_radius = atof(value.c_str());
     m_turn_radius_set = true;
-  return(true);
+    return(true);
+  }
+  else if((param == "bid_pos_tol") && isNumber(value))
+    return(m_bid_cache.setPosTolerance(atof(value.c_str())));
+  else if((param == "bid_hdg_tol") && isNumber(value))
+    return(m_bid_cache.setHdgTolerance(atof(value.c_str())));
+  else if((param == "bid_spd_tol") && isNumber(value))
+    return(m_bid_cache.setSpdTolerance(atof(value.c_str())));
+  else if(param == "bid_model") {
+    value = tolower(value);
+    if((value != "intercept") && (value != "path"))
+      return(false);
+    m_bid_model = value;
+    m_bid_cache.clear();
+    return(true);
+  }
+  else if((param == "join_range") && isNumber(value))
+    return(m_intercept.setJoinRange(atof(value.c_str())));
+  else if((param == "join_speed") && isNumber(value))
+    return(m_intercept.setJoinSpeed(atof(value.c_str())));
+  else if((param == "max_join_time") && isNumber(value))
+    return(m_intercept.setMaxTime(atof(value.c_str())));
+  else if(param == "view_path")
+    return(setBooleanOnString(m_view_path, value));
+  else if((param == "view_path_interval") && isNumber(value)) {
+    m_view_path_interval = vclip_min(atof(value.c_str()), 0);
+    return(true);
   }
 
   return (false);
@@ -79,117 +124,80 @@ IvPFunction *BHV_TaskConvoy3::onRunState()
 
 //-----------------------------------------------------------
 // Procedure: getTaskBid()
-
-double pmod(double a, double b) {
-  double r = fmod(a,b);
-  if (r < 0) {
-    r+=b;
-  }
-  return r;
-};
+//      Note: With bid_model=intercept (default), the bid is the time
+//            in seconds to join the contact on its projected track
+//            (see InterceptBid). With bid_model=path, the bid is the
+//            length of the shortest path to the contact's current
+//            position given the turn radius and current heading.
+//            Path lengths come from the module's shared
+//            DubinsBidEngine. The last bid is reused until the pose
+//            or contact moves beyond bid_pos_tol/hdg_tol. Intercept
+//            bids also depend on ownship speed and the contact
+//            velocity, so those are part of the cache key and a
+//            change beyond bid_spd_tol forces a new bid.
 
 double BHV_TaskConvoy3::getTaskBid()
 {
-  XYSegList predicted_trajectory;
-
-  // Get the differences between the state and the desired point
-  double dx = m_cnx - m_osx; // meters
-  double dy = m_cny - m_osy; // meters
-
-  double heading = pmod(450-m_osh, 360)*M_PI/180;
-  // Angle difference between heading and heading to target
-  double psi = pmod(atan2(dy, dx) - heading + M_PI, 2 * M_PI) - M_PI; // radians
-
-  // Determine if we are turning left or right
-  double ang_to_cor = heading; // radians
-  double cw = -1;             // a logical representation as a double - are we turning 'clockwise'
-  if (psi < 0)
-  {
-    ang_to_cor -= M_PI / 2;
-    cw = -1;
-  }
-  else
-  {
-    ang_to_cor += M_PI / 2;
-    cw = 1;
-  }
-
-  // Place a temporary turning radius
-  double current_x = m_osx;
-  double current_y = m_osy;
-  double current_heading = heading;
-
-  double center_x = current_x + m_turn_radius * cos(ang_to_cor);
-  double center_y = current_y + m_turn_radius * sin(ang_to_cor);
-
-  // If the point is within the radius of our center of rotation, we need to scoot forward and update our center of rotation, adding this to our odometer
-  predicted_trajectory.add_vertex(current_x, current_y);
-
-  double step_size = 0.5; // meters
-  while (hypot(m_cny - center_y, m_cnx - center_x) < m_turn_radius)
-  {
-
-    current_x += step_size * cos(current_heading);
-    current_y += step_size * sin(current_heading);
-
-    center_x = current_x + m_turn_radius * cos(ang_to_cor);
-    center_y = current_y + m_turn_radius * sin(ang_to_cor);
+  postPathView();
+  m_intercept.updateContact(m_cnx, m_cny, getBufferCurrTime());
+
+  double os_spd = 0;
+  double cnvx = 0;
+  double cnvy = 0;
+  if(m_bid_model == "intercept") {
+    bool ok = false;
+    os_spd = getBufferDoubleVal("NAV_SPEED", ok);
+    cnvx = m_intercept.getContactVX();
+    cnvy = m_intercept.getContactVY();
   }
 
-  // If we did have to move forward at all, then just add the new point to the predicted trajectory
-  if (hypot(current_y - m_osy, current_x - m_osx) > step_size / 2)
-  {
-    predicted_trajectory.add_vertex(current_x, current_y);
+  if(m_bid_cache.isValid(m_osx, m_osy, m_osh, os_spd,
+			 m_cnx, m_cny, cnvx, cnvy, m_turn_radius))
+    return(m_bid_cache.getBid());
+
+  DubinsBidEngine& engine = getSharedBidEngine();
+  engine.setPose(m_osx, m_osy, m_osh, m_turn_radius);
+
+  double bid = 0;
+  if(m_bid_model == "intercept")
+    bid = m_intercept.getBid(engine, os_spd);
+  else {
+    if(m_bid_slot < 0)
+      m_bid_slot = engine.addTarget(m_cnx, m_cny);
+    else
+      engine.setTarget(m_bid_slot, m_cnx, m_cny);
+    bid = engine.getBid(m_bid_slot);
   }
 
-  int steps = 1;
-
-  double ang_step_size = 5*M_PI/180; //k degrees to radians (5 degree step size for evaluation)
-  while (true)
-  {
-    double nang = ang_to_cor + M_PI + (cw * steps * ang_step_size);
-    double next_point_x = center_x + m_turn_radius * cos(nang);
-    double next_point_y = center_y + m_turn_radius * sin(nang);
-
-    //Vector v - current point to target
-    double dv_x = m_cnx - current_x;
-    double dv_y = m_cny - current_y;
-
-    //Vector u - current point to the next proposed point
-    double du_y = next_point_y - current_y;
-    double du_x = next_point_x - current_x;
-
-    double ang_to_trg = atan2(dv_y, dv_x);
-    double ang_to_np = atan2(du_y, du_x);
-
-    //Angle between the vectors, off of the vector to to target
-    double phi = ang_to_trg - ang_to_np;
+  m_bid_cache.setBid(m_osx, m_osy, m_osh, os_spd,
+		     m_cnx, m_cny, cnvx, cnvy, m_turn_radius, bid);
+  return(bid);
+}
 
-    phi = pmod(phi + M_PI, 2 * M_PI) - M_PI;
-    
-    //If the angle between these vectors is interior to the circle, i.e. it passes the circle, then we need to step to this next point
-    //Otherwise, if we have a straight shot to the target, then we completed the dubins turn
+//-----------------------------------------------------------
+// Procedure: postPathView()
+//      Note: Posts the predicted path only if view_path is set,
+//            and at most once per view_path_interval seconds.
 
-    //Or If we have done this over for over 1000 steps, we messed up and the algorithm is faulty
-    if (cw*phi+ang_step_size < 0 || steps > 1000) {
-      break;
-    }
+void BHV_TaskConvoy3::postPathView()
+{
+  if(!m_view_path)
+    return;
 
-    current_x = next_point_x;
-    current_y = next_point_y;
-    predicted_trajectory.add_vertex(current_x,current_y);
+  double curr_time = getBufferCurrTime();
+  if((curr_time - m_view_path_tstamp) < m_view_path_interval)
+    return;
+  m_view_path_tstamp = curr_time;
 
-    steps++;
-  }
+  DubinsPath path;
+  if(!path.setToPoint(m_osx, m_osy, m_osh, m_cnx, m_cny, m_turn_radius))
+    return;
 
-  // Once we have our center of rotation placed, we zip around the turning radius, discretely, determining whether or not we have a trajectory which does not intersect with the circle
-  predicted_trajectory.add_vertex(m_cnx,m_cny);
+  XYSegList predicted_trajectory = path.getSegList(5);
   predicted_trajectory.set_color("edge","yellow");
-  predicted_trajectory.set_duration(10);
+  predicted_trajectory.set_duration(vclip_min(m_view_path_interval, 10));
   predicted_trajectory.set_label(m_us_name+"_dubins_cnvy");
   postMessage("VIEW_SEGLIST", predicted_trajectory.get_spec(2));
-  double dist = predicted_trajectory.length();
-  return(dist);
 }
 
 //-----------------------------------------------------------
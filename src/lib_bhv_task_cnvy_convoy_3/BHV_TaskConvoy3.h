@@ -16,12 +16,14 @@
 #include <string>
 #include <vector>
 #include "IvPTaskBehavior.h"
+#include "DubinsBidCache.h"
+#include "InterceptBid.h"
 
 class IvPDomain;
 class BHV_TaskConvoy3 : public IvPTaskBehavior {
 public:
   BHV_TaskConvoy3(IvPDomain);
-  ~BHV_TaskConvoy3() {}
+  ~BHV_TaskConvoy3();
 
   // virtuals defined
   void   onHelmStart();
@@ -33,12 +35,22 @@ public:
   void         onIdleState();
   IvPFunction* onRunState();
 
+ protected:
+  void postPathView();
+
  protected:  // Configuration Parameters
+ bool   m_view_path;
+ double m_view_path_interval;
+ std::string m_bid_model;
 
  protected:  // State Variables
  double m_turn_radius;
  bool m_turn_radius_set;
+ int m_bid_slot;
+ double m_view_path_tstamp;
 
+ DubinsBidCache m_bid_cache;
+ InterceptBid   m_intercept;
 };
 
 #ifdef WIN32
@@ -15,6 +15,8 @@
 #include "BHV_TaskWaypoint3.h"
 #include "MBUtils.h"
 #include "MacroUtils.h"
+#include "DubinsPath.h"
+#include "DubinsBidEngine.h"
 
 using namespace std;
 
@@ -28,6 +30,11 @@ BHV_TaskWaypoint3::BHV_TaskWaypoint3(IvPDomain domain) :
   m_ptx = 0;
   m_pty = 0;
   m_turn_radius = 3;
+  m_bid_slot = -1;
+
+  m_view_path = false;
+  m_view_path_interval = 2;
+  m_view_path_tstamp = 0;
 
   m_ptx_set = false;
   m_pty_set = false;
@@ -37,6 +44,15 @@ BHV_TaskWaypoint3::BHV_TaskWaypoint3(IvPDomain domain) :
 }
 
 
+//-----------------------------------------------------------
+// Procedure: Destructor
+
+BHV_TaskWaypoint3::~BHV_TaskWaypoint3()
+{
+  if(m_bid_slot >= 0)
+    getSharedBidEngine().removeTarget(m_bid_slot);
+}
+
 //-----------------------------------------------------------
 // Procedure: onHelmStart()
 
@@ -87,6 +103,16 @@ bool BHV_TaskWaypoint3::setParam(string param, string value)
   }
   else if(param == "consider_contacts")
     return(setBooleanOnString(m_consider_contacts, value));
+  else if((param == "bid_pos_tol") && isNumber(value))
+    return(m_bid_cache.setPosTolerance(atof(value.c_str())));
+  else if((param == "bid_hdg_tol") && isNumber(value))
+    return(m_bid_cache.setHdgTolerance(atof(value.c_str())));
+  else if(param == "view_path")
+    return(setBooleanOnString(m_view_path, value));
+  else if((param == "view_path_interval") && isNumber(value)) {
+    m_view_path_interval = vclip_min(atof(value.c_str()), 0);
+    return(true);
+  }
   
   return(false);
 }
@@ -113,118 +139,55 @@ IvPFunction *BHV_TaskWaypoint3::onRunState()
 
 //-----------------------------------------------------------
 // Procedure: getTaskBid()
-
-double pmod(double a, double b) {
-  double r = fmod(a,b);
-  if (r < 0) {
-    r+=b;
-  }
-  return r;
-};
+//      Note: Length of the shortest path to the target given the
+//            turn radius and current heading. Bids of all task
+//            behaviors in this module are scored together by the
+//            shared DubinsBidEngine. The last bid is reused until
+//            the pose or target moves beyond bid_pos_tol/hdg_tol.
 
 double BHV_TaskWaypoint3::getTaskBid()
 {
-  // TODO: Place dubins turn predicted odometry here
-  XYSegList predicted_trajectory;
-
-  // Get the differences between the state and the desired point
-  double dx = m_ptx - m_osx; // meters
-  double dy = m_pty - m_osy; // meters
-
-  double heading = pmod(450-m_osh, 360)*M_PI/180;
-  // Angle difference between heading and heading to target
-  double psi = pmod(atan2(dy, dx) - heading + M_PI, 2 * M_PI) - M_PI; // radians
-
-  // Determine if we are turning left or right
-  double ang_to_cor = heading; // radians
-  double cw = -1;             // a logical representation as a double - are we turning 'clockwise'
-  if (psi < 0)
-  {
-    ang_to_cor -= M_PI / 2;
-    cw = -1;
-  }
-  else
-  {
-    ang_to_cor += M_PI / 2;
-    cw = 1;
-  }
-
-  // Place a temporary turning radius
-  double current_x = m_osx;
-  double current_y = m_osy;
-  double current_heading = heading;
-
-  double center_x = current_x + m_turn_radius * cos(ang_to_cor);
-  double center_y = current_y + m_turn_radius * sin(ang_to_cor);
-
-  // If the point is within the radius of our center of rotation, we need to scoot forward and update our center of rotation, adding this to our odometer
-  predicted_trajectory.add_vertex(current_x, current_y);
+  postPathView();
 
-  double step_size = 0.5; // meters
-  while (hypot(m_pty - center_y, m_ptx - center_x) < m_turn_radius)
-  {
+  if(m_bid_cache.isValid(m_osx, m_osy, m_osh, m_ptx, m_pty, m_turn_radius))
+    return(m_bid_cache.getBid());
 
-    current_x += step_size * cos(current_heading);
-    current_y += step_size * sin(current_heading);
-
-    center_x = current_x + m_turn_radius * cos(ang_to_cor);
-    center_y = current_y + m_turn_radius * sin(ang_to_cor);
-  }
-
-  // If we did have to move forward at all, then just add the new point to the predicted trajectory
-  if (hypot(current_y - m_osy, current_x - m_osx) > step_size / 2)
-  {
-    predicted_trajectory.add_vertex(current_x, current_y);
-  }
-
-  int steps = 1;
-
-  double ang_step_size = 5*M_PI/180; //k degrees to radians (5 degree step size for evaluation)
-  while (true)
-  {
-    double nang = ang_to_cor + M_PI + (cw * steps * ang_step_size);
-    double next_point_x = center_x + m_turn_radius * cos(nang);
-    double next_point_y = center_y + m_turn_radius * sin(nang);
-
-    //Vector v - current point to target
-    double dv_x = m_ptx - current_x;
-    double dv_y = m_pty - current_y;
-
-    //Vector u - current point to the next proposed point
-    double du_y = next_point_y - current_y;
-    double du_x = next_point_x - current_x;
-
-    double ang_to_trg = atan2(dv_y, dv_x);
-    double ang_to_np = atan2(du_y, du_x);
+  DubinsBidEngine& engine = getSharedBidEngine();
+  engine.setPose(m_osx, m_osy, m_osh, m_turn_radius);
+  if(m_bid_slot < 0)
+    m_bid_slot = engine.addTarget(m_ptx, m_pty);
+  else
+    engine.setTarget(m_bid_slot, m_ptx, m_pty);
+  double bid = engine.getBid(m_bid_slot);
 
-    //Angle between the vectors, off of the vector to to target
-    double phi = ang_to_trg - ang_to_np;
+  m_bid_cache.setBid(m_osx, m_osy, m_osh, m_ptx, m_pty, m_turn_radius, bid);
+  return(bid);
+}
 
-    phi = pmod(phi + M_PI, 2 * M_PI) - M_PI;
-    
-    //If the angle between these vectors is interior to the circle, i.e. it passes the circle, then we need to step to this next point
-    //Otherwise, if we have a straight shot to the target, then we completed the dubins turn
+//-----------------------------------------------------------
+// Procedure: postPathView()
+//      Note: Posts the predicted path only if view_path is set,
+//            and at most once per view_path_interval seconds.
 
-    //Or If we have done this over for over 1000 steps, we messed up and the algorithm is faulty
-    if (cw*phi+ang_step_size < 0 || steps > 1000) {
-      break;
-    }
+void BHV_TaskWaypoint3::postPathView()
+{
+  if(!m_view_path)
+    return;
 
-    current_x = next_point_x;
-    current_y = next_point_y;
-    predicted_trajectory.add_vertex(current_x,current_y);
+  double curr_time = getBufferCurrTime();
+  if((curr_time - m_view_path_tstamp) < m_view_path_interval)
+    return;
+  m_view_path_tstamp = curr_time;
 
-    steps++;
-  }
+  DubinsPath path;
+  if(!path.setToPoint(m_osx, m_osy, m_osh, m_ptx, m_pty, m_turn_radius))
+    return;
 
-  // Once we have our center of rotation placed, we zip around the turning radius, discretely, determining whether or not we have a trajectory which does not intersect with the circle
-  predicted_trajectory.add_vertex(m_ptx,m_pty);
+  XYSegList predicted_trajectory = path.getSegList(5);
   predicted_trajectory.set_color("edge","red");
-  predicted_trajectory.set_duration(10);
+  predicted_trajectory.set_duration(vclip_min(m_view_path_interval, 10));
   predicted_trajectory.set_label(m_us_name+"_dubins_wpt");
   postMessage("VIEW_SEGLIST", predicted_trajectory.get_spec());
-  double dist = predicted_trajectory.length();
-  return(dist);
 }
 
 //-----------------------------------------------------------
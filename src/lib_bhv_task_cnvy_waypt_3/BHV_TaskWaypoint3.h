@@ -16,12 +16,13 @@
 #include <string>
 #include <vector>
 #include "IvPTaskBehavior.h"
+#include "DubinsBidCache.h"
 
 class IvPDomain;
 class BHV_TaskWaypoint3 : public IvPTaskBehavior {
 public:
   BHV_TaskWaypoint3(IvPDomain);
-  ~BHV_TaskWaypoint3() {}
+  ~BHV_TaskWaypoint3();
 
   // virtuals defined
   void   onHelmStart();
@@ -35,6 +36,7 @@ public:
 
  protected:
   bool  updatePlatformInfo();
+  void  postPathView();
 
   
  protected:  // Configuration Parameters
@@ -48,9 +50,16 @@ public:
   bool m_turn_radius_set;
 
   bool m_consider_contacts;
+
+  bool   m_view_path;
+  double m_view_path_interval;
   
  protected:  // State Variables
 
+  int    m_bid_slot;
+  double m_view_path_tstamp;
+
+  DubinsBidCache m_bid_cache;
 };
 
 #ifdef WIN32
@@ -0,0 +1,251 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: BHV_TourWaypoint.cpp                                 */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cstdlib>
+#include <cmath>
+#include "BHV_TourWaypoint.h"
+#include "MBUtils.h"
+#include "AngleUtils.h"
+#include "BuildUtils.h"
+#include "ZAIC_PEAK.h"
+#include "OF_Coupler.h"
+
+using namespace std;
+
+//-----------------------------------------------------------
+// Procedure: Constructor
+
+BHV_TourWaypoint::BHV_TourWaypoint(IvPDomain gdomain) : 
+  IvPBehavior(gdomain)
+{
+  IvPBehavior::setParam("name", "tour_waypoint");
+  m_domain = subDomain(m_domain, "course,speed");
+
+  // Default values for configuration parameters 
+  m_desired_speed  = 0; 
+  m_capture_radius = 5;
+  m_slip_radius    = 15;
+  m_edits_var      = "WPT_EDITS";
+
+  // Default values for behavior state variables
+  m_osx  = 0;
+  m_osy  = 0;
+  m_next_id  = -1;
+  m_min_dist = -1;
+  m_want_sync   = false;
+  m_resync_time = 0;
+
+  addInfoVars("NAV_X, NAV_Y");
+  addInfoVars(m_edits_var);
+}
+
+//---------------------------------------------------------------
+// Procedure: setParam()
+
+bool BHV_TourWaypoint::setParam(string param, string val) 
+{
+  param = tolower(param);
+
+  double double_val = atof(val.c_str());
+  if((param == "speed") && (double_val > 0) && (isNumber(val))) {
+    m_desired_speed = double_val;
+    return(true);
+  }
+  else if((param == "capture_radius") && (double_val > 0) && (isNumber(val))) {
+    m_capture_radius = double_val;
+    return(true);
+  }
+  else if((param == "slip_radius") && (double_val >= 0) && (isNumber(val))) {
+    m_slip_radius = double_val;
+    return(true);
+  }
+  else if((param == "edits_var") && (val != "") && !strContainsWhite(val)) {
+    m_edits_var = val;
+    addInfoVars(m_edits_var);
+    return(true);
+  }
+  else if((param == "wptflag") && strContains(val, '=')) {
+    m_wptflags.push_back(val);
+    return(true);
+  }
+  return(false);
+}
+
+//-----------------------------------------------------------
+// Procedure: onIdleState()
+//      Note: Edits are still taken while idle so the list is
+//            current when the behavior runs again
+
+void BHV_TourWaypoint::onIdleState() 
+{
+  readEdits();
+  postViewPoint(false);
+}
+
+//-----------------------------------------------------------
+// Procedure: onRunState()
+
+IvPFunction *BHV_TourWaypoint::onRunState() 
+{
+  bool ok1, ok2;
+  m_osx = getBufferDoubleVal("NAV_X", ok1);
+  m_osy = getBufferDoubleVal("NAV_Y", ok2);
+  if(!ok1 || !ok2) {
+    postWMessage("No ownship X/Y info in info_buffer.");
+    return(0);
+  }
+
+  readEdits();
+  checkArrivals();
+  if(m_next_id < 0) {
+    postViewPoint(false);
+    return(0);
+  }
+  postViewPoint(true);
+
+  IvPFunction *ipf = buildFunctionWithZAIC();
+  if(ipf == 0) 
+    postWMessage("Problem Creating the IvP Function");
+  else
+    ipf->setPWT(m_priority_wt);
+  
+  return(ipf);
+}
+
+//-----------------------------------------------------------
+// Procedure: readEdits()
+//      Note: Every message since the last iteration is applied,
+//            in order, not just the latest
+
+void BHV_TourWaypoint::readEdits()
+{
+  if(getBufferVarUpdated(m_edits_var)) {
+    bool ok;
+    vector<string> msgs = getBufferStringVector(m_edits_var, ok);
+    for(unsigned int i=0; ok && (i<msgs.size()); i++) {
+      if(!m_tour.apply(msgs[i]))
+	m_want_sync = true;
+    }
+  }
+  if(m_tour.inSync())
+    m_want_sync = false;
+
+  double now = getBufferCurrTime();
+  if(m_want_sync && ((now - m_resync_time) > 5)) {
+    postMessage(m_edits_var + "_RESYNC", m_tour.getSeq());
+    m_resync_time = now;
+  }
+}
+
+//-----------------------------------------------------------
+// Procedure: checkArrivals()
+//      Note: Takes off each point reached, and sets the next
+
+void BHV_TourWaypoint::checkArrivals()
+{
+  bool reached = false;
+  while(m_tour.size() > 0) {
+    int id = m_tour.getID(0);
+    if(id != m_next_id) {
+      m_next_id  = id;
+      m_min_dist = -1;
+      m_nextpt.set_vertex(m_tour.getX(0), m_tour.getY(0));
+    }
+
+    double dist = hypot(m_tour.getX(0) - m_osx, m_tour.getY(0) - m_osy);
+    bool slipped = (m_min_dist >= 0) && (m_min_dist <= m_slip_radius) &&
+      (dist > m_min_dist);
+    if((dist > m_capture_radius) && !slipped) {
+      if((m_min_dist < 0) || (dist < m_min_dist))
+	m_min_dist = dist;
+      return;
+    }
+
+    postWptFlags(0);
+    m_tour.remove(id);
+    reached = true;
+  }
+
+  m_next_id = -1;
+  if(reached)
+    setComplete();
+}
+
+//-----------------------------------------------------------
+// Procedure: postWptFlags()
+
+void BHV_TourWaypoint::postWptFlags(unsigned int ix)
+{
+  for(unsigned int i=0; i<m_wptflags.size(); i++) {
+    string val = m_wptflags[i];
+    string var = biteStringX(val, '=');
+    val = findReplace(val, "$(X)", doubleToStringX(m_tour.getX(ix), 2));
+    val = findReplace(val, "$(Y)", doubleToStringX(m_tour.getY(ix), 2));
+    val = findReplace(val, "$(ID)", uintToString(m_tour.getID(ix)));
+    if(isNumber(val))
+      postMessage(var, atof(val.c_str()));
+    else
+      postMessage(var, val);
+  }
+}
+
+//-----------------------------------------------------------
+// Procedure: postViewPoint()
+
+void BHV_TourWaypoint::postViewPoint(bool viewable) 
+{
+  m_nextpt.set_label(m_us_name + "'s next waypoint");
+  
+  string point_spec;
+  if(viewable)
+    point_spec = m_nextpt.get_spec("active=true");
+  else
+    point_spec = m_nextpt.get_spec("active=false");
+  postMessage("VIEW_POINT", point_spec);
+}
+
+//-----------------------------------------------------------
+// Procedure: buildFunctionWithZAIC()
+
+IvPFunction *BHV_TourWaypoint::buildFunctionWithZAIC() 
+{
+  ZAIC_PEAK spd_zaic(m_domain, "speed");
+  spd_zaic.setSummit(m_desired_speed);
+  spd_zaic.setPeakWidth(0.5);
+  spd_zaic.setBaseWidth(1.0);
+  spd_zaic.setSummitDelta(0.8);  
+  if(spd_zaic.stateOK() == false) {
+    string warnings = "Speed ZAIC problems " + spd_zaic.getWarnings();
+    postWMessage(warnings);
+    return(0);
+  }
+  
+  double rel_ang_to_wpt = relAng(m_osx, m_osy, m_nextpt.x(), m_nextpt.y());
+  ZAIC_PEAK crs_zaic(m_domain, "course");
+  crs_zaic.setSummit(rel_ang_to_wpt);
+  crs_zaic.setPeakWidth(0);
+  crs_zaic.setBaseWidth(180.0);
+  crs_zaic.setSummitDelta(0);  
+  crs_zaic.setValueWrap(true);
+  if(crs_zaic.stateOK() == false) {
+    string warnings = "Course ZAIC problems " + crs_zaic.getWarnings();
+    postWMessage(warnings);
+    return(0);
+  }
+
+  IvPFunction *spd_ipf = spd_zaic.extractIvPFunction();
+  IvPFunction *crs_ipf = crs_zaic.extractIvPFunction();
+
+  OF_Coupler coupler;
+  IvPFunction *ivp_function = coupler.couple(crs_ipf, spd_ipf, 50, 50);
+
+  return(ivp_function);
+}
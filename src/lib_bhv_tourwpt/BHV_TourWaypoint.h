@@ -0,0 +1,78 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: BHV_TourWaypoint.h                                   */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef BHV_TOUR_WAYPOINT_HEADER
+#define BHV_TOUR_WAYPOINT_HEADER
+
+#include <string>
+#include <vector>
+#include "IvPBehavior.h"
+#include "XYPoint.h"
+#include "TourEdits.h"
+
+//---------------------------------------------------------------
+// BHV_TourWaypoint: visits a list of points in order, the list
+// kept by TourEdits messages on edits_var (WPT_EDITS) so a planner
+// sends only what changed rather than the whole list each time.
+//
+// A point is reached within capture_radius, or once the vehicle
+// has come within slip_radius and starts moving away. Each wptflag
+// is then posted, with $(X), $(Y) and $(ID) of the point, and the
+// endflags once the list runs out. Run it perpetual so it picks up
+// points sent after that. If an edit is missed, <edits_var>_RESYNC
+// is posted, every 5 secs until the planner sends a full list.
+
+class BHV_TourWaypoint : public IvPBehavior {
+public:
+  BHV_TourWaypoint(IvPDomain);
+  ~BHV_TourWaypoint() {};
+  
+  bool         setParam(std::string, std::string);
+  void         onIdleState();
+  IvPFunction* onRunState();
+
+protected:
+  void         readEdits();
+  void         checkArrivals();
+  void         postWptFlags(unsigned int ix);
+  void         postViewPoint(bool viewable=true);
+  IvPFunction* buildFunctionWithZAIC();
+
+protected: // Configuration parameters
+  double       m_desired_speed;
+  double       m_capture_radius;
+  double       m_slip_radius;
+  std::string  m_edits_var;
+  std::vector<std::string> m_wptflags;
+
+protected: // State variables
+  double       m_osx;
+  double       m_osy;
+  TourEdits    m_tour;
+  XYPoint      m_nextpt;
+  int          m_next_id;      // -1 if no next point
+  double       m_min_dist;     // Closest to the next point so far
+  bool         m_want_sync;
+  double       m_resync_time;
+};
+
+#ifdef WIN32
+	// Windows needs to explicitly specify functions to export from a dll
+   #define IVP_EXPORT_FUNCTION __declspec(dllexport) 
+#else
+   #define IVP_EXPORT_FUNCTION
+#endif
+
+extern "C" {
+  IVP_EXPORT_FUNCTION IvPBehavior * createBehavior(std::string name, IvPDomain domain) 
+  {return new BHV_TourWaypoint(domain);}
+}
+#endif
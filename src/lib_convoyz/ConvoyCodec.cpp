@@ -0,0 +1,224 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoyCodec.cpp                                      */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <charconv>
+#include "ConvoyCodec.h"
+
+using namespace std;
+
+//---------------------------------------------------------
+// Procedure: next()
+//      Note: Same splitting rules as parseString(msg,',')
+//            followed by biteStringX(field,'='). A field with
+//            no '=' yields the whole field as key, empty val.
+
+bool ConvoyKVReader::next(string_view& key, string_view& val)
+{
+  if(m_pos > m_msg.size())
+    return(false);
+
+  size_t end = m_msg.find(',', m_pos);
+  if(end == string_view::npos)
+    end = m_msg.size();
+
+  string_view field = m_msg.substr(m_pos, end - m_pos);
+  m_pos = end + 1;
+
+  size_t eq = field.find('=');
+  if(eq == string_view::npos) {
+    key = kvTrim(field);
+    val = string_view();
+  }
+  else {
+    key = kvTrim(field.substr(0, eq));
+    val = kvTrim(field.substr(eq + 1));
+  }
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: kvTrim()
+
+string_view kvTrim(string_view str)
+{
+  size_t first = 0;
+  while((first < str.size()) &&
+	((str[first] == ' ') || (str[first] == '\t')))
+    first++;
+  size_t last = str.size();
+  while((last > first) &&
+	((str[last-1] == ' ') || (str[last-1] == '\t')))
+    last--;
+  return(str.substr(first, last - first));
+}
+
+//---------------------------------------------------------
+// Procedure: kvToDouble()
+//      Note: from_chars does not accept a leading '+'
+
+double kvToDouble(string_view str)
+{
+  const char* first = str.data();
+  const char* last  = str.data() + str.size();
+  if((first != last) && (*first == '+'))
+    first++;
+
+  double dval = 0;
+  from_chars_result res = from_chars(first, last, dval);
+  if(res.ec != errc())
+    return(0);
+  return(dval);
+}
+
+//---------------------------------------------------------
+// Procedure: kvToDouble()
+
+bool kvToDouble(string_view str, double& dval)
+{
+  const char* first = str.data();
+  const char* last  = str.data() + str.size();
+  if((first != last) && (*first == '+'))
+    first++;
+  if(first == last)
+    return(false);
+
+  double result = 0;
+  from_chars_result res = from_chars(first, last, result);
+  if((res.ec != errc()) || (res.ptr != last))
+    return(false);
+
+  dval = result;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: kvIsTrue()
+
+bool kvIsTrue(string_view str)
+{
+  if(str.size() != 4)
+    return(false);
+  const char* tstr = "true";
+  for(size_t i=0; i<4; i++) {
+    char c = str[i];
+    if((c >= 'A') && (c <= 'Z'))
+      c = c - 'A' + 'a';
+    if(c != tstr[i])
+      return(false);
+  }
+  return(true);
+}
+
+//---------------------------------------------------------
+// Constructor()
+
+ConvoyKVWriter::ConvoyKVWriter(string& buf, bool clear) : m_buf(buf)
+{
+  if(clear)
+    m_buf.clear();
+}
+
+//---------------------------------------------------------
+// Procedure: addString()
+
+void ConvoyKVWriter::addString(string_view key, string_view val)
+{
+  addKey(key);
+  m_buf.append(val.data(), val.size());
+}
+
+//---------------------------------------------------------
+// Procedure: addDouble()
+
+void ConvoyKVWriter::addDouble(string_view key, double val, int digits)
+{
+  addKey(key);
+  addNumber(val, digits, false);
+}
+
+//---------------------------------------------------------
+// Procedure: addDoubleX()
+
+void ConvoyKVWriter::addDoubleX(string_view key, double val, int digits)
+{
+  addKey(key);
+  addNumber(val, digits, true);
+}
+
+//---------------------------------------------------------
+// Procedure: addUInt()
+
+void ConvoyKVWriter::addUInt(string_view key, unsigned int val)
+{
+  addKey(key);
+
+  char buff[16];
+  to_chars_result res = to_chars(buff, buff+sizeof(buff), val);
+  m_buf.append(buff, res.ptr - buff);
+}
+
+//---------------------------------------------------------
+// Procedure: addBool()
+
+void ConvoyKVWriter::addBool(string_view key, bool val)
+{
+  addKey(key);
+  if(val)
+    m_buf.append("true");
+  else
+    m_buf.append("false");
+}
+
+//---------------------------------------------------------
+// Procedure: addKey()
+
+void ConvoyKVWriter::addKey(string_view key)
+{
+  if(!m_buf.empty())
+    m_buf.push_back(',');
+  m_buf.append(key.data(), key.size());
+  m_buf.push_back('=');
+}
+
+//---------------------------------------------------------
+// Procedure: addNumber()
+//      Note: When stripping, trailing zeros and a trailing
+//            decimal point are removed, and "-0" becomes "0",
+//            same as doubleToStringX().
+
+void ConvoyKVWriter::addNumber(double val, int digits, bool strip)
+{
+  if(digits < 0)
+    digits = 0;
+
+  char buff[64];
+  char* last = buff + sizeof(buff);
+  to_chars_result res = to_chars(buff, last, val,
+				 chars_format::fixed, digits);
+  if(res.ec != errc()) {
+    m_buf.append("nan");
+    return;
+  }
+  char* end = res.ptr;
+
+  if(strip && (digits > 0)) {
+    while((end > buff) && (*(end-1) == '0'))
+      end--;
+    if((end > buff) && (*(end-1) == '.'))
+      end--;
+  }
+
+  size_t len = end - buff;
+  if((len == 2) && (buff[0] == '-') && (buff[1] == '0'))
+    m_buf.push_back('0');
+  else
+    m_buf.append(buff, len);
+}
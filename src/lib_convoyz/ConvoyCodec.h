@@ -0,0 +1,108 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoyCodec.h                                        */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef CONVOY_CODEC_HEADER
+#define CONVOY_CODEC_HEADER
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+//---------------------------------------------------------------
+// Shared key=value codec for the convoy message types, e.g.,
+//   "convoy_rng=17.4,vname=deb,cname=cal,rng_delta=-7.5"
+// Decoding walks the message in place with string_views (no
+// token vectors, no per-field string copies) and dispatches each
+// key through a static per-class field table. Numbers are parsed
+// with from_chars, only for fields that are numeric. Encoding
+// appends into a caller-owned buffer that may be reused.
+
+//---------------------------------------------------------------
+// ConvoyKVReader: yields successive trimmed key/value pairs
+
+class ConvoyKVReader
+{
+ public:
+  ConvoyKVReader(std::string_view msg) : m_msg(msg), m_pos(0) {}
+  ~ConvoyKVReader() {}
+
+  bool next(std::string_view& key, std::string_view& val);
+
+ private:
+  std::string_view m_msg;
+  std::size_t      m_pos;
+};
+
+//---------------------------------------------------------------
+// Value helpers
+
+std::string_view kvTrim(std::string_view);
+
+// Lenient, like atof(): leading numeric prefix, or zero
+double kvToDouble(std::string_view);
+
+// Strict, like isNumber(): true only if the whole value is numeric
+bool   kvToDouble(std::string_view, double&);
+
+bool   kvIsTrue(std::string_view);
+
+//---------------------------------------------------------------
+// ConvoyKVField: one entry in a per-class static field table
+
+template <class T>
+struct ConvoyKVField
+{
+  std::string_view key;
+  void (*setter)(T&, std::string_view);
+};
+
+template <class T, std::size_t N>
+void kvDecode(std::string_view msg, T& obj,
+	      const ConvoyKVField<T> (&table)[N])
+{
+  ConvoyKVReader reader(msg);
+  std::string_view key, val;
+  while(reader.next(key, val)) {
+    for(std::size_t i=0; i<N; i++) {
+      if(key == table[i].key) {
+	table[i].setter(obj, val);
+	break;
+      }
+    }
+  }
+}
+
+//---------------------------------------------------------------
+// ConvoyKVWriter: appends "key=value" pairs, comma separated.
+//   addDouble()  matches doubleToString(), fixed precision
+//   addDoubleX() matches doubleToStringX(), trailing zeros dropped
+
+class ConvoyKVWriter
+{
+ public:
+  ConvoyKVWriter(std::string& buf, bool clear=true);
+  ~ConvoyKVWriter() {}
+
+  void addString(std::string_view key, std::string_view val);
+  void addDouble(std::string_view key, double val, int digits=2);
+  void addDoubleX(std::string_view key, double val, int digits=2);
+  void addUInt(std::string_view key, unsigned int val);
+  void addBool(std::string_view key, bool val);
+
+ private:
+  void addKey(std::string_view key);
+  void addNumber(double val, int digits, bool strip);
+
+ private:
+  std::string& m_buf;
+};
+
+#endif
@@ -0,0 +1,370 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoyFollower.cpp                                   */
+/*    DATE: Oct 19th 2026, broken out of BHV_ConvoyV21X          */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cmath>
+#include <cstdlib>
+#include "ConvoyFollower.h"
+#include "MBUtils.h"
+#include "AngleUtils.h"
+#include "GeomUtils.h"
+
+using namespace std;
+
+//-----------------------------------------------------------
+// Constructor()
+
+ConvoyFollower::ConvoyFollower()
+{
+  // Config variables
+  m_capture_radius = 5;  // meters
+  m_slip_radius    = 20; // meters
+  m_compression    = 0;  // [0,1]
+  m_aft_patience   = false;
+
+  // State variables
+  m_osx = 0;
+  m_osy = 0;
+  m_osh = 0;
+  m_cnx = 0;
+  m_cny = 0;
+  m_cnh = 0;
+  m_cnv = 0;
+  m_contact_range = 0;
+
+  m_wptx = 0;
+  m_wpty = 0;
+  m_set_speed = 0;
+  m_cnv_avg_2sec = 0;
+  m_cnv_avg_5sec = 0;
+
+  m_drop_dist = -1;
+  m_drop_ang  = -1;
+  m_drop_nx   = 0;
+  m_drop_ny   = 0;
+
+  // State variables (metrics)
+  m_convoy_range = 1;
+  m_range_delta  = 0;
+  m_tail_range   = -1;
+  m_tail_angle   = -1;
+  m_marker_bng   = -1;
+  m_track_error  = -1;
+  m_alignment    = -1;
+
+  m_dropped_markers = 0;
+}
+
+//-----------------------------------------------------------
+// Procedure: setParam()
+//      Note: Same param names as the convoy behavior, so a block
+//            from a .bhv file may be handed over as is.
+
+bool ConvoyFollower::setParam(string param, string value)
+{
+  param = tolower(param);
+  value = stripBlankEnds(value);
+
+  bool handled = false;
+  if((param == "nm_radius") || (param == "slip_radius"))
+    handled = setNonNegDoubleOnString(m_slip_radius, value);
+  else if((param == "radius") || (param == "capture_radius"))
+    handled = setNonNegDoubleOnString(m_capture_radius, value);
+  else if(param == "tail_length_max")
+    handled = m_marker_tail.setMaxTailLength(value);
+  else if(param == "inter_mark_range")
+    handled = m_marker_tail.setInterMarkRange(value);
+  else if((param == "full_stop_convoy_range") ||
+	  (param == "slower_convoy_range") ||
+	  (param == "ideal_convoy_range") ||
+	  (param == "faster_convoy_range") ||
+	  (param == "full_lag_convoy_range") ||
+	  (param == "lag_speed_delta"))
+    handled = m_spd_policy_base.setParam(param, value);
+  else if(param == "compression") {
+    double dval = atof(value.c_str());
+    if(isNumber(value) && (dval >= 0) && (dval <= 1)) {
+      m_compression = dval;
+      handled = true;
+    }
+  }
+  else if(param == "aft_patience")
+    handled = setBooleanOnString(m_aft_patience, value);
+
+  return(handled);
+}
+
+//-----------------------------------------------------------
+// Procedure: checkParams()
+//   Returns: Empty string if all is ok.
+//            Error message otherwise.
+
+string ConvoyFollower::checkParams()
+{
+  string status = m_spd_policy_base.status();
+  if(status != "ok")
+    return("base spd_policy: " + status);
+
+  if(m_slip_radius < m_capture_radius)
+    return("slip_radius smaller than capture_radius");
+
+  if(m_marker_tail.getInterMarkRange() >= m_marker_tail.getMaxTailLength())
+    return("tail_length_max should be greater than inter_mark_range");
+
+  return("");
+}
+
+//-----------------------------------------------------------
+// Procedure: onParamsComplete()
+//      Note: The prevailing speed policy is a copy of the base
+//            policy, with the current compression applied.
+
+void ConvoyFollower::onParamsComplete(string vname)
+{
+  m_spd_policy = m_spd_policy_base;
+  m_spd_policy.compress(m_compression);
+  m_spd_policy.setVName(tolower(vname));
+}
+
+//-----------------------------------------------------------
+// Procedure: setOwnship()
+
+void ConvoyFollower::setOwnship(double osx, double osy, double osh)
+{
+  m_osx = osx;
+  m_osy = osy;
+  m_osh = osh;
+}
+
+//-----------------------------------------------------------
+// Procedure: setContact()
+//      Note: Ownship should be set first, for the contact range
+
+void ConvoyFollower::setContact(double cnx, double cny,
+				double cnh, double cnv)
+{
+  m_cnx = cnx;
+  m_cny = cny;
+  m_cnh = cnh;
+  m_cnv = cnv;
+  m_contact_range = hypot(m_cnx - m_osx, m_cny - m_osy);
+
+  m_marker_tail.setPosCN(m_cnx, m_cny);
+}
+
+//-----------------------------------------------------------
+// Procedure: checkDropAftMarker()
+//   Returns: true if the aft marker was dropped. The dropped
+//            marker and the reason are held until the next call.
+
+bool ConvoyFollower::checkDropAftMarker()
+{
+  m_dropped_marker = ConvoyMarker();
+  m_drop_reason = "";
+  m_drop_dist = -1;
+  m_drop_ang  = -1;
+
+  if(m_marker_tail.empty())
+    return(false);
+
+  ConvoyMarker aft_marker = m_marker_tail.getAftMarker();
+
+  double dist = m_marker_tail.distToAftMarker(m_osx, m_osy);
+  m_drop_dist = dist;
+
+  // Case 1: Simplest check is the capture radius
+  bool marker_dropped = false;
+  if(dist < m_capture_radius) {
+    m_marker_tail.dropAftMarker();
+    m_drop_reason = "one";
+    marker_dropped = true;
+  }
+
+  // Case 2: If inside the slip radius, check if ownship crossed line
+  // perpendicular to line from aft marker to near-aft marker.
+  if(!marker_dropped && (dist < m_slip_radius)) {
+    // Calculate the next point on the marker list.
+    //
+    //               wpt             nextpt         |
+    //                 o----------------o           |
+    //                  \ angle                     |
+    //                   \                          |
+    //                    \                         |
+    //                     o--->                    |
+    //                  ownship                     |
+
+    // If only one marker, next "marker" will be contact position
+    double next_x = m_cnx;
+    double next_y = m_cny;
+    if(m_marker_tail.size() > 1) {
+      ConvoyMarker marker = m_marker_tail.getNearAftMarker();
+      next_x = marker.getX();
+      next_y = marker.getY();
+    }
+    double angle = angleFromThreePoints(m_wptx, m_wpty, m_osx, m_osy,
+					next_x, next_y);
+    m_drop_nx  = next_x;
+    m_drop_ny  = next_y;
+    m_drop_ang = angle;
+    if(angle < 90) {
+      m_marker_tail.dropAftMarker();
+      m_drop_reason = "two";
+      marker_dropped = true;
+    }
+  }
+
+  // Case 3: If aft marker was not captured, check if the aft marker
+  // should be dropped based on exceeding the max tail length.
+  if(!marker_dropped) {
+    string msg;
+    marker_dropped = m_marker_tail.checkDropAftMarker(msg);
+    m_drop_reason = msg;
+  }
+
+  if(marker_dropped) {
+    m_dropped_marker = aft_marker;
+    m_dropped_markers++;
+  }
+  return(marker_dropped);
+}
+
+//-----------------------------------------------------------
+// Procedure: handleNewContactSpd()
+//      Note: Maintains the 2 and 5 second averages of the
+//            contact speed.
+
+void ConvoyFollower::handleNewContactSpd(double cnv, double curr_time)
+{
+  m_cn_spd_value.push_front(cnv);
+  m_cn_spd_tstamp.push_front(curr_time);
+
+  // Part 1A: Ensure spd queue is no older than 5 secs.
+  while(!m_cn_spd_tstamp.empty() &&
+	((curr_time - m_cn_spd_tstamp.back()) > 5)) {
+    m_cn_spd_value.pop_back();
+    m_cn_spd_tstamp.pop_back();
+  }
+
+  // Part 1B: Get the 5 and 2 second averages in one pass. The
+  // queue is newest first so the 2 second window is a prefix.
+  double total_5sec = 0;
+  double total_2sec = 0;
+  unsigned int cnt_5sec = 0;
+  unsigned int cnt_2sec = 0;
+  list<double>::iterator p = m_cn_spd_value.begin();
+  list<double>::iterator q = m_cn_spd_tstamp.begin();
+  for(; p != m_cn_spd_value.end(); p++, q++) {
+    total_5sec += *p;
+    cnt_5sec++;
+    if((curr_time - *q) <= 2) {
+      total_2sec += *p;
+      cnt_2sec++;
+    }
+  }
+
+  if(cnt_5sec > 0)
+    m_cnv_avg_5sec = total_5sec / (double)(cnt_5sec);
+  if(cnt_2sec > 0)
+    m_cnv_avg_2sec = total_2sec / (double)(cnt_2sec);
+}
+
+//-----------------------------------------------------------
+// Procedure: updateSetSpeed()
+//      Note: Uses the convoy range of the previous iteration,
+//            as updateMetrics() is called after.
+
+void ConvoyFollower::updateSetSpeed()
+{
+  m_set_speed = m_spd_policy.getSpdFromPolicy(m_cnv_avg_2sec,
+					      m_contact_range,
+					      m_convoy_range);
+}
+
+//-----------------------------------------------------------
+// Procedure: updateMetrics()
+
+void ConvoyFollower::updateMetrics()
+{
+  // Part 1: Update direct raw metrics
+  m_tail_range = m_marker_tail.distToAftMarker(m_osx, m_osy);
+  m_tail_angle = m_marker_tail.tailAngle(m_osx, m_osy);
+  m_marker_bng = m_marker_tail.markerBearing(m_osx, m_osy, m_osh);
+  m_alignment  = m_tail_angle + m_marker_bng;
+
+  // Part 2: Convoy range is along the tail when there is one
+  if(m_marker_tail.size() == 0)
+    m_convoy_range = m_contact_range;
+  else
+    m_convoy_range = m_tail_range + m_marker_tail.getMarkerTailLen();
+
+  m_range_delta = m_convoy_range - m_spd_policy.getIdealConvoyRng();
+  if(m_range_delta < 0)
+    m_range_delta *= -1;
+
+  m_track_error = m_marker_tail.getTrackError(m_osx, m_osy);
+}
+
+//-----------------------------------------------------------
+// Procedure: setCurrentMarker()
+//      Note: Steer to the aft marker, or the contact if the
+//            tail is empty.
+
+void ConvoyFollower::setCurrentMarker()
+{
+  if(m_marker_tail.size() != 0) {
+    ConvoyMarker marker = m_marker_tail.getAftMarker();
+    m_wptx = marker.getX();
+    m_wpty = marker.getY();
+  }
+  else {
+    m_wptx = m_cnx;
+    m_wpty = m_cny;
+  }
+}
+
+//-----------------------------------------------------------
+// Procedure: holding()
+//   Returns: true if aft patience is enabled and ownship is closer
+//            to another part of the tail than the aft marker. The
+//            follower should then wait for the tail to evolve.
+
+bool ConvoyFollower::holding() const
+{
+  if(!m_aft_patience)
+    return(false);
+  return(!m_marker_tail.aftMarkerClosest(m_osx, m_osy));
+}
+
+//-----------------------------------------------------------
+// Procedure: buildRecap()
+//      Note: The vname, index and timestamp are left to the caller
+
+void ConvoyFollower::buildRecap(ConvoyRecap& recap) const
+{
+  recap.setConvoyRng(m_convoy_range);
+  recap.setConvoyRngDelta(m_range_delta);
+  recap.setTailRng(m_tail_range);
+  recap.setTailAng(m_tail_angle);
+  recap.setMarkerBng(m_marker_bng);
+  recap.setTrackErr(m_track_error);
+  recap.setAlignment(m_alignment);
+  recap.setSetSpd(m_set_speed);
+  recap.setAvg2(m_cnv_avg_2sec);
+  recap.setAvg5(m_cnv_avg_5sec);
+  recap.setCorrMode(m_spd_policy.getCorrectionMode());
+  recap.setTailCnt(m_marker_tail.size());
+
+  if(!m_marker_tail.empty()) {
+    ConvoyMarker marker = m_marker_tail.getAftMarker();
+    recap.setMarkerX(marker.getX());
+    recap.setMarkerY(marker.getY());
+    recap.setMarkerID(marker.getID());
+  }
+}
@@ -0,0 +1,144 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoyFollower.h                                     */
+/*    DATE: Oct 19th 2026, broken out of BHV_ConvoyV21X          */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef CONVOY_FOLLOWER_HEADER
+#define CONVOY_FOLLOWER_HEADER
+
+#include <string>
+#include <list>
+#include "MarkerTail.h"
+#include "ConvoyMarker.h"
+#include "ConvoySpdPolicy.h"
+#include "ConvoyRecap.h"
+
+//---------------------------------------------------------------
+// ConvoyFollower: the follower decision logic of BHV_ConvoyV21X,
+// with no helm or MOOS dependencies. It holds the marker tail,
+// the contact speed history, the speed policy and the convoy
+// metrics. The behavior and the convoysim agent both call it in
+// the same order each iteration:
+//
+//   setOwnship(), setContact(), checkDropAftMarker(),
+//   getMarkerTail().handleNewContactPos(), handleNewContactSpd(),
+//   updateSetSpeed(), updateMetrics(), setCurrentMarker()
+//
+// and then steer to the current marker at the set speed, unless
+// holding() is true.
+
+class ConvoyFollower
+{
+ public:
+  ConvoyFollower();
+  virtual ~ConvoyFollower() {}
+
+  bool setParam(std::string, std::string);
+  std::string checkParams();
+  void onParamsComplete(std::string vname);
+
+ public: // Per iteration updates
+  void   setOwnship(double osx, double osy, double osh);
+  void   setContact(double cnx, double cny, double cnh, double cnv);
+
+  bool   checkDropAftMarker();
+  void   handleNewContactSpd(double cnv, double curr_time);
+  void   updateSetSpeed();
+  void   updateMetrics();
+  void   setCurrentMarker();
+  bool   holding() const;
+
+  void   buildRecap(ConvoyRecap&) const;
+
+ public: // Getters
+  MarkerTail& getMarkerTail()             {return(m_marker_tail);}
+  const MarkerTail& getMarkerTail() const {return(m_marker_tail);}
+
+  ConvoySpdPolicy& getSpdPolicy()             {return(m_spd_policy);}
+  const ConvoySpdPolicy& getSpdPolicy() const {return(m_spd_policy);}
+  const ConvoySpdPolicy& getSpdPolicyBase() const
+  {return(m_spd_policy_base);}
+
+  double getWptX() const         {return(m_wptx);}
+  double getWptY() const         {return(m_wpty);}
+  double getSetSpeed() const     {return(m_set_speed);}
+  double getAvgSpd2() const      {return(m_cnv_avg_2sec);}
+  double getAvgSpd5() const      {return(m_cnv_avg_5sec);}
+  double getContactRange() const {return(m_contact_range);}
+  double getCompression() const  {return(m_compression);}
+  bool   getAftPatience() const  {return(m_aft_patience);}
+
+  double getConvoyRange() const  {return(m_convoy_range);}
+  double getRangeDelta() const   {return(m_range_delta);}
+  double getTailRange() const    {return(m_tail_range);}
+  double getTailAngle() const    {return(m_tail_angle);}
+  double getMarkerBng() const    {return(m_marker_bng);}
+  double getTrackError() const   {return(m_track_error);}
+  double getAlignment() const    {return(m_alignment);}
+
+  unsigned int getDroppedMarkers() const {return(m_dropped_markers);}
+
+ public: // Outcome of the latest checkDropAftMarker(), for debugging
+  ConvoyMarker getDroppedMarker() const {return(m_dropped_marker);}
+  std::string  getDropReason() const    {return(m_drop_reason);}
+  double       getDropDist() const      {return(m_drop_dist);}
+  double       getDropAngle() const     {return(m_drop_ang);}
+  double       getDropNextX() const     {return(m_drop_nx);}
+  double       getDropNextY() const     {return(m_drop_ny);}
+
+ protected: // Configuration variables
+  double m_capture_radius;
+  double m_slip_radius;
+  double m_compression;
+  bool   m_aft_patience;
+
+  ConvoySpdPolicy m_spd_policy_base;
+  ConvoySpdPolicy m_spd_policy;
+
+ protected: // State variables
+  MarkerTail m_marker_tail;
+
+  std::list<double> m_cn_spd_value;
+  std::list<double> m_cn_spd_tstamp;
+
+  double m_osx;
+  double m_osy;
+  double m_osh;
+  double m_cnx;
+  double m_cny;
+  double m_cnh;
+  double m_cnv;
+  double m_contact_range;
+
+  double m_wptx;
+  double m_wpty;
+  double m_set_speed;
+  double m_cnv_avg_2sec;
+  double m_cnv_avg_5sec;
+
+  ConvoyMarker m_dropped_marker;
+  std::string  m_drop_reason;
+  double       m_drop_dist;
+  double       m_drop_ang;
+  double       m_drop_nx;
+  double       m_drop_ny;
+
+ protected: // State variables (metrics)
+  double m_convoy_range;
+  double m_range_delta;
+  double m_tail_range;
+  double m_tail_angle;
+  double m_marker_bng;
+  double m_track_error;
+  double m_alignment;
+
+  unsigned int m_dropped_markers;
+};
+
+#endif
@@ -0,0 +1,200 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoyMarker.cpp                                     */
+/*    DATE: June 25th, 2021                                      */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cmath>
+#include <cstdlib>
+#include "ConvoyMarker.h"
+#include "ConvoyCodec.h"
+#include "ConvoyWire.h"
+#include "MBUtils.h"
+
+using namespace std;
+
+//-----------------------------------------------------------
+// Procedure: Constructor
+
+ConvoyMarker::ConvoyMarker()
+{
+  m_x = 0;
+  m_y = 0;
+  m_id  = 0;
+  m_set = false;
+  m_utc = 0;
+}
+
+//-----------------------------------------------------------
+// Procedure: Constructor
+
+ConvoyMarker::ConvoyMarker(double x, double y, unsigned int id)
+{
+  m_x = x;
+  m_y = y;
+  m_id  = id;
+  m_set = true;
+  m_utc = 0;
+}
+
+//-----------------------------------------------------------
+// Procedure: distToMarker()
+
+double ConvoyMarker::distToMarker(double x, double y) 
+{
+  return(hypot(m_x-x, m_y-y));
+}
+
+
+//-----------------------------------------------------------
+// Procedure: getSpec()
+
+string ConvoyMarker::getSpec(string vname) const 
+{
+  string spec;
+  writeSpec(spec, vname);
+  return(spec);
+}
+
+//-----------------------------------------------------------
+// Procedure: writeSpec()
+
+void ConvoyMarker::writeSpec(string& buf, const string& vname) const 
+{
+  ConvoyKVWriter writer(buf);
+  writer.addDoubleX("x", m_x);
+  writer.addDoubleX("y", m_y);
+  writer.addUInt("id", m_id);
+
+  if(vname != "")
+    writer.addString("vname", vname);
+  else if(m_vname != "")
+    writer.addString("vname", m_vname);
+  
+  if(m_utc > 0)
+    writer.addDouble("time", m_utc, 3);
+}
+
+//-----------------------------------------------------------
+// Procedure: getWireSpec()
+//      Note: Compact wire form. Position quantized to 0.01 and
+//            time to 0.001, the precision of the text form.
+
+string ConvoyMarker::getWireSpec(string vname,
+				 const ConvoyWireNames* names) const 
+{
+  if(vname == "")
+    vname = m_vname;
+
+  ConvoyWireWriter writer(CWIRE_MARKER, names);
+  writer.putFixed(m_x, 0.01);
+  writer.putFixed(m_y, 0.01);
+  writer.putUInt(m_id);
+  writer.putName(vname);
+  writer.putFixed(m_utc, 0.001);
+
+  if(!writer.ok())
+    return(getSpec(vname));
+  return(writer.getSpec());
+}
+
+//-----------------------------------------------------------
+// Procedure: wire2ConvoyMarker()
+
+static ConvoyMarker wire2ConvoyMarker(string_view msg,
+				      const ConvoyWireNames* names)
+{
+  ConvoyMarker null_marker;
+
+  ConvoyWireReader reader(msg, names);
+  if(reader.getType() != CWIRE_MARKER)
+    return(null_marker);
+
+  double x = reader.getFixed(0.01);
+  double y = reader.getFixed(0.01);
+  ConvoyMarker marker(x, y, reader.getUInt());
+  marker.setVName(reader.getName());
+  double utc = reader.getFixed(0.001);
+  if(utc > 0)
+    marker.setUTC(utc);
+
+  if(!reader.ok())
+    return(null_marker);
+  return(marker);
+}
+
+//-----------------------------------------------------------
+// Field table for string2ConvoyMarker()
+//      Note: Numeric fields are only accepted if the whole
+//            value is numeric. A marker is valid only if both
+//            x and y were given.
+
+struct MarkerFields {
+  MarkerFields() {x=0; y=0; x_set=false; y_set=false;}
+  double x;
+  double y;
+  bool   x_set;
+  bool   y_set;
+  ConvoyMarker marker;
+};
+
+typedef ConvoyKVField<MarkerFields> MarkerField;
+
+static void setMarkerUTC(MarkerFields& m, string_view v)
+{
+  double utc = 0;
+  if(kvToDouble(v, utc) && (utc > 0))
+    m.marker.setUTC(utc);
+}
+
+static void setMarkerID(MarkerFields& m, string_view v)
+{
+  double dval = 0;
+  if(!kvToDouble(v, dval))
+    return;
+
+  int int_id = (int)(dval);
+  unsigned int uint_id = 0;
+  if(int_id >= 0)
+    uint_id = (unsigned int)(int_id);
+  m.marker.setID(uint_id);
+}
+
+static const MarkerField marker_fields[] = {
+  {"x",     [](MarkerFields& m, string_view v) {m.x_set = kvToDouble(v, m.x) || m.x_set;}},
+  {"y",     [](MarkerFields& m, string_view v) {m.y_set = kvToDouble(v, m.y) || m.y_set;}},
+  {"id",    setMarkerID},
+  {"vname", [](MarkerFields& m, string_view v) {m.marker.setVName(string(v));}},
+  {"utc",   setMarkerUTC},
+  {"time",  setMarkerUTC}
+};
+
+//-----------------------------------------------------------
+// Procedure: string2ConvoyMarker()
+//      Note: Both "utc" and "time" are accepted for the time
+//            stamp, since getSpec() writes the latter.
+//      Note: Messages in the compact wire form are also accepted
+
+ConvoyMarker string2ConvoyMarker(string_view str,
+				 const ConvoyWireNames* names)
+{
+  if(isConvoyWire(str))
+    return(wire2ConvoyMarker(str, names));
+
+  MarkerFields fields;
+  kvDecode(str, fields, marker_fields);
+
+  if(fields.x_set && fields.y_set)
+    fields.marker.setXY(fields.x, fields.y);
+  
+  if(fields.marker.valid())
+    return(fields.marker);
+
+  ConvoyMarker null_marker;
+  return(null_marker);
+}
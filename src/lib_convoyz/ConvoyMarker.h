@@ -14,6 +14,9 @@
 #define CONVOY_MARKER
 
 #include <string>
+#include <string_view>
+
+class ConvoyWireNames;
 
 class ConvoyMarker {
 public:
@@ -37,6 +40,9 @@ public:
   bool valid() const {return(m_set);}
 
   std::string getSpec(std::string vname="") const;
+  void writeSpec(std::string& buf, const std::string& vname="") const;
+  std::string getWireSpec(std::string vname="",
+			  const ConvoyWireNames* names=0) const;
   
  private: 
   bool   m_set;
@@ -47,7 +53,8 @@ public:
   double m_utc;
 };
 
-ConvoyMarker string2ConvoyMarker(std::string);
+ConvoyMarker string2ConvoyMarker(std::string_view,
+				 const ConvoyWireNames* names=0);
 
 #endif
 
@@ -0,0 +1,125 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoyPDPolicy.cpp                                   */
+/*    DATE: Oct 19th 2026, broken out of BHV_ConvoyPD            */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cmath>
+#include <cstdlib>
+#include "ConvoyPDPolicy.h"
+#include "MBUtils.h"
+
+using namespace std;
+
+//-----------------------------------------------------------
+// Constructor()
+
+ConvoyPDPolicy::ConvoyPDPolicy()
+{
+  // Config variables
+  m_desired_spd       = 1.2;  // meters per second
+  m_ideal_follow_rng  = 5;    // meters
+  m_point_update_dist = 1;    // meters
+  m_capture_radius    = 3;    // meters
+  m_max_spd           = 2;    // meters per second
+
+  m_kp_spd = 0;
+  m_kd_spd = 0;
+  m_ki_spd = 0;
+
+  // State variables
+  m_prev_set = false;
+  m_prev_x   = 0;
+  m_prev_y   = 0;
+  m_interval_odo = 0;
+}
+
+//-----------------------------------------------------------
+// Procedure: setParam()
+//      Note: Same param names as BHV_ConvoyPD
+
+bool ConvoyPDPolicy::setParam(string param, string value)
+{
+  param = tolower(param);
+  value = stripBlankEnds(value);
+  if(!isNumber(value))
+    return(false);
+
+  double dval = atof(value.c_str());
+  if(param == "desired_speed")
+    m_desired_spd = dval;
+  else if(param == "ideal_follow_range")
+    m_ideal_follow_rng = dval;
+  else if(param == "point_update_distance")
+    m_point_update_dist = dval;
+  else if(param == "kp_spd")
+    m_kp_spd = dval;
+  else if(param == "kd_spd")
+    m_kd_spd = dval;
+  else if(param == "ki_spd")
+    m_ki_spd = dval;
+  else
+    return(false);
+
+  return(true);
+}
+
+//-----------------------------------------------------------
+// Procedure: seedPoint()
+//   Returns: true if the leader should seed a new lead point at
+//            its present position. Movement under 1cm per call
+//            is ignored as jitter.
+
+bool ConvoyPDPolicy::seedPoint(double osx, double osy)
+{
+  if(!m_prev_set) {
+    m_prev_x = osx;
+    m_prev_y = osy;
+    m_prev_set = true;
+    return(false);
+  }
+
+  double dist = hypot(osx - m_prev_x, osy - m_prev_y);
+  if(dist > 0.01) {
+    m_prev_x = osx;
+    m_prev_y = osy;
+    m_interval_odo += dist;
+  }
+
+  if(m_interval_odo < m_point_update_dist)
+    return(false);
+
+  m_interval_odo = 0;
+  return(true);
+}
+
+//-----------------------------------------------------------
+// Procedure: pointCaptured()
+
+bool ConvoyPDPolicy::pointCaptured(double osx, double osy,
+				   double ptx, double pty) const
+{
+  return(hypot(ptx - osx, pty - osy) < m_capture_radius);
+}
+
+//-----------------------------------------------------------
+// Procedure: getSpdFromPolicy()
+//      Note: A positive range error, i.e., further back than the
+//            ideal, and a leader faster than ownship both call
+//            for more speed.
+
+double ConvoyPDPolicy::getSpdFromPolicy(double dist_to_target,
+					double leader_spd,
+					double os_spd) const
+{
+  double dist_err = dist_to_target - m_ideal_follow_rng;
+  double spd_err  = leader_spd - os_spd;
+
+  double spd = m_desired_spd + (m_kp_spd * dist_err) + (m_kd_spd * spd_err);
+  return(vclip(spd, 0, m_max_spd));
+}
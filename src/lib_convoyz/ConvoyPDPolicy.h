@@ -0,0 +1,75 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoyPDPolicy.h                                     */
+/*    DATE: Oct 19th 2026, broken out of BHV_ConvoyPD            */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef CONVOY_PD_POLICY_HEADER
+#define CONVOY_PD_POLICY_HEADER
+
+#include <string>
+
+//---------------------------------------------------------------
+// ConvoyPDPolicy: the control law of BHV_ConvoyPD, with no helm
+// or MOOS dependencies. The leader seeds a lead point each time
+// its odometry since the last point reaches the update distance.
+// A follower steers to the oldest point in its queue, drops it
+// when within the capture radius (passing it on to its own
+// follower), and sets its speed with a PD law on the distance
+// along the queue to its contact:
+//
+//   spd = desired + kp * (dist - ideal) + kd * (leader_spd - spd)
+//
+// clipped to [0, max_spd].
+
+class ConvoyPDPolicy
+{
+ public:
+  ConvoyPDPolicy();
+  virtual ~ConvoyPDPolicy() {}
+
+  bool setParam(std::string, std::string);
+
+  void setDesiredSpd(double v)     {m_desired_spd=v;}
+  void setPointUpdateDist(double v){m_point_update_dist=v;}
+
+ public: // Leader side
+  bool seedPoint(double osx, double osy);
+
+ public: // Follower side
+  bool   pointCaptured(double osx, double osy,
+		       double ptx, double pty) const;
+  double getSpdFromPolicy(double dist_to_target,
+			  double leader_spd, double os_spd) const;
+
+ public: // Getters
+  double getDesiredSpd() const      {return(m_desired_spd);}
+  double getIdealFollowRng() const  {return(m_ideal_follow_rng);}
+  double getPointUpdateDist() const {return(m_point_update_dist);}
+  double getCaptureRadius() const   {return(m_capture_radius);}
+  double getMaxSpd() const          {return(m_max_spd);}
+
+ protected: // Configuration variables
+  double m_desired_spd;
+  double m_ideal_follow_rng;
+  double m_point_update_dist;
+  double m_capture_radius;
+  double m_max_spd;
+
+  double m_kp_spd;
+  double m_kd_spd;
+  double m_ki_spd;  // Accepted, not yet used by the law
+
+ protected: // State variables (leader side)
+  bool   m_prev_set;
+  double m_prev_x;
+  double m_prev_y;
+  double m_interval_odo;
+};
+
+#endif
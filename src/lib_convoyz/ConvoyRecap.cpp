@@ -10,6 +10,8 @@
 /*****************************************************************/
 
 #include "ConvoyRecap.h"
+#include "ConvoyCodec.h"
+#include "ConvoyWire.h"
 #include "MBUtils.h"
 
 using namespace std;
@@ -80,117 +82,230 @@ string ConvoyRecap::getStringValue(string key) const
 
 string ConvoyRecap::getSpec() const
 {
-  string str = "convoy_rng=" + doubleToString(m_convoy_rng,2);
+  string str;
+  writeSpec(str);
+  return(str);
+}
+
+//------------------------------------------------------------
+// Procedure: writeSpec()
+//      Note: Writes into the given buffer, replacing its contents.
+//            Callers serializing at a high rate may reuse the
+//            buffer to avoid reallocation.
+
+void ConvoyRecap::writeSpec(string& buf) const
+{
+  ConvoyKVWriter writer(buf);
+  writer.addDouble("convoy_rng", m_convoy_rng);
 
   if(isSetVName())
-    str += ",vname=" + m_vname;
+    writer.addString("vname", m_vname);
   if(isSetCName())
-    str += ",cname=" + m_cname;
+    writer.addString("cname", m_cname);
 
   if(m_idle) {
-    str += ",idle=true";
-    return(str);
+    writer.addString("idle", "true");
+    return;
   }
 
   if(isSetConvoyRngDelta())
-    str += ",rng_delta=" + doubleToString(m_convoy_rng_delta,2);
+    writer.addDouble("rng_delta", m_convoy_rng_delta);
 
   if(isSetTailRng())
-    str += ",tail_rng=" + doubleToString(m_tail_rng,2);
+    writer.addDouble("tail_rng", m_tail_rng);
   if(isSetTailAng())
-    str += ",tail_ang=" + doubleToString(m_tail_ang,2);
+    writer.addDouble("tail_ang", m_tail_ang);
   if(isSetMarkerBng())
-    str += ",mark_bng=" + doubleToString(m_mark_bng,2);
+    writer.addDouble("mark_bng", m_mark_bng);
   if(isSetMarkerBng())
-    str += ",trk_err=" + doubleToString(m_track_err,2);
+    writer.addDouble("trk_err", m_track_err);
   if(isSetAlignment())
-    str += ",almnt=" + doubleToString(m_alignment,2);
+    writer.addDouble("almnt", m_alignment);
 
   if(isSetSetSpd())
-    str += ",set_spd=" + doubleToString(m_set_spd,2);
+    writer.addDouble("set_spd", m_set_spd);
   if(isSetAvg2())
-    str += ",cnv_avg2=" + doubleToString(m_cnv_avg2,2);
+    writer.addDouble("cnv_avg2", m_cnv_avg2);
   if(isSetAvg5())
-    str += ",cnv_avg5=" + doubleToString(m_cnv_avg5,2);
+    writer.addDouble("cnv_avg5", m_cnv_avg5);
   if(isSetCorrMode())
-    str += ",cmode=" + m_correction_mode;
+    writer.addString("cmode", m_correction_mode);
 
   if(isSetTimeUTC())
-    str += ",utc=" + doubleToStringX(m_time_utc,3);
+    writer.addDoubleX("utc", m_time_utc, 3);
   if(isSetMarkerX())
-    str += ",mx=" + doubleToString(m_marker_x,2);
+    writer.addDouble("mx", m_marker_x);
   if(isSetMarkerY())
-    str += ",my=" + doubleToString(m_marker_y,2);
+    writer.addDouble("my", m_marker_y);
   if(isSetMarkerID())
-    str += ",mid=" + uintToString(m_marker_id);
+    writer.addUInt("mid", m_marker_id);
   if(isSetTailCnt())
-    str += ",tail_cnt=" + uintToString(m_tail_cnt);
+    writer.addUInt("tail_cnt", m_tail_cnt);
   if(isSetIndex())
-    str += ",index=" + uintToString(m_index);
-    
-  return(str);
+    writer.addUInt("index", m_index);
+}
+
+//------------------------------------------------------------
+// Compact wire form. A presence mask says which of the optional
+// fields follow, mirroring exactly what getSpec() would write.
+// Ranges and angles are quantized to the 0.01 precision of the
+// text form, the time stamp to 0.001.
+
+enum {RB_VNAME=0, RB_CNAME, RB_IDLE, RB_RNG_DELTA, RB_TAIL_RNG,
+      RB_TAIL_ANG, RB_MARK_BNG, RB_ALMNT, RB_SET_SPD, RB_AVG2,
+      RB_AVG5, RB_CMODE, RB_UTC, RB_MX, RB_MY, RB_MID, RB_TAIL_CNT,
+      RB_INDEX};
+
+static const double recap_res = 0.01;
+static const double recap_utc_res = 0.001;
+
+//------------------------------------------------------------
+// Procedure: getWireSpec()
+//      Note: Falls back to the text form if any value cannot
+//            be represented in the compact form.
+
+string ConvoyRecap::getWireSpec(const ConvoyWireNames* names) const
+{
+  unsigned long long mask = 0;
+  if(isSetVName())
+    mask |= (1ull << RB_VNAME);
+  if(isSetCName())
+    mask |= (1ull << RB_CNAME);
+  if(m_idle)
+    mask |= (1ull << RB_IDLE);
+  else {
+    if(isSetConvoyRngDelta()) mask |= (1ull << RB_RNG_DELTA);
+    if(isSetTailRng())        mask |= (1ull << RB_TAIL_RNG);
+    if(isSetTailAng())        mask |= (1ull << RB_TAIL_ANG);
+    if(isSetMarkerBng())      mask |= (1ull << RB_MARK_BNG);
+    if(isSetAlignment())      mask |= (1ull << RB_ALMNT);
+    if(isSetSetSpd())         mask |= (1ull << RB_SET_SPD);
+    if(isSetAvg2())           mask |= (1ull << RB_AVG2);
+    if(isSetAvg5())           mask |= (1ull << RB_AVG5);
+    if(isSetCorrMode())       mask |= (1ull << RB_CMODE);
+    if(isSetTimeUTC())        mask |= (1ull << RB_UTC);
+    if(isSetMarkerX())        mask |= (1ull << RB_MX);
+    if(isSetMarkerY())        mask |= (1ull << RB_MY);
+    if(isSetMarkerID())       mask |= (1ull << RB_MID);
+    if(isSetTailCnt())        mask |= (1ull << RB_TAIL_CNT);
+    if(isSetIndex())          mask |= (1ull << RB_INDEX);
+  }
+
+  ConvoyWireWriter writer(CWIRE_RECAP, names);
+  writer.putUInt(mask);
+  writer.putFixed(m_convoy_rng, recap_res);
+  if(mask & (1ull << RB_VNAME))     writer.putName(m_vname);
+  if(mask & (1ull << RB_CNAME))     writer.putName(m_cname);
+  if(mask & (1ull << RB_RNG_DELTA)) writer.putFixed(m_convoy_rng_delta, recap_res);
+  if(mask & (1ull << RB_TAIL_RNG))  writer.putFixed(m_tail_rng, recap_res);
+  if(mask & (1ull << RB_TAIL_ANG))  writer.putFixed(m_tail_ang, recap_res);
+  if(mask & (1ull << RB_MARK_BNG)) {
+    writer.putFixed(m_mark_bng, recap_res);
+    writer.putFixed(m_track_err, recap_res);
+  }
+  if(mask & (1ull << RB_ALMNT))     writer.putFixed(m_alignment, recap_res);
+  if(mask & (1ull << RB_SET_SPD))   writer.putFixed(m_set_spd, recap_res);
+  if(mask & (1ull << RB_AVG2))      writer.putFixed(m_cnv_avg2, recap_res);
+  if(mask & (1ull << RB_AVG5))      writer.putFixed(m_cnv_avg5, recap_res);
+  if(mask & (1ull << RB_CMODE))     writer.putString(m_correction_mode);
+  if(mask & (1ull << RB_UTC))       writer.putFixed(m_time_utc, recap_utc_res);
+  if(mask & (1ull << RB_MX))        writer.putFixed(m_marker_x, recap_res);
+  if(mask & (1ull << RB_MY))        writer.putFixed(m_marker_y, recap_res);
+  if(mask & (1ull << RB_MID))       writer.putUInt(m_marker_id);
+  if(mask & (1ull << RB_TAIL_CNT))  writer.putUInt(m_tail_cnt);
+  if(mask & (1ull << RB_INDEX))     writer.putUInt(m_index);
+
+  if(!writer.ok())
+    return(getSpec());
+  return(writer.getSpec());
+}
+
+//------------------------------------------------------------
+// Procedure: wire2ConvoyRecap()
+
+static ConvoyRecap wire2ConvoyRecap(string_view msg,
+				    const ConvoyWireNames* names)
+{
+  ConvoyRecap recap;
+
+  ConvoyWireReader reader(msg, names);
+  if(reader.getType() != CWIRE_RECAP)
+    return(recap);
+  
+  unsigned long long mask = reader.getUInt();
+  recap.setConvoyRng(reader.getFixed(recap_res));
+  if(mask & (1ull << RB_VNAME))     recap.setVName(reader.getName());
+  if(mask & (1ull << RB_CNAME))     recap.setCName(reader.getName());
+  if(mask & (1ull << RB_IDLE))      recap.setIdle(true);
+  if(mask & (1ull << RB_RNG_DELTA)) recap.setConvoyRngDelta(reader.getFixed(recap_res));
+  if(mask & (1ull << RB_TAIL_RNG))  recap.setTailRng(reader.getFixed(recap_res));
+  if(mask & (1ull << RB_TAIL_ANG))  recap.setTailAng(reader.getFixed(recap_res));
+  if(mask & (1ull << RB_MARK_BNG)) {
+    recap.setMarkerBng(reader.getFixed(recap_res));
+    recap.setTrackErr(reader.getFixed(recap_res));
+  }
+  if(mask & (1ull << RB_ALMNT))     recap.setAlignment(reader.getFixed(recap_res));
+  if(mask & (1ull << RB_SET_SPD))   recap.setSetSpd(reader.getFixed(recap_res));
+  if(mask & (1ull << RB_AVG2))      recap.setAvg2(reader.getFixed(recap_res));
+  if(mask & (1ull << RB_AVG5))      recap.setAvg5(reader.getFixed(recap_res));
+  if(mask & (1ull << RB_CMODE))     recap.setCorrMode(reader.getString());
+  if(mask & (1ull << RB_UTC))       recap.setTimeUTC(reader.getFixed(recap_utc_res));
+  if(mask & (1ull << RB_MX))        recap.setMarkerX(reader.getFixed(recap_res));
+  if(mask & (1ull << RB_MY))        recap.setMarkerY(reader.getFixed(recap_res));
+  if(mask & (1ull << RB_MID))       recap.setMarkerID(reader.getUInt());
+  if(mask & (1ull << RB_TAIL_CNT))  recap.setTailCnt(reader.getUInt());
+  if(mask & (1ull << RB_INDEX))     recap.setIndex(reader.getUInt());
+
+  if(!reader.ok()) {
+    ConvoyRecap null_recap;
+    return(null_recap);
+  }
+  return(recap);
 }
 
 //---------------------------------------------------------
-// Procedure: string2MissionTask()
+// Field table for string2ConvoyRecap()
+
+typedef ConvoyKVField<ConvoyRecap> RecapField;
+
+static const RecapField recap_fields[] = {
+  {"convoy_rng", [](ConvoyRecap& r, string_view v) {r.setConvoyRng(kvToDouble(v));}},
+  {"vname",      [](ConvoyRecap& r, string_view v) {r.setVName(string(v));}},
+  {"cname",      [](ConvoyRecap& r, string_view v) {r.setCName(string(v));}},
+  {"rng_delta",  [](ConvoyRecap& r, string_view v) {r.setConvoyRngDelta(kvToDouble(v));}},
+  {"tail_rng",   [](ConvoyRecap& r, string_view v) {r.setTailRng(kvToDouble(v));}},
+  {"tail_ang",   [](ConvoyRecap& r, string_view v) {r.setTailAng(kvToDouble(v));}},
+  {"mark_bng",   [](ConvoyRecap& r, string_view v) {r.setMarkerBng(kvToDouble(v));}},
+  {"trk_err",    [](ConvoyRecap& r, string_view v) {r.setTrackErr(kvToDouble(v));}},
+  {"almnt",      [](ConvoyRecap& r, string_view v) {r.setAlignment(kvToDouble(v));}},
+  {"set_spd",    [](ConvoyRecap& r, string_view v) {r.setSetSpd(kvToDouble(v));}},
+  {"cnv_avg2",   [](ConvoyRecap& r, string_view v) {r.setAvg2(kvToDouble(v));}},
+  {"cnv_avg5",   [](ConvoyRecap& r, string_view v) {r.setAvg5(kvToDouble(v));}},
+  {"cmode",      [](ConvoyRecap& r, string_view v) {r.setCorrMode(string(v));}},
+  {"mx",         [](ConvoyRecap& r, string_view v) {r.setMarkerX(kvToDouble(v));}},
+  {"my",         [](ConvoyRecap& r, string_view v) {r.setMarkerY(kvToDouble(v));}},
+  {"idle",       [](ConvoyRecap& r, string_view v) {r.setIdle(kvIsTrue(v));}},
+  {"mid",        [](ConvoyRecap& r, string_view v) {r.setMarkerID((unsigned int)(kvToDouble(v)));}},
+  {"tail_cnt",   [](ConvoyRecap& r, string_view v) {r.setTailCnt((unsigned int)(kvToDouble(v)));}},
+  {"index",      [](ConvoyRecap& r, string_view v) {r.setIndex((unsigned int)(kvToDouble(v)));}},
+  {"utc",        [](ConvoyRecap& r, string_view v) {r.setTimeUTC(kvToDouble(v));}}
+};
+
+//---------------------------------------------------------
+// Procedure: string2ConvoyRecap()
 //   Example: convoy_rng=17.4,rng_delta=-7.5,tail_rng=4.5,tail_ang=3.44,
 //            mark_bng=46.41,trk_err=1.8,almnt=49.84,set_spd=0.661,
 //            cnv_avg2=0.905,cnv_avg5=0.867,cmode=close,mx=30.6,
 //            my=-11.8,mid=0,tail_cnt=6,index=390
+//      Note: Messages in the compact wire form are also accepted
 
-ConvoyRecap string2ConvoyRecap(string msg)
+ConvoyRecap string2ConvoyRecap(string_view msg,
+			       const ConvoyWireNames* names)
 {
-  ConvoyRecap new_recap;
-
-  vector<string> svector = parseString(msg, ',');
-  for(unsigned int i=0; i<svector.size(); i++) {
-    string param = biteStringX(svector[i], '=');
-    string value = svector[i];
-    double dval  = atof(value.c_str());
-    
-    if(param == "vname")
-      new_recap.setVName(value);
-    else if(param == "cname")
-      new_recap.setCName(value);
-    else if(param == "convoy_rng")
-      new_recap.setConvoyRng(dval);
-    else if(param == "rng_delta")
-      new_recap.setConvoyRngDelta(dval);
-    else if(param == "tail_rng")
-      new_recap.setTailRng(dval);
-    else if(param == "tail_ang")
-      new_recap.setTailAng(dval);
-    else if(param == "mark_bng")
-      new_recap.setMarkerBng(dval);
-    else if(param == "trk_err")
-      new_recap.setTrackErr(dval);
-    else if(param == "almnt")
-      new_recap.setAlignment(dval);
-    else if(param == "set_spd")
-      new_recap.setSetSpd(dval);
-    else if(param == "cnv_avg2")
-      new_recap.setAvg2(dval);
-    else if(param == "cnv_avg5")
-      new_recap.setAvg5(dval);
-    else if(param == "cmode")
-      new_recap.setCorrMode(value);
-    else if(param == "mx")
-      new_recap.setMarkerX(dval);
-    else if(param == "my")
-      new_recap.setMarkerY(dval);
-    else if(param == "idle")
-      new_recap.setIdle(tolower(value) == "true");
-    else if(param == "mid")
-      new_recap.setMarkerID((unsigned int)(dval));
-    else if(param == "tail_cnt")
-      new_recap.setTailCnt((unsigned int)(dval));
-    else if(param == "index")
-      new_recap.setIndex((unsigned int)(dval));
-    else if(param == "utc")
-      new_recap.setTimeUTC(dval);
-  }
+  if(isConvoyWire(msg))
+    return(wire2ConvoyRecap(msg, names));
 
+  ConvoyRecap new_recap;
+  kvDecode(msg, new_recap, recap_fields);
   return(new_recap);
 }
-
-
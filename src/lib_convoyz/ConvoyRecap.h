@@ -13,9 +13,12 @@
 #define CONVOY_RECAP_HEADER
 
 #include <string>
+#include <string_view>
 #include <map>
 #include <stdlib.h>  // atof()
 
+class ConvoyWireNames;
+
 class ConvoyRecap
 {
  public:
@@ -99,6 +102,8 @@ class ConvoyRecap
   // Serialization
   std::string getStringValue(std::string key) const;
   std::string getSpec() const;
+  void        writeSpec(std::string&) const;
+  std::string getWireSpec(const ConvoyWireNames* names=0) const;
 
  protected: 
   double m_convoy_rng;
@@ -133,7 +138,8 @@ class ConvoyRecap
   bool m_idle;
 };
 
-ConvoyRecap string2ConvoyRecap(std::string);
+ConvoyRecap string2ConvoyRecap(std::string_view,
+			       const ConvoyWireNames* names=0);
 
 #endif 
 
@@ -10,6 +10,8 @@
 /*****************************************************************/
 
 #include "ConvoySpdPolicy.h"
+#include "ConvoyCodec.h"
+#include "ConvoyWire.h"
 #include "MBUtils.h"
 
 using namespace std;
@@ -28,7 +30,7 @@ ConvoySpdPolicy::ConvoySpdPolicy()
   m_max_compression = 0.9;
   m_lag_speed_delta = -1;
 
-  m_correction_mode = "unset";
+  m_corr_mode = CMODE_UNSET;
 }
 
 //-----------------------------------------------------------
@@ -172,13 +174,13 @@ double ConvoySpdPolicy::getSpdFromPolicy(double lead_speed,
 {
   // Case 1 Full stop now
   if(contact_rng <= m_full_stop_convoy_rng) {
-    m_correction_mode = "full_stop";
+    m_corr_mode = CMODE_FULL_STOP;
     return(0);
   }
 
   // Case 2 Slower proportionally
   if(convoy_rng <= m_slower_convoy_rng) {
-    m_correction_mode = "close";
+    m_corr_mode = CMODE_CLOSE;
     double span = m_slower_convoy_rng - m_full_stop_convoy_rng;
     if(span <= 0)
       return(0);
@@ -189,19 +191,19 @@ double ConvoySpdPolicy::getSpdFromPolicy(double lead_speed,
 
   // Case 3 and 4 Match contact speed
   if(convoy_rng <= m_ideal_convoy_rng) {
-    m_correction_mode = "ideal_close";
+    m_corr_mode = CMODE_IDEAL_CLOSE;
     return(lead_speed);
   }
 
   // Case 3 and 4 Match contact speed
   if(convoy_rng <= m_faster_convoy_rng) {
-    m_correction_mode = "ideal_far";
+    m_corr_mode = CMODE_IDEAL_FAR;
     return(lead_speed);
   }
 
   // Case 5 Speed up proportionally
   if(convoy_rng <= m_full_lag_convoy_rng) {
-    m_correction_mode = "far";
+    m_corr_mode = CMODE_FAR;
     double span = m_full_lag_convoy_rng - m_faster_convoy_rng;
     if(span <= 0)
       return(lead_speed);
@@ -212,11 +214,105 @@ double ConvoySpdPolicy::getSpdFromPolicy(double lead_speed,
   }
 
   // Case 6 Speed up as much as allowable
-  m_correction_mode = "full_lag";
+  m_corr_mode = CMODE_FULL_LAG;
   double full_lag_speed = lead_speed + m_lag_speed_delta;
   return(full_lag_speed);      
 }
 
+//-----------------------------------------------------------
+// Procedure: getSpdFromPolicy()  (batch)
+//   Purpose: Same policy as the scalar version, applied to arrays
+//            of samples, e.g., when replaying logged missions to
+//            tune range bands or compression.
+//      Note: The loop body selects the region arithmetically,
+//            rather than with the early-return cascade, so the
+//            compiler can vectorize it. This relies on the range
+//            bands being ordered, as guaranteed by status() and
+//            compress(). Otherwise the scalar path is used.
+
+void ConvoySpdPolicy::getSpdFromPolicy(const double* lead_spd,
+				       const double* contact_rng,
+				       const double* convoy_rng,
+				       double* spd, ConvoyCorrMode* modes,
+				       size_t count) const
+{
+  const double fstop  = m_full_stop_convoy_rng;
+  const double slower = m_slower_convoy_rng;
+  const double ideal  = m_ideal_convoy_rng;
+  const double faster = m_faster_convoy_rng;
+  const double lag    = m_full_lag_convoy_rng;
+  const double delta  = m_lag_speed_delta;
+
+  bool ordered = ((fstop <= slower) && (slower <= ideal) &&
+		  (ideal <= faster) && (faster <= lag));
+  if(!ordered) {
+    ConvoySpdPolicy policy = *this;
+    for(size_t i=0; i<count; i++) {
+      spd[i] = policy.getSpdFromPolicy(lead_spd[i], contact_rng[i],
+				       convoy_rng[i]);
+      if(modes)
+	modes[i] = policy.getCorrModeEnum();
+    }
+    return;
+  }
+
+  // A zero-width band yields the same result as the scalar
+  // version: zero speed when close, lead speed when far.
+  const double inv_slow_span = (slower > fstop) ? 1 / (slower - fstop) : 0;
+  const double inv_fast_span = (lag > faster) ? 1 / (lag - faster) : 0;
+
+  for(size_t i=0; i<count; i++) {
+    const double lead = lead_spd[i];
+    const double rng  = convoy_rng[i];
+
+    const double close_spd = (rng - fstop) * inv_slow_span * lead;
+    const double far_spd   = lead + (rng - faster) * inv_fast_span * delta;
+    const double lag_spd   = lead + delta;
+
+    double val = lag_spd;
+    val = (rng <= lag)    ? far_spd   : val;
+    val = (rng <= faster) ? lead      : val;
+    val = (rng <= slower) ? close_spd : val;
+    val = (contact_rng[i] <= fstop) ? 0 : val;
+    spd[i] = val;
+  }
+
+  if(!modes)
+    return;
+  for(size_t i=0; i<count; i++) {
+    const double rng = convoy_rng[i];
+    int bands = (rng <= slower) + (rng <= ideal) + (rng <= faster) + (rng <= lag);
+    int mode  = CMODE_FULL_LAG - bands;
+    mode = (contact_rng[i] <= fstop) ? (int)(CMODE_FULL_STOP) : mode;
+    modes[i] = (ConvoyCorrMode)(mode);
+  }
+}
+
+//-----------------------------------------------------------
+// Procedure: getSpdFromPolicy()  (batch, vectors)
+//      Note: Inputs are truncated to the shortest of the three
+
+void ConvoySpdPolicy::getSpdFromPolicy(const vector<double>& lead_spd,
+				       const vector<double>& contact_rng,
+				       const vector<double>& convoy_rng,
+				       vector<double>& spd,
+				       vector<ConvoyCorrMode>& modes) const
+{
+  size_t count = lead_spd.size();
+  if(contact_rng.size() < count)
+    count = contact_rng.size();
+  if(convoy_rng.size() < count)
+    count = convoy_rng.size();
+
+  spd.resize(count);
+  modes.resize(count);
+  if(count == 0)
+    return;
+  
+  getSpdFromPolicy(lead_spd.data(), contact_rng.data(), convoy_rng.data(),
+		   spd.data(), modes.data(), count);
+}
+
 //-----------------------------------------------------------
 // Procedure: compress()
 
@@ -284,58 +380,147 @@ bool ConvoySpdPolicy::atIdealConvoyRng(double convoy_rng)
 
 string ConvoySpdPolicy::getSpec() const
 {
-  string spec = "full_stop_rng=" + doubleToStringX(m_full_stop_convoy_rng,2);
+  string spec;
+  writeSpec(spec);
+  return(spec);
+}
+
+//-----------------------------------------------------------
+// Procedure: writeSpec()
+
+void ConvoySpdPolicy::writeSpec(string& buf) const
+{
+  ConvoyKVWriter writer(buf);
+  writer.addDoubleX("full_stop_rng", m_full_stop_convoy_rng);
 
   if(m_vname != "")
-    spec += ",vname=" + m_vname;
+    writer.addString("vname", m_vname);
   
-  spec += ",slower_rng=" + doubleToStringX(m_slower_convoy_rng,2);
-  spec += ",ideal_rng=" + doubleToStringX(m_ideal_convoy_rng,2);
-  spec += ",faster_rng=" + doubleToStringX(m_faster_convoy_rng,2);
-  spec += ",full_lag_rng=" + doubleToStringX(m_full_lag_convoy_rng,2);
-  spec += ",lag_spd_delta=" + doubleToStringX(m_lag_speed_delta,2);
-  spec += ",max_compress=" + doubleToStringX(m_max_compression,2);
+  writer.addDoubleX("slower_rng", m_slower_convoy_rng);
+  writer.addDoubleX("ideal_rng", m_ideal_convoy_rng);
+  writer.addDoubleX("faster_rng", m_faster_convoy_rng);
+  writer.addDoubleX("full_lag_rng", m_full_lag_convoy_rng);
+  writer.addDoubleX("lag_spd_delta", m_lag_speed_delta);
+  writer.addDoubleX("max_compress", m_max_compression);
 
   if(m_policy_name != "")
-    spec += ",name=" + m_policy_name;
-  
-  return(spec);
+    writer.addString("name", m_policy_name);
 }
 
 //-----------------------------------------------------------
-// Procedure: string2ConvoySpdPolicy()
+// Compact wire form: the range bands and speed delta quantized
+// to the 0.01 precision of the text form.
 
-ConvoySpdPolicy string2ConvoySpdPolicy(string msg)
+enum {PB_VNAME=0, PB_NAME};
+
+static const double spd_policy_res = 0.01;
+
+//-----------------------------------------------------------
+// Procedure: getWireSpec()
+
+string ConvoySpdPolicy::getWireSpec(const ConvoyWireNames* names) const
 {
-  ConvoySpdPolicy new_policy;
+  unsigned long long mask = 0;
+  if(m_vname != "")
+    mask |= (1ull << PB_VNAME);
+  if(m_policy_name != "")
+    mask |= (1ull << PB_NAME);
+
+  ConvoyWireWriter writer(CWIRE_SPD_POLICY, names);
+  writer.putUInt(mask);
+  writer.putFixed(m_full_stop_convoy_rng, spd_policy_res);
+  writer.putFixed(m_slower_convoy_rng, spd_policy_res);
+  writer.putFixed(m_ideal_convoy_rng, spd_policy_res);
+  writer.putFixed(m_faster_convoy_rng, spd_policy_res);
+  writer.putFixed(m_full_lag_convoy_rng, spd_policy_res);
+  writer.putFixed(m_lag_speed_delta, spd_policy_res);
+  writer.putFixed(m_max_compression, spd_policy_res);
+  if(mask & (1ull << PB_VNAME))
+    writer.putName(m_vname);
+  if(mask & (1ull << PB_NAME))
+    writer.putString(m_policy_name);
+
+  if(!writer.ok())
+    return(getSpec());
+  return(writer.getSpec());
+}
+
+//-----------------------------------------------------------
+// Procedure: wire2ConvoySpdPolicy()
 
-  vector<string> svector = parseString(msg, ',');
-  for(unsigned int i=0; i<svector.size(); i++) {
-    string param = biteStringX(svector[i], '=');
-    string value = svector[i];
-    double dval = atof(value.c_str());
-    
-    if(param == "vname")
-      new_policy.setVName(value);
-    else if(param == "full_stop_rng")
-      new_policy.setFullStopConvoyRng(dval);
-    else if(param == "slower_rng")
-      new_policy.setSlowerConvoyRng(dval);
-    else if(param == "ideal_rng")
-      new_policy.setIdealConvoyRng(dval);
-    else if(param == "faster_rng")
-      new_policy.setFasterConvoyRng(dval);
-    else if(param == "full_lag_rng")
-      new_policy.setFullLagConvoyRng(dval);
-    else if(param == "lag_spd_delta")
-      new_policy.setLagSpeedDelta(dval);
-    else if(param == "max_compress")
-      new_policy.setMaxCompression(dval);
-    else if(param == "name")
-      new_policy.setPolicyName(value);
+static ConvoySpdPolicy wire2ConvoySpdPolicy(string_view msg,
+					    const ConvoyWireNames* names)
+{
+  ConvoySpdPolicy policy;
+
+  ConvoyWireReader reader(msg, names);
+  if(reader.getType() != CWIRE_SPD_POLICY)
+    return(policy);
+
+  unsigned long long mask = reader.getUInt();
+  policy.setFullStopConvoyRng(reader.getFixed(spd_policy_res));
+  policy.setSlowerConvoyRng(reader.getFixed(spd_policy_res));
+  policy.setIdealConvoyRng(reader.getFixed(spd_policy_res));
+  policy.setFasterConvoyRng(reader.getFixed(spd_policy_res));
+  policy.setFullLagConvoyRng(reader.getFixed(spd_policy_res));
+  policy.setLagSpeedDelta(reader.getFixed(spd_policy_res));
+  policy.setMaxCompression(reader.getFixed(spd_policy_res));
+  if(mask & (1ull << PB_VNAME))
+    policy.setVName(reader.getName());
+  if(mask & (1ull << PB_NAME))
+    policy.setPolicyName(reader.getString());
+
+  if(!reader.ok()) {
+    ConvoySpdPolicy null_policy;
+    return(null_policy);
   }
+  return(policy);
+}
 
+//-----------------------------------------------------------
+// Field table for string2ConvoySpdPolicy()
+
+typedef ConvoyKVField<ConvoySpdPolicy> SpdPolicyField;
+
+static const SpdPolicyField spd_policy_fields[] = {
+  {"vname",         [](ConvoySpdPolicy& p, string_view v) {p.setVName(string(v));}},
+  {"full_stop_rng", [](ConvoySpdPolicy& p, string_view v) {p.setFullStopConvoyRng(kvToDouble(v));}},
+  {"slower_rng",    [](ConvoySpdPolicy& p, string_view v) {p.setSlowerConvoyRng(kvToDouble(v));}},
+  {"ideal_rng",     [](ConvoySpdPolicy& p, string_view v) {p.setIdealConvoyRng(kvToDouble(v));}},
+  {"faster_rng",    [](ConvoySpdPolicy& p, string_view v) {p.setFasterConvoyRng(kvToDouble(v));}},
+  {"full_lag_rng",  [](ConvoySpdPolicy& p, string_view v) {p.setFullLagConvoyRng(kvToDouble(v));}},
+  {"lag_spd_delta", [](ConvoySpdPolicy& p, string_view v) {p.setLagSpeedDelta(kvToDouble(v));}},
+  {"max_compress",  [](ConvoySpdPolicy& p, string_view v) {p.setMaxCompression(kvToDouble(v));}},
+  {"name",          [](ConvoySpdPolicy& p, string_view v) {p.setPolicyName(string(v));}}
+};
+
+//-----------------------------------------------------------
+// Procedure: string2ConvoySpdPolicy()
+//      Note: Messages in the compact wire form are also accepted
+
+ConvoySpdPolicy string2ConvoySpdPolicy(string_view msg,
+				       const ConvoyWireNames* names)
+{
+  if(isConvoyWire(msg))
+    return(wire2ConvoySpdPolicy(msg, names));
+
+  ConvoySpdPolicy new_policy;
+  kvDecode(msg, new_policy, spd_policy_fields);
   return(new_policy);
 }
 
+//-----------------------------------------------------------
+// Procedure: corrModeToString()
 
+string corrModeToString(ConvoyCorrMode mode)
+{
+  switch(mode) {
+  case CMODE_FULL_STOP:   return("full_stop");
+  case CMODE_CLOSE:       return("close");
+  case CMODE_IDEAL_CLOSE: return("ideal_close");
+  case CMODE_IDEAL_FAR:   return("ideal_far");
+  case CMODE_FAR:         return("far");
+  case CMODE_FULL_LAG:    return("full_lag");
+  default:                return("unset");
+  }
+}
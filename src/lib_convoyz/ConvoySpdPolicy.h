@@ -13,9 +13,27 @@
 #define CONVOY_SPD_POLICY_HEADER
 
 #include <string>
+#include <string_view>
 #include <vector>
+#include <cstddef>
 #include <stdlib.h>  // atof()
 
+class ConvoyWireNames;
+
+// Correction modes, in order of increasing convoy range. The
+// string form is only built for publication.
+enum ConvoyCorrMode {
+  CMODE_UNSET = 0,
+  CMODE_FULL_STOP,
+  CMODE_CLOSE,
+  CMODE_IDEAL_CLOSE,
+  CMODE_IDEAL_FAR,
+  CMODE_FAR,
+  CMODE_FULL_LAG
+};
+
+std::string corrModeToString(ConvoyCorrMode);
+
 class ConvoySpdPolicy {
 public:
   ConvoySpdPolicy();
@@ -45,16 +63,32 @@ public: // getters
   //std::string getVName() const        {return(m_vname);}
 
   std::string status();
-  std::string getCorrectionMode() const {return(m_correction_mode);}
+  std::string getCorrectionMode() const {return(corrModeToString(m_corr_mode));}
+  ConvoyCorrMode getCorrModeEnum() const {return(m_corr_mode);}
   
   double getSpdFromPolicy(double, double, double);
 
+  // Batch evaluation for offline sweeps. Does not touch the
+  // correction mode state. The modes array may be null.
+  void   getSpdFromPolicy(const double* lead_spd,
+			  const double* contact_rng,
+			  const double* convoy_rng,
+			  double* spd, ConvoyCorrMode* modes,
+			  std::size_t count) const;
+  void   getSpdFromPolicy(const std::vector<double>& lead_spd,
+			  const std::vector<double>& contact_rng,
+			  const std::vector<double>& convoy_rng,
+			  std::vector<double>& spd,
+			  std::vector<ConvoyCorrMode>& modes) const;
+
   bool   compress(double pct);
 
 
   bool   atIdealConvoyRng(double);
 
   std::string getSpec() const;
+  void        writeSpec(std::string&) const;
+  std::string getWireSpec(const ConvoyWireNames* names=0) const;
   std::string getTerse() const;
   
 private: // Config params
@@ -72,10 +106,11 @@ private: // Config params
   
 private: // State vars
 
-  std::string m_correction_mode;
+  ConvoyCorrMode m_corr_mode;
 };
 
-ConvoySpdPolicy string2ConvoySpdPolicy(std::string);
+ConvoySpdPolicy string2ConvoySpdPolicy(std::string_view,
+				       const ConvoyWireNames* names=0);
 
 #endif
 
@@ -10,6 +10,8 @@
 /*****************************************************************/
 
 #include "ConvoyStatRecap.h"
+#include "ConvoyCodec.h"
+#include "ConvoyWire.h"
 #include "MBUtils.h"
 
 using namespace std;
@@ -46,55 +48,124 @@ string ConvoyStatRecap::getStringValue(string key) const
 
 string ConvoyStatRecap::getSpec() const
 {
+  string str;
+  writeSpec(str);
+  return(str);
+}
+
+//------------------------------------------------------------
+// Procedure: writeSpec()
+
+void ConvoyStatRecap::writeSpec(string& buf) const
+{
+  ConvoyKVWriter writer(buf);
   if(m_follower == "")
-    return("");
+    return;
   
-  string str = "follower=" + m_follower;
+  writer.addString("follower", m_follower);
 
   if(isSetLeader())
-    str += ",leader=" + m_leader;
+    writer.addString("leader", m_leader);
   if(isSetIdealRng())
-    str += ",ideal_rng=" + doubleToString(m_ideal_rng,2);
+    writer.addDouble("ideal_rng", m_ideal_rng);
   if(m_compression > 0)
-    str += ",compression=" + doubleToString(m_compression,2);
+    writer.addDouble("compression", m_compression);
   if(m_index > 0)
-    str += ",index=" + uintToString(m_index);
+    writer.addUInt("index", m_index);
   if(m_idle)
-    str += ",idle=true";
-  
-  return(str);
+    writer.addString("idle", "true");
+}
+
+//------------------------------------------------------------
+// Compact wire form: presence mask, then the fields getSpec()
+// would write, with ranges quantized to 0.01.
+
+enum {SB_LEADER=0, SB_IDEAL_RNG, SB_COMPRESSION, SB_INDEX, SB_IDLE};
+
+static const double stat_recap_res = 0.01;
+
+//------------------------------------------------------------
+// Procedure: getWireSpec()
+
+string ConvoyStatRecap::getWireSpec(const ConvoyWireNames* names) const
+{
+  if(m_follower == "")
+    return("");
+
+  unsigned long long mask = 0;
+  if(isSetLeader())      mask |= (1ull << SB_LEADER);
+  if(isSetIdealRng())    mask |= (1ull << SB_IDEAL_RNG);
+  if(m_compression > 0)  mask |= (1ull << SB_COMPRESSION);
+  if(m_index > 0)        mask |= (1ull << SB_INDEX);
+  if(m_idle)             mask |= (1ull << SB_IDLE);
+
+  ConvoyWireWriter writer(CWIRE_STAT_RECAP, names);
+  writer.putUInt(mask);
+  writer.putName(m_follower);
+  if(mask & (1ull << SB_LEADER))      writer.putName(m_leader);
+  if(mask & (1ull << SB_IDEAL_RNG))   writer.putFixed(m_ideal_rng, stat_recap_res);
+  if(mask & (1ull << SB_COMPRESSION)) writer.putFixed(m_compression, stat_recap_res);
+  if(mask & (1ull << SB_INDEX))       writer.putUInt(m_index);
+
+  if(!writer.ok())
+    return(getSpec());
+  return(writer.getSpec());
+}
+
+//------------------------------------------------------------
+// Procedure: wire2ConvoyStatRecap()
+
+static ConvoyStatRecap wire2ConvoyStatRecap(string_view msg,
+					    const ConvoyWireNames* names)
+{
+  ConvoyStatRecap recap;
+
+  ConvoyWireReader reader(msg, names);
+  if(reader.getType() != CWIRE_STAT_RECAP)
+    return(recap);
+
+  unsigned long long mask = reader.getUInt();
+  recap.setFollower(reader.getName());
+  if(mask & (1ull << SB_LEADER))      recap.setLeader(reader.getName());
+  if(mask & (1ull << SB_IDEAL_RNG))   recap.setIdealRng(reader.getFixed(stat_recap_res));
+  if(mask & (1ull << SB_COMPRESSION)) recap.setCompression(reader.getFixed(stat_recap_res));
+  if(mask & (1ull << SB_INDEX))       recap.setIndex(reader.getUInt());
+  if(mask & (1ull << SB_IDLE))        recap.setIdle(true);
+
+  if(!reader.ok()) {
+    ConvoyStatRecap null_recap;
+    return(null_recap);
+  }
+  return(recap);
 }
 
+//---------------------------------------------------------
+// Field table for string2ConvoyStatRecap()
+
+typedef ConvoyKVField<ConvoyStatRecap> StatRecapField;
+
+static const StatRecapField stat_recap_fields[] = {
+  {"follower",    [](ConvoyStatRecap& r, string_view v) {r.setFollower(string(v));}},
+  {"leader",      [](ConvoyStatRecap& r, string_view v) {r.setLeader(string(v));}},
+  {"ideal_rng",   [](ConvoyStatRecap& r, string_view v) {r.setIdealRng(kvToDouble(v));}},
+  {"compression", [](ConvoyStatRecap& r, string_view v) {r.setCompression(kvToDouble(v));}},
+  {"idle",        [](ConvoyStatRecap& r, string_view v) {r.setIdle(kvIsTrue(v));}},
+  {"index",       [](ConvoyStatRecap& r, string_view v) {r.setIndex((unsigned int)(kvToDouble(v)));}}
+};
+
 //---------------------------------------------------------
 // Procedure: string2ConvoyStatRecap()
 //   Example: follower=henry,leader=abe,ideal_rng=40,
 //            compression=0.4,index=23
+//      Note: Messages in the compact wire form are also accepted
 
-ConvoyStatRecap string2ConvoyStatRecap(string msg)
+ConvoyStatRecap string2ConvoyStatRecap(string_view msg,
+				       const ConvoyWireNames* names)
 {
-  ConvoyStatRecap new_recap;
-
-  vector<string> svector = parseString(msg, ',');
-  for(unsigned int i=0; i<svector.size(); i++) {
-    string param = biteStringX(svector[i], '=');
-    string value = svector[i];
-    double dval = atof(value.c_str());
-    
-    if(param == "follower")
-      new_recap.setFollower(value);
-    else if(param == "leader")
-      new_recap.setLeader(value);
-    else if(param == "ideal_rng")
-      new_recap.setIdealRng(dval);
-    else if(param == "compression")
-      new_recap.setCompression(dval);
-    else if(param == "idle")
-      new_recap.setIdle(tolower(value) == "true");
-    else if(param == "index")
-      new_recap.setIndex((unsigned int)(dval));
-  }
+  if(isConvoyWire(msg))
+    return(wire2ConvoyStatRecap(msg, names));
 
+  ConvoyStatRecap new_recap;
+  kvDecode(msg, new_recap, stat_recap_fields);
   return(new_recap);
 }
-
-
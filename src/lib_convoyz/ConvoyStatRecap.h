@@ -13,9 +13,12 @@
 #define CONVOY_STAT_RECAP_HEADER
 
 #include <string>
+#include <string_view>
 #include <map>
 #include <stdlib.h>  // atof()
 
+class ConvoyWireNames;
+
 class ConvoyStatRecap
 {
  public:
@@ -45,6 +48,8 @@ class ConvoyStatRecap
   std::string getStringValue(std::string key) const;
   
   std::string getSpec() const;
+  void        writeSpec(std::string&) const;
+  std::string getWireSpec(const ConvoyWireNames* names=0) const;
 
  protected: 
   std::string m_leader;
@@ -57,7 +62,8 @@ class ConvoyStatRecap
   bool   m_idle;
 };
 
-ConvoyStatRecap string2ConvoyStatRecap(std::string);
+ConvoyStatRecap string2ConvoyStatRecap(std::string_view,
+				       const ConvoyWireNames* names=0);
 
 #endif 
 
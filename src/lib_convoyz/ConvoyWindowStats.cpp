@@ -0,0 +1,160 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoyWindowStats.cpp                                */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include "ConvoyWindowStats.h"
+#include "MBUtils.h"
+
+using namespace std;
+
+//---------------------------------------------------------
+// Constructor()
+
+ConvoyWindowStats::ConvoyWindowStats(double window)
+{
+  for(unsigned int i=0; i<NUM_STATES; i++)
+    m_time_true[i] = 0;
+  m_span = 0;
+
+  m_window = 30;
+  setWindow(window);
+}
+
+//---------------------------------------------------------
+// Procedure: setWindow()
+//      Note: Window length in seconds. The label is used to
+//            build report keys, e.g., "pct_time_on_tail_30s"
+
+void ConvoyWindowStats::setWindow(double window)
+{
+  if(window > 0)
+    m_window = window;
+  m_label = doubleToStringX(m_window, 1) + "s";
+}
+
+//---------------------------------------------------------
+// Procedure: update()
+//   Purpose: Add the interval [tstart, tend] during which the
+//            given set of states held, and expire everything
+//            older than the window.
+
+void ConvoyWindowStats::update(double tstart, double tend,
+			       unsigned int bits)
+{
+  double delta = tend - tstart;
+  if(delta <= 0)
+    return;
+
+  // Part 1: Extend the newest segment, or start a new one on
+  // a state transition.
+  bool merged = false;
+  if(!m_segments.empty()) {
+    Segment& back = m_segments.back();
+    if((back.bits == bits) && (back.tend == tstart)) {
+      back.tend = tend;
+      merged = true;
+    }
+  }
+  if(!merged) {
+    Segment seg;
+    seg.tstart = tstart;
+    seg.tend   = tend;
+    seg.bits   = bits;
+    m_segments.push_back(seg);
+  }
+
+  for(unsigned int i=0; i<NUM_STATES; i++) {
+    if(bits & stateBit(i))
+      m_time_true[i] += delta;
+  }
+  m_span += delta;
+
+  // Part 2: Expire segments that fell off the front
+  trim(tend);
+}
+
+//---------------------------------------------------------
+// Procedure: addSwitch()
+
+void ConvoyWindowStats::addSwitch(double tstamp)
+{
+  m_switches.push_back(tstamp);
+  trim(tstamp);
+}
+
+//---------------------------------------------------------
+// Procedure: getTimeTrue()
+
+double ConvoyWindowStats::getTimeTrue(unsigned int ix) const
+{
+  if(ix >= NUM_STATES)
+    return(0);
+  return(m_time_true[ix]);
+}
+
+//---------------------------------------------------------
+// Procedure: getPctTrue()
+//      Note: Relative to the time covered, which is less than
+//            the window length early in the mission.
+
+double ConvoyWindowStats::getPctTrue(unsigned int ix) const
+{
+  if((ix >= NUM_STATES) || (m_span <= 0))
+    return(0);
+  return(100 * m_time_true[ix] / m_span);
+}
+
+//---------------------------------------------------------
+// Procedure: trim()
+
+void ConvoyWindowStats::trim(double curr_time)
+{
+  double wstart = curr_time - m_window;
+
+  while(!m_switches.empty() && (m_switches.front() <= wstart))
+    m_switches.pop_front();
+
+  while(!m_segments.empty()) {
+    Segment& front = m_segments.front();
+    if(front.tstart >= wstart)
+      break;
+
+    // Either drop the whole segment, or just its expired part
+    double cut_to = front.tend;
+    if(cut_to > wstart)
+      cut_to = wstart;
+    double delta = cut_to - front.tstart;
+
+    for(unsigned int i=0; i<NUM_STATES; i++) {
+      if(front.bits & stateBit(i))
+	m_time_true[i] -= delta;
+    }
+    m_span -= delta;
+
+    if(front.tend <= wstart)
+      m_segments.pop_front();
+    else
+      front.tstart = wstart;
+  }
+
+  // Guard against accumulated round-off. When the queue empties
+  // the running sums are reset to exactly zero.
+  if(m_segments.empty()) {
+    for(unsigned int i=0; i<NUM_STATES; i++)
+      m_time_true[i] = 0;
+    m_span = 0;
+  }
+  for(unsigned int i=0; i<NUM_STATES; i++) {
+    if(m_time_true[i] < 0)
+      m_time_true[i] = 0;
+  }
+  if(m_span < 0)
+    m_span = 0;
+}
@@ -0,0 +1,70 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoyWindowStats.h                                  */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef CONVOY_WINDOW_STATS_HEADER
+#define CONVOY_WINDOW_STATS_HEADER
+
+#include <string>
+#include <deque>
+
+//---------------------------------------------------------------
+// ConvoyWindowStats tracks the fraction of time each convoy
+// state (on_tail, aligned, ...) held over the most recent
+// window of time, and the number of range side switches in
+// that window. Consecutive intervals with the same state are
+// merged into one segment, so the queue only grows on state
+// transitions. Each update is amortized O(1): new time is added
+// at the back, and expired time is subtracted at the front.
+
+class ConvoyWindowStats
+{
+ public:
+  ConvoyWindowStats(double window=30);
+  ~ConvoyWindowStats() {}
+
+  enum {ON_TAIL=0, ALIGNED, TETHERED, FASTENED, TRACKING, NUM_STATES};
+
+  static unsigned int stateBit(unsigned int ix) {return(1u << ix);}
+
+  void   setWindow(double);
+  double getWindow() const {return(m_window);}
+  std::string getLabel() const {return(m_label);}
+
+  void   update(double tstart, double tend, unsigned int state_bits);
+  void   addSwitch(double tstamp);
+
+  double getTimeTrue(unsigned int ix) const;
+  double getPctTrue(unsigned int ix) const;
+  unsigned int getSwitches() const {return(m_switches.size());}
+
+  double getSpan() const {return(m_span);}
+
+ protected:
+  void   trim(double curr_time);
+
+ protected:
+  struct Segment {
+    double tstart;
+    double tend;
+    unsigned int bits;
+  };
+
+  double m_window;
+  std::string m_label;
+
+  std::deque<Segment> m_segments;
+  std::deque<double>  m_switches;
+
+  double m_time_true[NUM_STATES];
+  double m_span;
+};
+
+#endif
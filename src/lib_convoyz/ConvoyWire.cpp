@@ -0,0 +1,361 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoyWire.cpp                                       */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cmath>
+#include "ConvoyWire.h"
+#include "MBUtils.h"
+
+using namespace std;
+
+static const char   wire_prefix = '~';
+static const double max_quantized = 4.0e18;
+
+//---------------------------------------------------------
+// Procedure: setNames()
+//   Example: "abe,ben,cal,deb"
+//      Note: Both ends of a link must use the same table, in
+//            the same order. Names not in the table are still
+//            sent, inline.
+
+bool ConvoyWireNames::setNames(string str)
+{
+  m_names.clear();
+  vector<string> svector = parseString(str, ',');
+  for(unsigned int i=0; i<svector.size(); i++) {
+    string name = tolower(stripBlankEnds(svector[i]));
+    if(name == "")
+      return(false);
+    addName(name);
+  }
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: addName()
+
+void ConvoyWireNames::addName(string name)
+{
+  if(getID(name) < 0)
+    m_names.push_back(tolower(name));
+}
+
+//---------------------------------------------------------
+// Procedure: getID()
+//   Returns: index into the table or -1 if not found
+//      Note: Names are matched without regard to case, as the
+//            table holds them in lower case
+
+int ConvoyWireNames::getID(const string& name) const
+{
+  string lname = tolower(name);
+  for(unsigned int i=0; i<m_names.size(); i++) {
+    if(m_names[i] == lname)
+      return((int)(i));
+  }
+  return(-1);
+}
+
+//---------------------------------------------------------
+// Procedure: getName()
+
+string ConvoyWireNames::getName(unsigned int ix) const
+{
+  if(ix >= m_names.size())
+    return("");
+  return(m_names[ix]);
+}
+
+//---------------------------------------------------------
+// Constructor()
+
+ConvoyWireWriter::ConvoyWireWriter(unsigned int msg_type,
+				   const ConvoyWireNames* names)
+{
+  m_ok = true;
+  m_names = names;
+  m_bytes.reserve(64);
+  m_bytes.push_back((char)(CONVOY_WIRE_VERSION));
+  m_bytes.push_back((char)(msg_type));
+}
+
+//---------------------------------------------------------
+// Procedure: putUInt()
+//      Note: LEB128 varint, 7 bits per byte
+
+void ConvoyWireWriter::putUInt(unsigned long long val)
+{
+  while(val >= 0x80) {
+    m_bytes.push_back((char)((val & 0x7f) | 0x80));
+    val >>= 7;
+  }
+  m_bytes.push_back((char)(val));
+}
+
+//---------------------------------------------------------
+// Procedure: putInt()
+//      Note: Zigzag encoded so small negatives stay small
+
+void ConvoyWireWriter::putInt(long long val)
+{
+  unsigned long long zz = ((unsigned long long)(val) << 1);
+  if(val < 0)
+    zz = ~zz;
+  putUInt(zz);
+}
+
+//---------------------------------------------------------
+// Procedure: putFixed()
+
+void ConvoyWireWriter::putFixed(double val, double res)
+{
+  double qval = round(val / res);
+  if(!isfinite(qval) || (fabs(qval) > max_quantized)) {
+    m_ok = false;
+    qval = 0;
+  }
+  putInt((long long)(qval));
+}
+
+//---------------------------------------------------------
+// Procedure: putString()
+
+void ConvoyWireWriter::putString(string_view str)
+{
+  putUInt(str.size());
+  m_bytes.append(str.data(), str.size());
+}
+
+//---------------------------------------------------------
+// Procedure: putName()
+//      Note: 0 means an inline name follows, otherwise the
+//            value is the table index plus one.
+
+void ConvoyWireWriter::putName(const string& name)
+{
+  int id = -1;
+  if(m_names)
+    id = m_names->getID(name);
+
+  if(id < 0) {
+    putUInt(0);
+    putString(name);
+  }
+  else
+    putUInt(id + 1);
+}
+
+//---------------------------------------------------------
+// Procedure: getSpec()
+
+string ConvoyWireWriter::getSpec() const
+{
+  string spec(1, wire_prefix);
+  spec += base64Encode(m_bytes);
+  return(spec);
+}
+
+//---------------------------------------------------------
+// Constructor()
+
+ConvoyWireReader::ConvoyWireReader(string_view spec,
+				   const ConvoyWireNames* names)
+{
+  m_pos = 0;
+  m_ok  = false;
+  m_version = 0;
+  m_type = 0;
+  m_unknown_names = 0;
+  m_names = names;
+
+  if(!isConvoyWire(spec))
+    return;
+  if(!base64Decode(spec.substr(1), m_bytes))
+    return;
+  if(m_bytes.size() < 2)
+    return;
+
+  m_version = (unsigned char)(m_bytes[0]);
+  m_type    = (unsigned char)(m_bytes[1]);
+  m_pos = 2;
+  m_ok = (m_version == CONVOY_WIRE_VERSION);
+}
+
+//---------------------------------------------------------
+// Procedure: getUInt()
+
+unsigned long long ConvoyWireReader::getUInt()
+{
+  unsigned long long val = 0;
+  unsigned int shift = 0;
+  while(m_ok) {
+    if((m_pos >= m_bytes.size()) || (shift > 63)) {
+      m_ok = false;
+      return(0);
+    }
+    unsigned char byte = (unsigned char)(m_bytes[m_pos++]);
+    val |= ((unsigned long long)(byte & 0x7f) << shift);
+    if((byte & 0x80) == 0)
+      return(val);
+    shift += 7;
+  }
+  return(0);
+}
+
+//---------------------------------------------------------
+// Procedure: getInt()
+
+long long ConvoyWireReader::getInt()
+{
+  unsigned long long zz = getUInt();
+  long long val = (long long)(zz >> 1);
+  if(zz & 1)
+    val = ~val;
+  return(val);
+}
+
+//---------------------------------------------------------
+// Procedure: getFixed()
+
+double ConvoyWireReader::getFixed(double res)
+{
+  return((double)(getInt()) * res);
+}
+
+//---------------------------------------------------------
+// Procedure: getString()
+
+string ConvoyWireReader::getString()
+{
+  unsigned long long len = getUInt();
+  if(!m_ok || (len > (m_bytes.size() - m_pos))) {
+    m_ok = false;
+    return("");
+  }
+  string str = m_bytes.substr(m_pos, len);
+  m_pos += len;
+  return(str);
+}
+
+//---------------------------------------------------------
+// Procedure: getName()
+//      Note: A table index we do not know means the two ends are
+//            not configured with the same table. The name comes
+//            back empty and is noted, but the rest of the message
+//            is still good and can be used.
+
+string ConvoyWireReader::getName()
+{
+  unsigned long long id = getUInt();
+  if(!m_ok)
+    return("");
+  if(id == 0)
+    return(getString());
+
+  if(!m_names || (id > m_names->size())) {
+    m_unknown_names++;
+    return("");
+  }
+  return(m_names->getName(id - 1));
+}
+
+//---------------------------------------------------------
+// Procedure: isConvoyWire()
+
+bool isConvoyWire(string_view str)
+{
+  return((str.size() > 1) && (str[0] == wire_prefix));
+}
+
+//---------------------------------------------------------
+// Procedure: getConvoyWireType()
+//   Returns: Message type, or zero if not a valid wire message
+
+unsigned int getConvoyWireType(string_view str)
+{
+  if(!isConvoyWire(str))
+    return(0);
+
+  // First 4 base64 chars carry the version and type bytes
+  string bytes;
+  if(!base64Decode(str.substr(1, 4), bytes) || (bytes.size() < 2))
+    return(0);
+  if((unsigned char)(bytes[0]) != CONVOY_WIRE_VERSION)
+    return(0);
+  return((unsigned char)(bytes[1]));
+}
+
+//---------------------------------------------------------
+// Base64, URL-safe alphabet, no padding
+
+static const char b64_chars[] =
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+static int b64Value(char c)
+{
+  if((c >= 'A') && (c <= 'Z'))
+    return(c - 'A');
+  if((c >= 'a') && (c <= 'z'))
+    return(c - 'a' + 26);
+  if((c >= '0') && (c <= '9'))
+    return(c - '0' + 52);
+  if(c == '-')
+    return(62);
+  if(c == '_')
+    return(63);
+  return(-1);
+}
+
+//---------------------------------------------------------
+// Procedure: base64Encode()
+
+string base64Encode(const string& bytes)
+{
+  string str;
+  str.reserve(((bytes.size() + 2) / 3) * 4);
+
+  unsigned int bits = 0;
+  int nbits = 0;
+  for(size_t i=0; i<bytes.size(); i++) {
+    bits = (bits << 8) | (unsigned char)(bytes[i]);
+    nbits += 8;
+    while(nbits >= 6) {
+      nbits -= 6;
+      str.push_back(b64_chars[(bits >> nbits) & 0x3f]);
+    }
+  }
+  if(nbits > 0)
+    str.push_back(b64_chars[(bits << (6 - nbits)) & 0x3f]);
+  return(str);
+}
+
+//---------------------------------------------------------
+// Procedure: base64Decode()
+
+bool base64Decode(string_view str, string& bytes)
+{
+  bytes.clear();
+  bytes.reserve((str.size() * 3) / 4);
+
+  unsigned int bits = 0;
+  int nbits = 0;
+  for(size_t i=0; i<str.size(); i++) {
+    int val = b64Value(str[i]);
+    if(val < 0)
+      return(false);
+    bits = (bits << 6) | (unsigned int)(val);
+    nbits += 6;
+    if(nbits >= 8) {
+      nbits -= 8;
+      bytes.push_back((char)((bits >> nbits) & 0xff));
+    }
+  }
+  return(true);
+}
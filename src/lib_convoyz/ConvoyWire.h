@@ -0,0 +1,138 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoyWire.h                                         */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef CONVOY_WIRE_HEADER
+#define CONVOY_WIRE_HEADER
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+//---------------------------------------------------------------
+// Compact wire format for convoy telemetry on low-rate links.
+//
+//   ~<base64( version | type | payload )>
+//
+// The leading '~' never starts a key=value message, so decoders
+// can accept either form transparently. The payload is a series
+// of unsigned/zigzag varints. Real values are fixed-point,
+// quantized to a given resolution (typically the precision of
+// the text form, so nothing is lost relative to the text).
+// Vehicle names are sent as an index into a ConvoyWireNames
+// table shared by both ends, or inline if not in the table.
+// Names match the table without regard to case. A receiver that
+// cannot resolve an index gets an empty name for it, but the
+// rest of the message still decodes.
+// Base64 is the URL-safe alphabet, unpadded, so the result is
+// safe inside MOOS strings and node messages.
+
+#define CONVOY_WIRE_VERSION 1
+
+enum ConvoyWireType {
+  CWIRE_RECAP = 1,
+  CWIRE_STAT_RECAP,
+  CWIRE_SPD_POLICY,
+  CWIRE_MARKER,
+  CWIRE_AGENT_INFO,
+  CWIRE_LEAD_POINT
+};
+
+//---------------------------------------------------------------
+// ConvoyWireNames: vehicle name <-> small integer id table
+
+class ConvoyWireNames
+{
+ public:
+  ConvoyWireNames() {}
+  ~ConvoyWireNames() {}
+
+  bool setNames(std::string);
+  void addName(std::string);
+
+  int          getID(const std::string&) const;
+  std::string  getName(unsigned int) const;
+  unsigned int size() const {return(m_names.size());}
+
+ private:
+  std::vector<std::string> m_names;
+};
+
+//---------------------------------------------------------------
+// ConvoyWireWriter
+
+class ConvoyWireWriter
+{
+ public:
+  ConvoyWireWriter(unsigned int msg_type, const ConvoyWireNames* names=0);
+  ~ConvoyWireWriter() {}
+
+  void putUInt(unsigned long long);
+  void putInt(long long);
+  void putFixed(double val, double res);
+  void putString(std::string_view);
+  void putName(const std::string&);
+
+  // False if any value could not be represented, in which case
+  // the caller should send the text form instead.
+  bool ok() const {return(m_ok);}
+
+  std::string  getSpec() const;
+  unsigned int getRawSize() const {return(m_bytes.size());}
+
+ private:
+  std::string m_bytes;
+  bool        m_ok;
+
+  const ConvoyWireNames* m_names;
+};
+
+//---------------------------------------------------------------
+// ConvoyWireReader
+
+class ConvoyWireReader
+{
+ public:
+  ConvoyWireReader(std::string_view spec, const ConvoyWireNames* names=0);
+  ~ConvoyWireReader() {}
+
+  unsigned long long getUInt();
+  long long          getInt();
+  double             getFixed(double res);
+  std::string        getString();
+  std::string        getName();
+
+  // False on bad encoding, unknown version, or read past the end
+  bool ok() const {return(m_ok);}
+
+  unsigned int getVersion() const {return(m_version);}
+  unsigned int getType() const    {return(m_type);}
+
+  // Names sent as table indices this end could not resolve
+  unsigned int getUnknownNames() const {return(m_unknown_names);}
+
+ private:
+  std::string  m_bytes;
+  size_t       m_pos;
+  bool         m_ok;
+  unsigned int m_version;
+  unsigned int m_type;
+  unsigned int m_unknown_names;
+
+  const ConvoyWireNames* m_names;
+};
+
+bool isConvoyWire(std::string_view);
+unsigned int getConvoyWireType(std::string_view);
+
+std::string base64Encode(const std::string&);
+bool        base64Decode(std::string_view, std::string&);
+
+#endif
@@ -54,6 +54,9 @@ EvalConvoyEngine::EvalConvoyEngine()
 
   m_rng_switches = 0;
   m_rng_switch_thresh = 0;
+
+  // Default rolling windows: 30 secs, 5 mins, 30 mins
+  setRollingWindows("30,300,1800");
   
   m_attained_on_tail = false;
   m_attained_aligned = false;
@@ -123,20 +126,59 @@ bool EvalConvoyEngine::setParam(string param, string value)
     handled = setNonWhiteVarOnString(m_stat_recap_var, value);
   else if(param == "track_err_snap") 
     handled = setPosDoubleOnString(m_track_err_snap, value);
+  else if(param == "rolling_windows") 
+    handled = setRollingWindows(value);
+  else if(param == "wire_names") 
+    handled = m_wire_names.setNames(value);
   
   return(handled);
 }
 
+//---------------------------------------------------------
+// Procedure: setRollingWindows()
+//   Example: "30,300,1800"  (window lengths in seconds)
+//      Note: An empty string or "none" disables rolling windows.
+
+bool EvalConvoyEngine::setRollingWindows(string str)
+{
+  vector<ConvoyWindowStats> new_windows;
+
+  str = tolower(stripBlankEnds(str));
+  if((str != "") && (str != "none")) {
+    vector<string> svector = parseString(str, ',');
+    for(unsigned int i=0; i<svector.size(); i++) {
+      string sval = stripBlankEnds(svector[i]);
+      if(!isNumber(sval))
+	return(false);
+      double window = atof(sval.c_str());
+      if(window <= 0)
+	return(false);
+      new_windows.push_back(ConvoyWindowStats(window));
+    }
+  }
+  
+  m_window_stats = new_windows;
+  return(true);
+}
+
 //---------------------------------------------------------
 // Procedure: handleStatRecap()
 //   Example: follower=henry,leader=abe,ideal_rng=40,compression=0.4
 
 bool EvalConvoyEngine::handleStatRecap(string recap_str)
 {
-  m_stat_recap = string2ConvoyStatRecap(recap_str);
+  return(handleStatRecap(string2ConvoyStatRecap(recap_str, &m_wire_names)));
+}
+
+//---------------------------------------------------------
+// Procedure: handleStatRecap()
+
+bool EvalConvoyEngine::handleStatRecap(const ConvoyStatRecap& recap)
+{
+  m_stat_recap = recap;
   m_stat_recap_rcvd++;
 
-  handleStatRecapAlly(recap_str);
+  handleStatRecapAlly(recap);
   return(true);
 }
 
@@ -149,11 +191,19 @@ bool EvalConvoyEngine::handleStatRecap(string recap_str)
 //            tail_cnt=6,index=390
 
 bool EvalConvoyEngine::handleRecap(string recap_str)
+{
+  return(handleRecap(string2ConvoyRecap(recap_str, &m_wire_names)));
+}
+
+//---------------------------------------------------------
+// Procedure: handleRecap()
+
+bool EvalConvoyEngine::handleRecap(const ConvoyRecap& recap)
 {
   if(m_tstamp_first_recap == 0)
     m_tstamp_first_recap = m_curr_time;
   
-  m_recap = string2ConvoyRecap(recap_str);
+  m_recap = recap;
   m_recap_rcvd++;
   return(true);
 }
@@ -165,7 +215,15 @@ bool EvalConvoyEngine::handleRecap(string recap_str)
 
 bool EvalConvoyEngine::handleSpdPolicy(string policy_str)
 {
-  m_spd_policy = string2ConvoySpdPolicy(policy_str);
+  return(handleSpdPolicy(string2ConvoySpdPolicy(policy_str, &m_wire_names)));
+}
+
+//---------------------------------------------------------
+// Procedure: handleSpdPolicy()
+
+bool EvalConvoyEngine::handleSpdPolicy(const ConvoySpdPolicy& policy)
+{
+  m_spd_policy = policy;
   m_spd_policy_rcvd++;
   return(true);
 }
@@ -173,20 +231,28 @@ bool EvalConvoyEngine::handleSpdPolicy(string policy_str)
 //---------------------------------------------------------
 // Procedure: handleStatRecapAlly()
 //   Example: follower=henry,leader=abe,ideal_rng=40,compression=0.4
+//      Note: Either the text or compact wire form is accepted
 
 bool EvalConvoyEngine::handleStatRecapAlly(string stat_recap)
 {
   if(stat_recap == "")
     return(false);
-  
-  string follower = tokStringParse(stat_recap, "follower", ',', '=');
-  string leader   = tokStringParse(stat_recap, "leader", ',', '=');
-  string idle     = tokStringParse(stat_recap, "idle", ',', '=');
+
+  return(handleStatRecapAlly(string2ConvoyStatRecap(stat_recap, &m_wire_names)));
+}
+
+//---------------------------------------------------------
+// Procedure: handleStatRecapAlly()
+
+bool EvalConvoyEngine::handleStatRecapAlly(const ConvoyStatRecap& recap)
+{
+  string follower = recap.getFollower();
+  string leader   = recap.getLeader();
 
   if((leader == "") || (follower == ""))
     return(false);
 
-  if(idle != "true") {
+  if(!recap.getIdle()) {
     string pairing = follower + "," + leader;
     m_order_detector.addPairing(pairing);
   }
@@ -292,6 +358,10 @@ double EvalConvoyEngine::getDouble(string str) const
     return(m_stat_recap.getIdealRange());
   else if(str == "track_err_snap")
     return(m_track_err_snap);
+
+  double wval = 0;
+  if(getWindowValue(str, wval))
+    return(wval);
   
   return(0);
 }
@@ -311,9 +381,46 @@ unsigned int EvalConvoyEngine::getUInt(string str) const
   else if(str == "rng_switches")
     return(m_rng_switches);
 
+  double wval = 0;
+  if(getWindowValue(str, wval))
+    return((unsigned int)(wval));
+
   return(0);
 }
 
+//---------------------------------------------------------
+// Procedure: getWindowValue()
+//   Example: "pct_time_on_tail_30s", "rng_switches_300s"
+//   Returns: true if the key names a known rolling window metric
+
+bool EvalConvoyEngine::getWindowValue(string str, double& val) const
+{
+  for(unsigned int i=0; i<m_window_stats.size(); i++) {
+    const ConvoyWindowStats& wstats = m_window_stats[i];
+    string suffix = "_" + wstats.getLabel();
+    if(!strEnds(str, suffix))
+      continue;
+    
+    string key = str.substr(0, str.length() - suffix.length());
+    if(key == "pct_time_on_tail")
+      val = wstats.getPctTrue(ConvoyWindowStats::ON_TAIL);
+    else if(key == "pct_time_aligned")
+      val = wstats.getPctTrue(ConvoyWindowStats::ALIGNED);
+    else if(key == "pct_time_tethered")
+      val = wstats.getPctTrue(ConvoyWindowStats::TETHERED);
+    else if(key == "pct_time_fastened")
+      val = wstats.getPctTrue(ConvoyWindowStats::FASTENED);
+    else if(key == "pct_time_tracking")
+      val = wstats.getPctTrue(ConvoyWindowStats::TRACKING);
+    else if(key == "rng_switches")
+      val = wstats.getSwitches();
+    else
+      return(false);
+    return(true);
+  }
+  return(false);
+}
+
 //---------------------------------------------------------
 // Procedure: getStrBool()
 
@@ -463,6 +570,33 @@ void EvalConvoyEngine::updateTimeMetrics()
   m_pct_time_tethered = 100 * m_time_tethered / total_time;
   m_pct_time_fastened = 100 * m_time_fastened / total_time;
   m_pct_time_tracking = 100 * m_time_tracking / total_time;
+
+  // Rolling windows only begin accruing once a recap is received,
+  // consistent with the cumulative metrics above.
+  if(m_tstamp_first_recap == 0)
+    return;
+  unsigned int bits = getStateBits();
+  for(unsigned int i=0; i<m_window_stats.size(); i++)
+    m_window_stats[i].update(m_prev_time, m_curr_time, bits);
+}
+
+//---------------------------------------------------------
+// Procedure: getStateBits()
+
+unsigned int EvalConvoyEngine::getStateBits() const
+{
+  unsigned int bits = 0;
+  if(m_on_tail)
+    bits |= ConvoyWindowStats::stateBit(ConvoyWindowStats::ON_TAIL);
+  if(m_aligned)
+    bits |= ConvoyWindowStats::stateBit(ConvoyWindowStats::ALIGNED);
+  if(m_tethered)
+    bits |= ConvoyWindowStats::stateBit(ConvoyWindowStats::TETHERED);
+  if(m_fastened)
+    bits |= ConvoyWindowStats::stateBit(ConvoyWindowStats::FASTENED);
+  if(m_tracking)
+    bits |= ConvoyWindowStats::stateBit(ConvoyWindowStats::TRACKING);
+  return(bits);
 }
 
 //---------------------------------------------------------
@@ -482,18 +616,26 @@ void EvalConvoyEngine::updateSwitchMetrics()
     return;
   }
 
+  bool switched = false;
   if(m_rng_side == "close") {
     if(convoy_rng > (ideal_convoy_rng + m_rng_switch_thresh)) {
       m_rng_side = "far";
       m_rng_switches++;
+      switched = true;
     }
   }
   if(m_rng_side == "far") {
     if(convoy_rng < (ideal_convoy_rng - m_rng_switch_thresh)) {
       m_rng_side = "close";
       m_rng_switches++;
+      switched = true;
     }
   }
+
+  if(switched) {
+    for(unsigned int i=0; i<m_window_stats.size(); i++)
+      m_window_stats[i].addSwitch(m_curr_time);
+  }
 }
 
 
@@ -582,23 +724,31 @@ vector<string> EvalConvoyEngine::buildReport() const
   string str_fastened = getStrBool("fastened");
   string str_tracking = getStrBool("tracking");
 
-  string str_pct_on_tail = getStrDouble("pct_time_on_tail",1);
-  string str_pct_aligned = getStrDouble("pct_time_aligned",1);
-  string str_pct_tethered = getStrDouble("pct_time_tethered",1);
-  string str_pct_fastened = getStrDouble("pct_time_fastened",1);
-  string str_pct_tracking = getStrDouble("pct_time_tracking",1);
-
   if(getBool("tethered"))
     str_fastened += " (" + getCorrMode() + ")";
   
-  ACTable actab(3,3);
-  actab << "Status | % true  | State";
+  string header = "Status | % true  | ";
+  for(unsigned int i=0; i<m_window_stats.size(); i++)
+    header += "% " + m_window_stats[i].getLabel() + " | ";
+  header += "State";
+
+  vector<string> keys, states;
+  keys.push_back("on_tail");  states.push_back(str_on_tail);
+  keys.push_back("aligned");  states.push_back(str_aligned);
+  keys.push_back("tethered"); states.push_back(str_tethered);
+  keys.push_back("fastened"); states.push_back(str_fastened);
+  keys.push_back("tracking"); states.push_back(str_tracking);
+  
+  ACTable actab(3 + m_window_stats.size(), 3);
+  actab << header;
   actab.addHeaderLines();
-  actab << "on_tail"  << str_pct_on_tail  << str_on_tail; 
-  actab << "aligned"  << str_pct_aligned  << str_aligned;
-  actab << "tethered" << str_pct_tethered << str_tethered;
-  actab << "fastened" << str_pct_fastened << str_fastened;
-  actab << "tracking" << str_pct_tracking << str_tracking;
+  for(unsigned int k=0; k<keys.size(); k++) {
+    string pct_key = "pct_time_" + keys[k];
+    actab << keys[k] << getStrDouble(pct_key, 1);
+    for(unsigned int i=0; i<m_window_stats.size(); i++)
+      actab << getStrDouble(pct_key + "_" + m_window_stats[i].getLabel(), 1);
+    actab << states[k];
+  }
   msgs.push_back(actab.getFormattedString());
   msgs.push_back("");
   
@@ -607,6 +757,11 @@ vector<string> EvalConvoyEngine::buildReport() const
   // =======================================================
   string str_rng_switches = getStrUInt("rng_switches");
   msgs.push_back("Range Side:    " + getRngSide());
+  for(unsigned int i=0; i<m_window_stats.size(); i++) {
+    string label = m_window_stats[i].getLabel();
+    str_rng_switches += "  (" + label + ": ";
+    str_rng_switches += getStrUInt("rng_switches_" + label) + ")";
+  }
   msgs.push_back("Side Switches: " + str_rng_switches);
 
   string convoy_summary = m_order_detector.getConvoySummary();
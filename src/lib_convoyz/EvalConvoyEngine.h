@@ -13,10 +13,14 @@
 #define EVAL_CONVOY_ENGINE_HEADER
 
 #include <string>
+#include <vector>
+#include <map>
 #include "ConvoyRecap.h"
 #include "ConvoyStatRecap.h"
 #include "ConvoySpdPolicy.h"
 #include "ConvoyOrderDetector.h"
+#include "ConvoyWindowStats.h"
+#include "ConvoyWire.h"
 
 class EvalConvoyEngine
 {
@@ -33,6 +37,12 @@ class EvalConvoyEngine
   bool handleSpdPolicy(std::string);
   bool handleStatRecapAlly(std::string);
 
+  // Decoded forms, e.g., when driven in-process by a simulator
+  bool handleStatRecap(const ConvoyStatRecap&);
+  bool handleRecap(const ConvoyRecap&);
+  bool handleSpdPolicy(const ConvoySpdPolicy&);
+  bool handleStatRecapAlly(const ConvoyStatRecap&);
+
   bool   getBool(std::string) const;
   double getDouble(std::string) const;
   unsigned int getUInt(std::string) const;
@@ -58,6 +68,10 @@ protected:
   void updateSwitchMetrics();
   void updateTrackErrMetrics();
 
+  bool setRollingWindows(std::string);
+  bool getWindowValue(std::string, double&) const;
+  unsigned int getStateBits() const;
+
  private: // Configuration variables
 
   std::string m_recap_var;
@@ -69,6 +83,8 @@ protected:
   double m_tracking_thresh;
   double m_rng_switch_thresh;
 
+  ConvoyWireNames m_wire_names;
+
  private: // Exposed State variables
   ConvoyRecap     m_recap;
   ConvoyStatRecap m_stat_recap;
@@ -99,6 +115,9 @@ protected:
 
   unsigned int m_rng_switches;
   std::string  m_rng_side;
+
+  // Rolling-window versions of the pct_time and switch metrics
+  std::vector<ConvoyWindowStats> m_window_stats;
     
   bool   m_attained_on_tail;
   bool   m_attained_aligned;
@@ -37,6 +37,9 @@ MarkerTail::MarkerTail()
   m_marker_id_max_val = (m_tail_length_max / m_inter_mark_range) + 2;
   m_marker_id = 0;
 
+  for(unsigned int i=0; i<6; i++)
+    m_tail_ang_pts[i] = 0;
+
   m_tail_type = "passive";
 }
 
@@ -163,8 +166,6 @@ bool MarkerTail::handleNewActiveMarker(ConvoyMarker marker)
 
 bool MarkerTail::handleNewContactPos(double cnx, double cny, double cnh)
 {
-  cout << "MarkerTail::handleNewContactPos: type=" << m_tail_type << endl; 
-  cout << "MarkerTail::handleNewContactPos: size=" << size() << endl; 
   // If type is not passive and there are existing markers
   //if((size() > 0) && (m_tail_type != "passive"))
   if(m_tail_type != "passive")
@@ -218,7 +219,6 @@ bool MarkerTail::checkDropAftMarker(string& msg)
   msg += ",mt_len=" + doubleToStringX(m_marker_tail_length,1);
   msg += ",max=" + doubleToStringX(m_tail_length_max);
   
-  cout << "MarkerTail::dropAftMarker +++++++++++++++++++" << endl;
   dropAftMarker();
 
   // Whenever the tail becomes empty, revert to being in the
@@ -416,28 +416,31 @@ double MarkerTail::distToAftMarker(double x, double y) const
 
 double MarkerTail::getTrackError(double osx, double osy) const
 {
-  if(m_markers.empty() && m_ghost_markers.empty())
+  if(m_markers.empty())
     return(-1);
 
   double aftx = m_markers.back().getX();
   double afty = m_markers.back().getY();
 
-  XYSegList segl;
-  segl.add_vertex(aftx, afty);
+  // Distance to the seglist formed by the aft marker and the
+  // ghost markers. Walked in place, this is called every tick.
+  if(m_ghost_markers.empty())
+    return(hypot(osx-aftx, osy-afty));
 
+  double min_dist = -1;
+  double prevx = aftx;
+  double prevy = afty;
   list<ConvoyMarker>::const_iterator p;
   for(p=m_ghost_markers.begin(); p!=m_ghost_markers.end(); p++) {
     double gx = p->getX();
     double gy = p->getY();
-    segl.add_vertex(gx, gy);
+    double dist = distPointToSeg(prevx, prevy, gx, gy, osx, osy);
+    if((min_dist < 0) || (dist < min_dist))
+      min_dist = dist;
+    prevx = gx;
+    prevy = gy;
   }
-
-  // Sanity check
-  if(segl.size() == 0)
-    return(-1);
-  
-  double dist = segl.dist_to_point(osx, osy);
-  return(dist);
+  return(min_dist);
 }
 
 //-----------------------------------------------------------
@@ -468,13 +471,13 @@ double MarkerTail::tailAngle(double osx, double osy)
   
   double tail_angle = angleFromThreePoints(mx, my, osx, osy, bx, by);
 
-  // Build info string for debugging/logging if desired
-  m_tail_ang_info  = doubleToString(mx,1) + ",";
-  m_tail_ang_info += doubleToString(my,1) + " : ";
-  m_tail_ang_info += doubleToString(osx,1) + ",";
-  m_tail_ang_info += doubleToString(osy,1) + " : ";
-  m_tail_ang_info += doubleToString(bx,1) + ",";
-  m_tail_ang_info += doubleToString(by,1);
+  // Keep the points for getTailAngleInfo(), for debugging/logging
+  m_tail_ang_pts[0] = mx;
+  m_tail_ang_pts[1] = my;
+  m_tail_ang_pts[2] = osx;
+  m_tail_ang_pts[3] = osy;
+  m_tail_ang_pts[4] = bx;
+  m_tail_ang_pts[5] = by;
   
   // Sanity check, ensure marker_ang is in range [0, 180)
   tail_angle = angle180(tail_angle);
@@ -484,6 +487,20 @@ double MarkerTail::tailAngle(double osx, double osy)
   return(180 - tail_angle); 
 }
 
+//-----------------------------------------------------------
+// Procedure: getTailAngleInfo()
+
+string MarkerTail::getTailAngleInfo() const
+{
+  string info = doubleToString(m_tail_ang_pts[0],1) + ",";
+  info += doubleToString(m_tail_ang_pts[1],1) + " : ";
+  info += doubleToString(m_tail_ang_pts[2],1) + ",";
+  info += doubleToString(m_tail_ang_pts[3],1) + " : ";
+  info += doubleToString(m_tail_ang_pts[4],1) + ",";
+  info += doubleToString(m_tail_ang_pts[5],1);
+  return(info);
+}
+
 //-----------------------------------------------------------
 // Procedure: markerBearing()
 //      Note: The marker_bearing is the relative bearing of the
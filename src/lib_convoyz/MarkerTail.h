@@ -59,7 +59,7 @@ public:
   std::list<ConvoyMarker> getMarkers() const {return(m_markers);}
   std::list<ConvoyMarker> getClearedMarkers();
 
-  std::string getTailAngleInfo() const {return(m_tail_ang_info);}
+  std::string getTailAngleInfo() const;
 
   std::string getMarkerStr();
   std::string getTailType() const {return(m_tail_type);}
@@ -88,7 +88,9 @@ protected: // State variables
   unsigned int m_marker_id;
   unsigned int m_marker_id_max_val;
 
-  std::string m_tail_ang_info;
+  // Points of the last tail angle calculation: marker, ownship
+  // and near-aft marker. Formatted only on request.
+  double m_tail_ang_pts[6];
 
   std::string m_tail_type;
   
@@ -0,0 +1,150 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: DubinsBidCache.cpp                                   */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cmath>
+#include "DubinsBidCache.h"
+#include "AngleUtils.h"
+
+using namespace std;
+
+//---------------------------------------------------------
+// Constructor()
+
+DubinsBidCache::DubinsBidCache()
+{
+  m_pos_tol = 0.5;   // meters
+  m_hdg_tol = 2;     // degrees
+  m_spd_tol = 0.2;   // meters/sec
+
+  m_valid  = false;
+  m_osx    = 0;
+  m_osy    = 0;
+  m_osh    = 0;
+  m_osv    = 0;
+  m_tx     = 0;
+  m_ty     = 0;
+  m_tvx    = 0;
+  m_tvy    = 0;
+  m_radius = 0;
+  m_bid    = 0;
+}
+
+//---------------------------------------------------------
+// Procedure: setPosTolerance()
+
+bool DubinsBidCache::setPosTolerance(double val)
+{
+  if(val < 0)
+    return(false);
+  m_pos_tol = val;
+  m_valid = false;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setHdgTolerance()
+
+bool DubinsBidCache::setHdgTolerance(double val)
+{
+  if((val < 0) || (val > 180))
+    return(false);
+  m_hdg_tol = val;
+  m_valid = false;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setSpdTolerance()
+
+bool DubinsBidCache::setSpdTolerance(double val)
+{
+  if(val < 0)
+    return(false);
+  m_spd_tol = val;
+  m_valid = false;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: isValid()
+//      Note: Pose-only key, for bids to a stationary target.
+
+bool DubinsBidCache::isValid(double osx, double osy, double osh,
+			     double tx, double ty, double radius) const
+{
+  return(isValid(osx, osy, osh, 0, tx, ty, 0, 0, radius));
+}
+
+//---------------------------------------------------------
+// Procedure: isValid()
+
+bool DubinsBidCache::isValid(double osx, double osy, double osh,
+			     double osv, double tx, double ty,
+			     double tvx, double tvy, double radius) const
+{
+  if(!m_valid || (radius != m_radius))
+    return(false);
+
+  if(fabs(osv - m_osv) > m_spd_tol)
+    return(false);
+
+  double vdx = tvx - m_tvx;
+  double vdy = tvy - m_tvy;
+  if(((vdx * vdx) + (vdy * vdy)) > (m_spd_tol * m_spd_tol))
+    return(false);
+
+  double tol2 = m_pos_tol * m_pos_tol;
+  double odx = osx - m_osx;
+  double ody = osy - m_osy;
+  if(((odx * odx) + (ody * ody)) > tol2)
+    return(false);
+
+  double tdx = tx - m_tx;
+  double tdy = ty - m_ty;
+  if(((tdx * tdx) + (tdy * tdy)) > tol2)
+    return(false);
+
+  if(angleDiff(osh, m_osh) > m_hdg_tol)
+    return(false);
+
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setBid()
+
+void DubinsBidCache::setBid(double osx, double osy, double osh,
+			    double tx, double ty, double radius,
+			    double bid)
+{
+  setBid(osx, osy, osh, 0, tx, ty, 0, 0, radius, bid);
+}
+
+//---------------------------------------------------------
+// Procedure: setBid()
+
+void DubinsBidCache::setBid(double osx, double osy, double osh,
+			    double osv, double tx, double ty,
+			    double tvx, double tvy, double radius,
+			    double bid)
+{
+  m_osx    = osx;
+  m_osy    = osy;
+  m_osh    = osh;
+  m_osv    = osv;
+  m_tx     = tx;
+  m_ty     = ty;
+  m_tvx    = tvx;
+  m_tvy    = tvy;
+  m_radius = radius;
+  m_bid    = bid;
+  m_valid  = true;
+}
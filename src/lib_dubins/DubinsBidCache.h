@@ -0,0 +1,72 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: DubinsBidCache.h                                     */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef DUBINS_BID_CACHE_HEADER
+#define DUBINS_BID_CACHE_HEADER
+
+//---------------------------------------------------------------
+// DubinsBidCache: holds the last bid along with the ownship pose,
+// target and turn radius it was computed for. The bid remains
+// valid until ownship or the target moves more than the position
+// tolerance, ownship heading changes more than the heading
+// tolerance, or the turn radius changes. Bids that depend on
+// motion (e.g. intercept time) also key on ownship speed and the
+// target velocity, and are invalidated when either changes more
+// than the speed tolerance.
+
+class DubinsBidCache
+{
+ public:
+  DubinsBidCache();
+  ~DubinsBidCache() {}
+
+  bool setPosTolerance(double);
+  bool setHdgTolerance(double);
+  bool setSpdTolerance(double);
+
+  bool   isValid(double osx, double osy, double osh,
+		 double tx, double ty, double radius) const;
+  bool   isValid(double osx, double osy, double osh, double osv,
+		 double tx, double ty, double tvx, double tvy,
+		 double radius) const;
+
+  void   setBid(double osx, double osy, double osh,
+		double tx, double ty, double radius, double bid);
+  void   setBid(double osx, double osy, double osh, double osv,
+		double tx, double ty, double tvx, double tvy,
+		double radius, double bid);
+  double getBid() const {return(m_bid);}
+  void   clear() {m_valid = false;}
+
+  double getPosTolerance() const {return(m_pos_tol);}
+  double getHdgTolerance() const {return(m_hdg_tol);}
+  double getSpdTolerance() const {return(m_spd_tol);}
+
+ private: // Configuration
+  double m_pos_tol;
+  double m_hdg_tol;
+  double m_spd_tol;
+
+ private: // State
+  bool   m_valid;
+  double m_osx;
+  double m_osy;
+  double m_osh;
+  double m_osv;
+  double m_tx;
+  double m_ty;
+  double m_tvx;
+  double m_tvy;
+  double m_radius;
+  double m_bid;
+};
+
+#endif
@@ -0,0 +1,274 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: DubinsBidEngine.cpp                                  */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cmath>
+#include "DubinsBidEngine.h"
+#include "DubinsPath.h"
+
+using namespace std;
+
+static const double two_pi = 2 * M_PI;
+
+//---------------------------------------------------------
+// Constructor()
+
+DubinsBidEngine::DubinsBidEngine()
+{
+  m_osx = 0;
+  m_osy = 0;
+  m_osh = 0;
+  m_radius = 1;
+  m_pose_set = false;
+
+  m_lcx = 0;
+  m_lcy = 0;
+  m_rcx = 0;
+  m_rcy = 0;
+  m_cos0 = 1;
+  m_sin0 = 0;
+
+  m_any_stale = false;
+}
+
+//---------------------------------------------------------
+// Procedure: setPose()
+//      Note: An unchanged pose keeps all cached bids.
+
+void DubinsBidEngine::setPose(double osx, double osy, double osh,
+			      double radius)
+{
+  if(m_pose_set && (osx == m_osx) && (osy == m_osy) &&
+     (osh == m_osh) && (radius == m_radius))
+    return;
+
+  m_osx = osx;
+  m_osy = osy;
+  m_osh = osh;
+  m_radius = radius;
+  m_pose_set = true;
+
+  double theta = (90 - osh) * M_PI / 180;
+  m_cos0 = cos(theta);
+  m_sin0 = sin(theta);
+
+  // Left circle center is to port: start direction rotated +90
+  m_lcx = osx - (radius * m_sin0);
+  m_lcy = osy + (radius * m_cos0);
+  m_rcx = osx + (radius * m_sin0);
+  m_rcy = osy - (radius * m_cos0);
+
+  for(unsigned int i=0; i<m_stale.size(); i++)
+    m_stale[i] = m_active[i];
+  m_any_stale = true;
+}
+
+//---------------------------------------------------------
+// Procedure: scoreTargets()
+//
+//   For each turn direction, with v the vector from the circle
+//   center to the target, d=|v| and s=sqrt(d^2-r^2) the straight
+//   leg, the arc swept from the start radial u0 to the tangent
+//   radial is the angle of
+//       left:   v * (r - i*s) * conj(u0)
+//       right:  conj(v * (r + i*s)) * u0
+//   where u0 = (sin0, -cos0) for left and (-sin0, cos0) for right.
+//   The loop body has no branches on the data, so it can be
+//   vectorized. Targets within 3r of either center may have a
+//   shorter turn-turn path and are rescored afterwards.
+
+void DubinsBidEngine::scoreTargets(const double* tx, const double* ty,
+				   double* lens, size_t count) const
+{
+  const double r  = m_radius;
+  const double r2 = r * r;
+  const double near2 = 9 * r2;
+
+  if(r <= 0) {
+    for(size_t i=0; i<count; i++)
+      lens[i] = hypot(tx[i]-m_osx, ty[i]-m_osy);
+    return;
+  }
+
+  const double big = 1e300;
+  bool any_near = false;
+  for(size_t i=0; i<count; i++) {
+    // Left turn
+    double lvx = tx[i] - m_lcx;
+    double lvy = ty[i] - m_lcy;
+    double ld2 = (lvx * lvx) + (lvy * lvy);
+    double ls  = sqrt(fmax(ld2 - r2, 0));
+    double lwx = (lvx * r) + (lvy * ls);     // v * (r - i*s)
+    double lwy = (lvy * r) - (lvx * ls);
+    double lax = (lwx * m_sin0) - (lwy * m_cos0);   // * conj(u0)
+    double lay = (lwy * m_sin0) + (lwx * m_cos0);
+    double larc = atan2(lay, lax);
+    larc = (larc < 0) ? larc + two_pi : larc;
+    double llen = (ld2 >= r2) ? (larc * r) + ls : big;
+
+    // Right turn
+    double rvx = tx[i] - m_rcx;
+    double rvy = ty[i] - m_rcy;
+    double rd2 = (rvx * rvx) + (rvy * rvy);
+    double rs  = sqrt(fmax(rd2 - r2, 0));
+    double rwx = (rvx * r) - (rvy * rs);     // v * (r + i*s)
+    double rwy = (rvy * r) + (rvx * rs);
+    double rax = (rwy * m_cos0) - (rwx * m_sin0);   // conj(.) * u0
+    double ray = (rwx * m_cos0) + (rwy * m_sin0);
+    double rarc = atan2(ray, rax);
+    rarc = (rarc < 0) ? rarc + two_pi : rarc;
+    double rlen = (rd2 >= r2) ? (rarc * r) + rs : big;
+
+    lens[i] = fmin(llen, rlen);
+    any_near = any_near || (ld2 <= near2) || (rd2 <= near2);
+  }
+
+  if(!any_near)
+    return;
+  for(size_t i=0; i<count; i++) {
+    double ldx = tx[i] - m_lcx;
+    double ldy = ty[i] - m_lcy;
+    double rdx = tx[i] - m_rcx;
+    double rdy = ty[i] - m_rcy;
+    if((((ldx*ldx) + (ldy*ldy)) <= near2) || (((rdx*rdx) + (rdy*rdy)) <= near2))
+      lens[i] = scoreNearTarget(tx[i], ty[i]);
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: scoreTarget()
+
+double DubinsBidEngine::scoreTarget(double tx, double ty) const
+{
+  double len = 0;
+  scoreTargets(&tx, &ty, &len, 1);
+  return(len);
+}
+
+//---------------------------------------------------------
+// Procedure: scoreNearTarget()
+
+double DubinsBidEngine::scoreNearTarget(double tx, double ty) const
+{
+  DubinsPath path;
+  path.setToPoint(m_osx, m_osy, m_osh, tx, ty, m_radius);
+  return(path.getLength());
+}
+
+//---------------------------------------------------------
+// Procedure: addTarget()
+//   Returns: slot index, valid until removeTarget()
+
+unsigned int DubinsBidEngine::addTarget(double tx, double ty)
+{
+  unsigned int slot = m_tx.size();
+  if(!m_free.empty()) {
+    slot = m_free.back();
+    m_free.pop_back();
+  }
+  else {
+    m_tx.push_back(0);
+    m_ty.push_back(0);
+    m_len.push_back(0);
+    m_stale.push_back(0);
+    m_active.push_back(0);
+  }
+
+  m_tx[slot] = tx;
+  m_ty[slot] = ty;
+  m_len[slot] = 0;
+  m_stale[slot] = 1;
+  m_active[slot] = 1;
+  m_any_stale = true;
+  return(slot);
+}
+
+//---------------------------------------------------------
+// Procedure: setTarget()
+
+void DubinsBidEngine::setTarget(unsigned int slot, double tx, double ty)
+{
+  if((slot >= m_tx.size()) || !m_active[slot])
+    return;
+  if((m_tx[slot] == tx) && (m_ty[slot] == ty))
+    return;
+
+  m_tx[slot] = tx;
+  m_ty[slot] = ty;
+  m_stale[slot] = 1;
+  m_any_stale = true;
+}
+
+//---------------------------------------------------------
+// Procedure: removeTarget()
+
+void DubinsBidEngine::removeTarget(unsigned int slot)
+{
+  if((slot >= m_tx.size()) || !m_active[slot])
+    return;
+  m_active[slot] = 0;
+  m_stale[slot] = 0;
+  m_free.push_back(slot);
+}
+
+//---------------------------------------------------------
+// Procedure: getBid()
+//   Returns: Path length to the slot target, or -1 if the slot
+//            is not in use
+
+double DubinsBidEngine::getBid(unsigned int slot)
+{
+  if((slot >= m_tx.size()) || !m_active[slot])
+    return(-1);
+
+  if(m_any_stale)
+    updateStale();
+  return(m_len[slot]);
+}
+
+//---------------------------------------------------------
+// Procedure: updateStale()
+//      Note: Gathers all stale slots and scores them in one pass
+
+void DubinsBidEngine::updateStale()
+{
+  m_ix_buff.clear();
+  m_tx_buff.clear();
+  m_ty_buff.clear();
+  for(unsigned int i=0; i<m_stale.size(); i++) {
+    if(m_stale[i]) {
+      m_ix_buff.push_back(i);
+      m_tx_buff.push_back(m_tx[i]);
+      m_ty_buff.push_back(m_ty[i]);
+      m_stale[i] = 0;
+    }
+  }
+  m_any_stale = false;
+
+  size_t count = m_ix_buff.size();
+  if(count == 0)
+    return;
+
+  m_len_buff.resize(count);
+  scoreTargets(m_tx_buff.data(), m_ty_buff.data(), m_len_buff.data(), count);
+  for(size_t i=0; i<count; i++)
+    m_len[m_ix_buff[i]] = m_len_buff[i];
+}
+
+//---------------------------------------------------------
+// Procedure: getSharedBidEngine()
+//      Note: One engine for all task behaviors of a module within
+//            the helm, so a new pose is processed once per round.
+
+DubinsBidEngine& getSharedBidEngine()
+{
+  static DubinsBidEngine engine;
+  return(engine);
+}
@@ -0,0 +1,90 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: DubinsBidEngine.h                                    */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef DUBINS_BID_ENGINE_HEADER
+#define DUBINS_BID_ENGINE_HEADER
+
+#include <vector>
+#include <cstddef>
+
+//---------------------------------------------------------------
+// DubinsBidEngine: shortest-path bids from one ownship pose to
+// many target points. The pose invariants (turn circle centers,
+// start direction) are computed once per pose, and targets are
+// scored in a batch pass over flat arrays, one atan2 per turn
+// direction. Targets within reach of a turn-turn path (rare) go
+// through DubinsPath. Results match DubinsPath::setToPoint().
+//
+// Targets may be registered in slots. A slot is rescored only
+// when its target or the pose changes, and all stale slots are
+// rescored together on the first query after a change. Task
+// behaviors share one engine per module via getSharedBidEngine().
+
+class DubinsBidEngine
+{
+ public:
+  DubinsBidEngine();
+  ~DubinsBidEngine() {}
+
+  void setPose(double osx, double osy, double osh, double radius);
+
+  // Stateless batch and single scoring against the current pose
+  void   scoreTargets(const double* tx, const double* ty,
+		      double* lens, std::size_t count) const;
+  double scoreTarget(double tx, double ty) const;
+
+  // Registered targets
+  unsigned int addTarget(double tx, double ty);
+  void   setTarget(unsigned int slot, double tx, double ty);
+  void   removeTarget(unsigned int slot);
+  double getBid(unsigned int slot);
+
+  unsigned int size() const {return(m_tx.size() - m_free.size());}
+
+  void getPose(double& osx, double& osy) const {osx=m_osx; osy=m_osy;}
+
+ protected:
+  void   updateStale();
+  double scoreNearTarget(double tx, double ty) const;
+
+ private: // Pose and invariants
+  double m_osx;
+  double m_osy;
+  double m_osh;
+  double m_radius;
+  bool   m_pose_set;
+
+  double m_lcx;     // left turn circle center
+  double m_lcy;
+  double m_rcx;     // right turn circle center
+  double m_rcy;
+  double m_cos0;    // start direction (math convention)
+  double m_sin0;
+
+ private: // Registered targets, structure of arrays
+  std::vector<double> m_tx;
+  std::vector<double> m_ty;
+  std::vector<double> m_len;
+  std::vector<char>   m_stale;
+  std::vector<char>   m_active;
+  std::vector<unsigned int> m_free;
+  bool m_any_stale;
+
+  // Scratch space for the batch pass, reused
+  std::vector<unsigned int> m_ix_buff;
+  std::vector<double> m_tx_buff;
+  std::vector<double> m_ty_buff;
+  std::vector<double> m_len_buff;
+};
+
+DubinsBidEngine& getSharedBidEngine();
+
+#endif
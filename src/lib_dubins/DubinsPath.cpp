@@ -0,0 +1,435 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: DubinsPath.cpp                                       */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cmath>
+#include "DubinsPath.h"
+
+using namespace std;
+
+static const double two_pi = 2 * M_PI;
+
+//---------------------------------------------------------
+// Procedure: mod2pi()
+
+static double mod2pi(double ang)
+{
+  ang = fmod(ang, two_pi);
+  if(ang < 0)
+    ang += two_pi;
+  return(ang);
+}
+
+//---------------------------------------------------------
+// Procedure: hdgToTheta()
+//      Note: MOOS heading (deg, 0 north, cw) to math angle
+//            (rad, 0 east, ccw), and back.
+
+static double hdgToTheta(double hdg)
+{
+  return(mod2pi((90 - hdg) * M_PI / 180));
+}
+
+static double thetaToHdg(double theta)
+{
+  double hdg = fmod(90 - (theta * 180 / M_PI), 360);
+  if(hdg < 0)
+    hdg += 360;
+  return(hdg);
+}
+
+//---------------------------------------------------------
+// Constructor()
+
+DubinsPath::DubinsPath()
+{
+  m_startx = 0;
+  m_starty = 0;
+  m_start_theta = 0;
+  m_radius = 1;
+  clear();
+}
+
+//---------------------------------------------------------
+// Procedure: clear()
+
+void DubinsPath::clear()
+{
+  m_type = DUBINS_NONE;
+  m_seg_len[0] = 0;
+  m_seg_len[1] = 0;
+  m_seg_len[2] = 0;
+}
+
+//---------------------------------------------------------
+// Procedure: setStart()
+
+void DubinsPath::setStart(double osx, double osy, double osh, double radius)
+{
+  clear();
+  m_startx = osx;
+  m_starty = osy;
+  m_start_theta = hdgToTheta(osh);
+  m_radius = radius;
+}
+
+//---------------------------------------------------------
+// Procedure: setToPoint()
+//   Returns: false if the radius is not positive
+//      Note: With a free final heading the shortest path is
+//            either turn-straight or turn-turn. Turn-turn is only
+//            shorter when the point is close to being inside one
+//            of the two turn circles. A point exactly at the start
+//            is a zero-length path.
+
+bool DubinsPath::setToPoint(double osx, double osy, double osh,
+			    double ptx, double pty, double radius)
+{
+  setStart(osx, osy, osh, radius);
+  if(radius <= 0)
+    return(false);
+
+  if(hypot(ptx-osx, pty-osy) == 0) {
+    m_type = DUBINS_LS;
+    return(true);
+  }
+
+  tryPointCS(ptx, pty, true);
+  tryPointCS(ptx, pty, false);
+  tryPointCC(ptx, pty, true);
+  tryPointCC(ptx, pty, false);
+  return(valid());
+}
+
+//---------------------------------------------------------
+// Procedure: tryPointCS()
+//
+//   Turn on the circle centered at c until the line from the
+//   tangent point t reaches the point p. The angle of c->p is the
+//   tangent point angle offset by acos(r/d).
+//
+//              t-------------------p
+//             /                    
+//            c
+
+void DubinsPath::tryPointCS(double ptx, double pty, bool left)
+{
+  double sgn = (left) ? 1 : -1;
+  double r = m_radius;
+  double cx = m_startx + r * cos(m_start_theta + sgn * M_PI/2);
+  double cy = m_starty + r * sin(m_start_theta + sgn * M_PI/2);
+
+  double d = hypot(ptx-cx, pty-cy);
+  if(d < r)
+    return;
+
+  double beta   = atan2(pty-cy, ptx-cx);
+  double offset = acos(r / d);
+  double theta0 = m_start_theta - sgn * M_PI/2;
+  double theta1 = beta - sgn * offset;
+
+  double arc = mod2pi(sgn * (theta1 - theta0));
+  double straight = sqrt((d * d) - (r * r));
+
+  if(left)
+    setIfShorter(DUBINS_LS, arc * r, straight, 0);
+  else
+    setIfShorter(DUBINS_RS, arc * r, straight, 0);
+}
+
+//---------------------------------------------------------
+// Procedure: tryPointCC()
+//      Note: The second circle center c2 is 2r from the first
+//            center c1 and r from the point. Both intersections
+//            of those two circles are candidates.
+
+void DubinsPath::tryPointCC(double ptx, double pty, bool left)
+{
+  double sgn = (left) ? 1 : -1;
+  double r = m_radius;
+  double c1x = m_startx + r * cos(m_start_theta + sgn * M_PI/2);
+  double c1y = m_starty + r * sin(m_start_theta + sgn * M_PI/2);
+
+  double d = hypot(ptx-c1x, pty-c1y);
+  if((d < r) || (d > 3*r) || (d == 0))
+    return;
+
+  // Circle-circle intersection, radii 2r (about c1) and r (about p)
+  double a = ((4*r*r) - (r*r) + (d*d)) / (2*d);
+  double h2 = (4*r*r) - (a*a);
+  if(h2 < 0)
+    h2 = 0;
+  double h = sqrt(h2);
+  double ux = (ptx-c1x) / d;
+  double uy = (pty-c1y) / d;
+  double mx = c1x + a * ux;
+  double my = c1y + a * uy;
+
+  double theta0 = m_start_theta - sgn * M_PI/2;
+  for(int k=-1; k<=1; k+=2) {
+    double c2x = mx - k * h * uy;
+    double c2y = my + k * h * ux;
+
+    // Switch point is midway between centers
+    double sw_ang1 = atan2(c2y-c1y, c2x-c1x);
+    double arc1 = mod2pi(sgn * (sw_ang1 - theta0));
+
+    double sw_ang2 = sw_ang1 + M_PI;
+    double end_ang = atan2(pty-c2y, ptx-c2x);
+    double arc2 = mod2pi(-sgn * (end_ang - sw_ang2));
+
+    if(left)
+      setIfShorter(DUBINS_LR, arc1 * r, arc2 * r, 0);
+    else
+      setIfShorter(DUBINS_RL, arc1 * r, arc2 * r, 0);
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: setToPose()
+//   Returns: false if the radius is not positive
+//      Note: Standard six-word Dubins solution in normalized
+//            coordinates, e.g., Shkel and Lumelsky (2001).
+
+bool DubinsPath::setToPose(double osx, double osy, double osh,
+			   double ptx, double pty, double pth, double radius)
+{
+  setStart(osx, osy, osh, radius);
+  if(radius <= 0)
+    return(false);
+
+  double dx = ptx - osx;
+  double dy = pty - osy;
+  double d  = hypot(dx, dy) / radius;
+  double phi = (d > 0) ? atan2(dy, dx) : 0;
+
+  double alpha = mod2pi(m_start_theta - phi);
+  double beta  = mod2pi(hdgToTheta(pth) - phi);
+
+  tryPoseWord(DUBINS_LSL, alpha, beta, d);
+  tryPoseWord(DUBINS_RSR, alpha, beta, d);
+  tryPoseWord(DUBINS_LSR, alpha, beta, d);
+  tryPoseWord(DUBINS_RSL, alpha, beta, d);
+  tryPoseWord(DUBINS_RLR, alpha, beta, d);
+  tryPoseWord(DUBINS_LRL, alpha, beta, d);
+  return(valid());
+}
+
+//---------------------------------------------------------
+// Procedure: tryPoseWord()
+
+void DubinsPath::tryPoseWord(DubinsType type, double alpha,
+			     double beta, double d)
+{
+  double sa = sin(alpha);
+  double sb = sin(beta);
+  double ca = cos(alpha);
+  double cb = cos(beta);
+  double c_ab = cos(alpha - beta);
+
+  double t = 0, p = 0, q = 0;
+  if(type == DUBINS_LSL) {
+    double p_sq = 2 + (d*d) - (2*c_ab) + (2*d*(sa - sb));
+    if(p_sq < 0)
+      return;
+    double tmp = atan2(cb - ca, d + sa - sb);
+    t = mod2pi(tmp - alpha);
+    p = sqrt(p_sq);
+    q = mod2pi(beta - tmp);
+  }
+  else if(type == DUBINS_RSR) {
+    double p_sq = 2 + (d*d) - (2*c_ab) + (2*d*(sb - sa));
+    if(p_sq < 0)
+      return;
+    double tmp = atan2(ca - cb, d - sa + sb);
+    t = mod2pi(alpha - tmp);
+    p = sqrt(p_sq);
+    q = mod2pi(tmp - beta);
+  }
+  else if(type == DUBINS_LSR) {
+    double p_sq = -2 + (d*d) + (2*c_ab) + (2*d*(sa + sb));
+    if(p_sq < 0)
+      return;
+    p = sqrt(p_sq);
+    double tmp = atan2(-ca - cb, d + sa + sb) - atan2(-2.0, p);
+    t = mod2pi(tmp - alpha);
+    q = mod2pi(tmp - beta);
+  }
+  else if(type == DUBINS_RSL) {
+    double p_sq = -2 + (d*d) + (2*c_ab) - (2*d*(sa + sb));
+    if(p_sq < 0)
+      return;
+    p = sqrt(p_sq);
+    double tmp = atan2(ca + cb, d - sa - sb) - atan2(2.0, p);
+    t = mod2pi(alpha - tmp);
+    q = mod2pi(beta - tmp);
+  }
+  else if(type == DUBINS_RLR) {
+    double tmp = (6 - (d*d) + (2*c_ab) + (2*d*(sa - sb))) / 8;
+    if(fabs(tmp) > 1)
+      return;
+    double phi = atan2(ca - cb, d - sa + sb);
+    p = mod2pi(two_pi - acos(tmp));
+    t = mod2pi(alpha - phi + (p/2));
+    q = mod2pi(alpha - beta - t + p);
+  }
+  else if(type == DUBINS_LRL) {
+    double tmp = (6 - (d*d) + (2*c_ab) + (2*d*(sb - sa))) / 8;
+    if(fabs(tmp) > 1)
+      return;
+    double phi = atan2(ca - cb, d + sa - sb);
+    p = mod2pi(two_pi - acos(tmp));
+    t = mod2pi(-alpha - phi + (p/2));
+    q = mod2pi(beta - alpha - t + p);
+  }
+  else
+    return;
+
+  setIfShorter(type, t * m_radius, p * m_radius, q * m_radius);
+}
+
+//---------------------------------------------------------
+// Procedure: setIfShorter()
+
+void DubinsPath::setIfShorter(DubinsType type, double len0,
+			      double len1, double len2)
+{
+  double len = len0 + len1 + len2;
+  if((m_type != DUBINS_NONE) && (len >= getLength()))
+    return;
+
+  m_type = type;
+  m_seg_len[0] = len0;
+  m_seg_len[1] = len1;
+  m_seg_len[2] = len2;
+}
+
+//---------------------------------------------------------
+// Procedure: getSegLength()
+
+double DubinsPath::getSegLength(unsigned int ix) const
+{
+  if(ix > 2)
+    return(0);
+  return(m_seg_len[ix]);
+}
+
+//---------------------------------------------------------
+// Procedure: getTypeStr()
+
+string DubinsPath::getTypeStr() const
+{
+  switch(m_type) {
+  case DUBINS_LS:  return("LS");
+  case DUBINS_RS:  return("RS");
+  case DUBINS_LR:  return("LR");
+  case DUBINS_RL:  return("RL");
+  case DUBINS_LSL: return("LSL");
+  case DUBINS_RSR: return("RSR");
+  case DUBINS_LSR: return("LSR");
+  case DUBINS_RSL: return("RSL");
+  case DUBINS_RLR: return("RLR");
+  case DUBINS_LRL: return("LRL");
+  default:         return("none");
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: segKind()
+//   Returns: 'L', 'R' or 'S' for the given segment, or 0
+
+char DubinsPath::segKind(unsigned int ix) const
+{
+  string str = getTypeStr();
+  if((m_type == DUBINS_NONE) || (ix >= str.length()))
+    return(0);
+  return(str[ix]);
+}
+
+//---------------------------------------------------------
+// Procedure: getPoint()
+//   Purpose: Pose at the given distance along the path. Clipped
+//            to the ends of the path.
+
+void DubinsPath::getPoint(double dist, double& x, double& y,
+			  double& hdg) const
+{
+  double px = m_startx;
+  double py = m_starty;
+  double theta = m_start_theta;
+  double r = m_radius;
+
+  if(dist < 0)
+    dist = 0;
+
+  for(unsigned int i=0; (i<3) && (dist > 0); i++) {
+    char kind = segKind(i);
+    if(kind == 0)
+      break;
+    double len = m_seg_len[i];
+    if(len > dist)
+      len = dist;
+    dist -= len;
+
+    if(kind == 'S') {
+      px += len * cos(theta);
+      py += len * sin(theta);
+    }
+    else {
+      double sgn = (kind == 'L') ? 1 : -1;
+      double cx = px + r * cos(theta + sgn * M_PI/2);
+      double cy = py + r * sin(theta + sgn * M_PI/2);
+      theta += sgn * (len / r);
+      px = cx + r * cos(theta - sgn * M_PI/2);
+      py = cy + r * sin(theta - sgn * M_PI/2);
+    }
+  }
+
+  x = px;
+  y = py;
+  hdg = thetaToHdg(theta);
+}
+
+//---------------------------------------------------------
+// Procedure: getSegList()
+//      Note: Arcs are sampled every ang_step degrees. Each
+//            straight segment adds just its end point.
+
+XYSegList DubinsPath::getSegList(double ang_step) const
+{
+  XYSegList segl;
+  segl.add_vertex(m_startx, m_starty);
+  if(!valid())
+    return(segl);
+
+  if(ang_step <= 0)
+    ang_step = 5;
+  double arc_step = m_radius * ang_step * M_PI / 180;
+
+  double dist = 0;
+  for(unsigned int i=0; i<3; i++) {
+    char kind = segKind(i);
+    if(kind == 0)
+      break;
+    double seg_end = dist + m_seg_len[i];
+    if(kind != 'S') {
+      for(double d=dist+arc_step; d<seg_end; d+=arc_step) {
+	double x, y, hdg;
+	getPoint(d, x, y, hdg);
+	segl.add_vertex(x, y);
+      }
+    }
+    double x, y, hdg;
+    getPoint(seg_end, x, y, hdg);
+    segl.add_vertex(x, y);
+    dist = seg_end;
+  }
+  return(segl);
+}
@@ -0,0 +1,73 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: DubinsPath.h                                         */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef DUBINS_PATH_HEADER
+#define DUBINS_PATH_HEADER
+
+#include <string>
+#include "XYSegList.h"
+
+//---------------------------------------------------------------
+// Closed-form shortest path for a vehicle with a minimum turn
+// radius, from a pose (x, y, heading) to either
+//   (a) a point, heading free:  types LS, RS, LR, RL
+//   (b) a pose:                 types LSL, RSR, LSR, RSL, RLR, LRL
+// Headings are in degrees, 0 north and clockwise, as in MOOS-IvP.
+// Solving does no iteration and no heap allocation. The path may
+// be sampled into an XYSegList afterwards, e.g., for rendering.
+
+enum DubinsType {
+  DUBINS_NONE = 0,
+  DUBINS_LS,  DUBINS_RS,  DUBINS_LR,  DUBINS_RL,
+  DUBINS_LSL, DUBINS_RSR, DUBINS_LSR, DUBINS_RSL,
+  DUBINS_RLR, DUBINS_LRL
+};
+
+class DubinsPath
+{
+ public:
+  DubinsPath();
+  ~DubinsPath() {}
+
+  bool setToPoint(double osx, double osy, double osh,
+		  double ptx, double pty, double radius);
+  bool setToPose(double osx, double osy, double osh,
+		 double ptx, double pty, double pth, double radius);
+
+  bool   valid() const        {return(m_type != DUBINS_NONE);}
+  double getLength() const    {return(m_seg_len[0]+m_seg_len[1]+m_seg_len[2]);}
+  double getSegLength(unsigned int ix) const;
+  DubinsType  getType() const {return(m_type);}
+  std::string getTypeStr() const;
+
+  void   getPoint(double dist, double& x, double& y, double& hdg) const;
+  XYSegList getSegList(double ang_step=5) const;
+
+ protected:
+  void   clear();
+  void   setStart(double osx, double osy, double osh, double radius);
+  char   segKind(unsigned int ix) const;
+  void   tryPointCS(double ptx, double pty, bool left);
+  void   tryPointCC(double ptx, double pty, bool left);
+  void   tryPoseWord(DubinsType, double alpha, double beta, double d);
+  void   setIfShorter(DubinsType, double len0, double len1, double len2);
+
+ private:
+  double m_startx;
+  double m_starty;
+  double m_start_theta;  // radians, math convention (0 east, ccw)
+  double m_radius;
+
+  DubinsType m_type;
+  double     m_seg_len[3];  // meters
+};
+
+#endif
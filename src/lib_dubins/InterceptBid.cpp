@@ -0,0 +1,209 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: InterceptBid.cpp                                     */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cmath>
+#include "InterceptBid.h"
+#include "DubinsBidEngine.h"
+
+using namespace std;
+
+// Weight given to each new velocity sample
+static const double vel_alpha = 0.5;
+// Positions older than this (secs) do not give a velocity
+static const double max_sample_gap = 10;
+// Intercept time is solved to within this (secs)
+static const double time_tol = 0.01;
+static const unsigned int max_iters = 12;
+// Floor on ownship speed when no join speed is configured
+static const double min_join_speed = 0.5;
+
+//---------------------------------------------------------
+// Constructor()
+
+InterceptBid::InterceptBid()
+{
+  m_join_range = 0;
+  m_max_time = 600;
+  m_join_speed = 0;
+  clear();
+}
+
+//---------------------------------------------------------
+// Procedure: clear()
+
+void InterceptBid::clear()
+{
+  m_cnx  = 0;
+  m_cny  = 0;
+  m_cnvx = 0;
+  m_cnvy = 0;
+  m_utc  = 0;
+  m_samples = 0;
+}
+
+//---------------------------------------------------------
+// Procedure: setJoinRange()
+
+bool InterceptBid::setJoinRange(double val)
+{
+  if(val < 0)
+    return(false);
+  m_join_range = val;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setMaxTime()
+
+bool InterceptBid::setMaxTime(double val)
+{
+  if(val <= 0)
+    return(false);
+  m_max_time = val;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setJoinSpeed()
+//      Note: Zero means use the current ownship speed
+
+bool InterceptBid::setJoinSpeed(double val)
+{
+  if(val < 0)
+    return(false);
+  m_join_speed = val;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: updateContact()
+//      Note: The helm may present the same contact position on
+//            several iterations between reports, so a velocity
+//            sample is only taken when the position changes.
+
+void InterceptBid::updateContact(double cnx, double cny, double utc)
+{
+  if(m_samples > 0) {
+    if((cnx == m_cnx) && (cny == m_cny))
+      return;
+    double dt = utc - m_utc;
+    if(dt <= 0)
+      return;
+    if(dt > max_sample_gap) {
+      m_cnvx = 0;
+      m_cnvy = 0;
+      m_samples = 0;
+    }
+    else {
+      double vx = (cnx - m_cnx) / dt;
+      double vy = (cny - m_cny) / dt;
+      if(m_samples == 1) {
+	m_cnvx = vx;
+	m_cnvy = vy;
+      }
+      else {
+	m_cnvx += vel_alpha * (vx - m_cnvx);
+	m_cnvy += vel_alpha * (vy - m_cnvy);
+      }
+    }
+  }
+
+  m_cnx = cnx;
+  m_cny = cny;
+  m_utc = utc;
+  m_samples++;
+}
+
+//---------------------------------------------------------
+// Procedure: setContact()
+//      Note: For callers that know the contact velocity, e.g.,
+//            from node reports, rather than estimating it.
+
+void InterceptBid::setContact(double cnx, double cny,
+			      double cnvx, double cnvy)
+{
+  m_cnx  = cnx;
+  m_cny  = cny;
+  m_cnvx = cnvx;
+  m_cnvy = cnvy;
+  m_samples = 0;
+}
+
+//---------------------------------------------------------
+// Procedure: getJoinPoint()
+
+void InterceptBid::getJoinPoint(double t, double& x, double& y) const
+{
+  x = m_cnx + (m_cnvx * t);
+  y = m_cny + (m_cnvy * t);
+
+  double spd = hypot(m_cnvx, m_cnvy);
+  if((m_join_range > 0) && (spd > 0)) {
+    x -= m_join_range * (m_cnvx / spd);
+    y -= m_join_range * (m_cnvy / spd);
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: getBid()
+//   Returns: Time in seconds to join the contact
+//
+//   The straight-line intercept time is a lower bound, since no
+//   path is shorter than the straight line. From there, iterate
+//   t = L(t)/u, where L(t) is the path length to the join point at
+//   time t. When the contact is slower than ownship, L changes by
+//   at most v*dt, so the iteration converges from below at rate v/u.
+
+double InterceptBid::getBid(const DubinsBidEngine& engine,
+			    double os_spd) const
+{
+  double u = os_spd;
+  if(m_join_speed > 0)
+    u = m_join_speed;
+  else if(u < min_join_speed)
+    u = min_join_speed;
+
+  double jx, jy;
+  getJoinPoint(0, jx, jy);
+  double vv = (m_cnvx * m_cnvx) + (m_cnvy * m_cnvy);
+  if(vv >= (u * u))
+    return(m_max_time + engine.scoreTarget(jx, jy) / u);
+
+  // Straight-line intercept: |d + v*t| = u*t, d from ownship
+  double ox, oy;
+  engine.getPose(ox, oy);
+  double dx = jx - ox;
+  double dy = jy - oy;
+  double a = vv - (u * u);
+  double b = 2 * ((dx * m_cnvx) + (dy * m_cnvy));
+  double c = (dx * dx) + (dy * dy);
+  double disc = (b * b) - (4 * a * c);
+  double t = 0;
+  if(disc > 0)
+    t = (-b - sqrt(disc)) / (2 * a);
+  if(t < 0)
+    t = 0;
+
+  for(unsigned int i=0; i<max_iters; i++) {
+    getJoinPoint(t, jx, jy);
+    double next_t = engine.scoreTarget(jx, jy) / u;
+    bool done = (fabs(next_t - t) < time_tol);
+    t = next_t;
+    if(done || (t > m_max_time))
+      break;
+  }
+
+  if(t > m_max_time) {
+    getJoinPoint(0, jx, jy);
+    return(m_max_time + engine.scoreTarget(jx, jy) / u);
+  }
+  return(t);
+}
@@ -0,0 +1,65 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: InterceptBid.h                                       */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef INTERCEPT_BID_HEADER
+#define INTERCEPT_BID_HEADER
+
+class DubinsBidEngine;
+
+//---------------------------------------------------------------
+// InterceptBid: time for ownship to join a moving contact. The
+// contact velocity is estimated from successive positions. The
+// join point is join_range behind the contact on its projected
+// track, and the bid is the earliest time t at which the Dubins
+// path length to the join point at time t, at ownship speed, is
+// no more than t. If ownship is too slow to catch the contact
+// within max_time, the bid is max_time plus the time to reach
+// the contact's current join point, so slower agents still rank
+// behind faster ones. Ownship speed is the configured join speed,
+// or if not set, the current speed with a small floor.
+
+class InterceptBid
+{
+ public:
+  InterceptBid();
+  ~InterceptBid() {}
+
+  bool setJoinRange(double);
+  bool setMaxTime(double);
+  bool setJoinSpeed(double);
+
+  void updateContact(double cnx, double cny, double utc);
+  void setContact(double cnx, double cny, double cnvx, double cnvy);
+  void clear();
+
+  double getBid(const DubinsBidEngine& engine, double os_spd) const;
+
+  double getContactVX() const {return(m_cnvx);}
+  double getContactVY() const {return(m_cnvy);}
+
+ protected:
+  void getJoinPoint(double t, double& x, double& y) const;
+
+ private: // Configuration
+  double m_join_range;
+  double m_max_time;
+  double m_join_speed;
+
+ private: // Contact track estimate
+  double m_cnx;
+  double m_cny;
+  double m_cnvx;
+  double m_cnvy;
+  double m_utc;
+  unsigned int m_samples;
+};
+
+#endif
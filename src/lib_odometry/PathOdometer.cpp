@@ -0,0 +1,264 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: PathOdometer.cpp                                     */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cmath>
+#include "PathOdometer.h"
+
+using namespace std;
+
+//---------------------------------------------------------
+// Constructor()
+
+PathOdometer::PathOdometer()
+{
+  m_depth_thresh = 0;
+  m_pair_tol     = 0.05;
+  m_rate_window  = 10;
+  m_use_depth    = false;
+  m_use_3d       = false;
+
+  clear();
+}
+
+//---------------------------------------------------------
+// Procedure: clear()
+//      Note: Keeps the configuration
+
+void PathOdometer::clear()
+{
+  m_x  = 0;
+  m_xt = 0;
+  m_x_fresh = false;
+  m_y  = 0;
+  m_yt = 0;
+  m_y_fresh = false;
+  m_depth   = 0;
+  m_depth_t = 0;
+  m_depth_set = false;
+
+  m_hx = 0;
+  m_hy = 0;
+  m_ht = 0;
+  m_held = false;
+
+  m_last_x = 0;
+  m_last_y = 0;
+  m_last_z = 0;
+  m_last_t = 0;
+  m_last_deep = false;
+
+  m_dist = 0;
+  m_dist_c = 0;
+  m_depth_dist = 0;
+  m_depth_dist_c = 0;
+  m_seg_dist = 0;
+  m_seg_dist_c = 0;
+
+  m_segments   = 0;
+  m_in_segment = false;
+  m_fixes      = 0;
+  m_unpaired   = 0;
+  m_dropped    = 0;
+
+  m_history.clear();
+}
+
+//---------------------------------------------------------
+// Procedure: setRateWindow()
+
+void PathOdometer::setRateWindow(double secs)
+{
+  m_rate_window = (secs <= 0) ? 1 : secs;
+}
+
+//---------------------------------------------------------
+// Procedure: updateX()
+//      Note: A pending X with no Y to pair with is replaced
+
+bool PathOdometer::updateX(double x, double t)
+{
+  if(m_y_fresh) {
+    if(fabs(t - m_yt) <= m_pair_tol) {
+      m_y_fresh = false;
+      return(pairFix(x, m_y, (t > m_yt) ? t : m_yt));
+    }
+    if(m_yt < t) {
+      m_y_fresh = false;
+      m_unpaired++;
+    }
+  }
+
+  if(m_x_fresh)
+    m_unpaired++;
+  m_x  = x;
+  m_xt = t;
+  m_x_fresh = true;
+  return(false);
+}
+
+//---------------------------------------------------------
+// Procedure: updateY()
+
+bool PathOdometer::updateY(double y, double t)
+{
+  if(m_x_fresh) {
+    if(fabs(t - m_xt) <= m_pair_tol) {
+      m_x_fresh = false;
+      return(pairFix(m_x, y, (t > m_xt) ? t : m_xt));
+    }
+    if(m_xt < t) {
+      m_x_fresh = false;
+      m_unpaired++;
+    }
+  }
+
+  if(m_y_fresh)
+    m_unpaired++;
+  m_y  = y;
+  m_yt = t;
+  m_y_fresh = true;
+  return(false);
+}
+
+//---------------------------------------------------------
+// Procedure: updateDepth()
+
+bool PathOdometer::updateDepth(double depth, double t)
+{
+  m_depth   = depth;
+  m_depth_t = t;
+  m_depth_set = true;
+
+  if(m_held && (fabs(t - m_ht) <= m_pair_tol)) {
+    m_held = false;
+    return(addFix(m_hx, m_hy, depth, m_ht));
+  }
+  return(false);
+}
+
+//---------------------------------------------------------
+// Procedure: pairFix()
+//      Note: With depth in use, a fix whose depth has not yet
+//            arrived is held. If the next fix forms first, the
+//            held one goes in with the latest depth.
+
+bool PathOdometer::pairFix(double x, double y, double t)
+{
+  if(!m_use_depth)
+    return(addFix(x, y, m_depth, t));
+
+  if(m_depth_set && (fabs(t - m_depth_t) <= m_pair_tol))
+    return(addFix(x, y, m_depth, t));
+
+  bool added = false;
+  if(m_held)
+    added = addFix(m_hx, m_hy, m_depth, m_ht);
+
+  m_hx = x;
+  m_hy = y;
+  m_ht = t;
+  m_held = true;
+  return(added);
+}
+
+//---------------------------------------------------------
+// Procedure: addFix()
+
+bool PathOdometer::addFix(double x, double y, double z, double t)
+{
+  bool deep = (z >= m_depth_thresh);
+
+  if(m_fixes == 0) {
+    m_last_x = x;
+    m_last_y = y;
+    m_last_z = z;
+    m_last_t = t;
+    m_last_deep = deep;
+    m_fixes = 1;
+    m_history.push_back(make_pair(t, 0.0));
+    return(true);
+  }
+
+  if(t < m_last_t) {
+    m_dropped++;
+    return(false);
+  }
+
+  double dx = x - m_last_x;
+  double dy = y - m_last_y;
+  double step = 0;
+  if(m_use_3d) {
+    double dz = z - m_last_z;
+    step = sqrt(dx*dx + dy*dy + dz*dz);
+  }
+  else
+    step = hypot(dx, dy);
+
+  addComp(m_dist, m_dist_c, step);
+
+  if(deep && m_last_deep) {
+    if(!m_in_segment) {
+      m_segments++;
+      m_seg_dist   = 0;
+      m_seg_dist_c = 0;
+      m_in_segment = true;
+    }
+    addComp(m_depth_dist, m_depth_dist_c, step);
+    addComp(m_seg_dist, m_seg_dist_c, step);
+  }
+  else
+    m_in_segment = false;
+
+  m_last_x = x;
+  m_last_y = y;
+  m_last_z = z;
+  m_last_t = t;
+  m_last_deep = deep;
+  m_fixes++;
+
+  m_history.push_back(make_pair(t, getDist()));
+  while((m_history.size() > 2) &&
+	((t - m_history[1].first) >= m_rate_window))
+    m_history.pop_front();
+
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: getRate()
+//   Returns: Distance per second over the rate window, or 0
+//            until fixes span some time
+
+double PathOdometer::getRate() const
+{
+  if(m_history.size() < 2)
+    return(0);
+
+  double secs = m_history.back().first - m_history.front().first;
+  if(secs <= 0)
+    return(0);
+  return((m_history.back().second - m_history.front().second) / secs);
+}
+
+//---------------------------------------------------------
+// Procedure: addComp()
+//      Note: Neumaier's compensated summation. The running error
+//            is kept in comp and added back when read.
+
+void PathOdometer::addComp(double& sum, double& comp, double val)
+{
+  double total = sum + val;
+  if(fabs(sum) >= fabs(val))
+    comp += (sum - total) + val;
+  else
+    comp += (val - total) + sum;
+  sum = total;
+}
@@ -0,0 +1,124 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: PathOdometer.h                                       */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef PATH_ODOMETER_HEADER
+#define PATH_ODOMETER_HEADER
+
+#include <deque>
+#include <utility>
+
+//---------------------------------------------------------------
+// PathOdometer: distance travelled along the path, summed fix by
+// fix as nav samples arrive rather than once per app iteration,
+// so the result does not depend on the AppTick or how mail is
+// batched.
+//
+// X and Y samples are paired into a fix when their timestamps are
+// within the pairing tolerance. With depth in use, a fix is held
+// until a depth sample near its time arrives, or until the next
+// fix forms, in which case the latest depth is used. Fixes older
+// than the last one are dropped.
+//
+// Each step between fixes adds its 2D length, or 3D with depth
+// change if enabled, using compensated summation so long runs of
+// short steps do not lose precision. A step with both ends at or
+// below the depth threshold also counts toward the distance at
+// depth, and a run of such steps is a segment. The rate is the
+// distance over the last rate_window seconds of fixes.
+
+class PathOdometer
+{
+ public:
+  PathOdometer();
+  ~PathOdometer() {}
+
+  void clear();
+
+  void setDepthThresh(double v)  {m_depth_thresh = v;}
+  void setUseDepth(bool v)       {m_use_depth = v || m_use_3d;}
+  void setUse3D(bool v)          {m_use_3d = v; m_use_depth |= v;}
+  void setPairTol(double secs)   {m_pair_tol = (secs < 0) ? 0 : secs;}
+  void setRateWindow(double secs);
+
+  // Each returns true if a new fix was added
+  bool updateX(double x, double t);
+  bool updateY(double y, double t);
+  bool updateDepth(double depth, double t);
+
+  double getDist() const        {return(m_dist + m_dist_c);}
+  double getDistAtDepth() const {return(m_depth_dist + m_depth_dist_c);}
+  double getSegmentDist() const {return(m_seg_dist + m_seg_dist_c);}
+  double getRate() const;
+
+  unsigned int getSegments() const {return(m_segments);}
+  unsigned int getFixes() const    {return(m_fixes);}
+  unsigned int getUnpaired() const {return(m_unpaired);}
+  unsigned int getDropped() const  {return(m_dropped);}
+
+  bool   atDepth() const  {return(m_fixes && m_last_deep);}
+  double getDepth() const {return(m_depth);}
+
+ protected:
+  bool pairFix(double x, double y, double t);
+  bool addFix(double x, double y, double z, double t);
+
+  static void addComp(double& sum, double& comp, double val);
+
+ private: // Configuration
+  double m_depth_thresh;
+  double m_pair_tol;
+  double m_rate_window;
+  bool   m_use_depth;
+  bool   m_use_3d;
+
+ private: // Unpaired samples
+  double m_x;
+  double m_xt;
+  bool   m_x_fresh;
+  double m_y;
+  double m_yt;
+  bool   m_y_fresh;
+  double m_depth;
+  double m_depth_t;
+  bool   m_depth_set;
+
+ private: // Fix waiting on depth
+  double m_hx;
+  double m_hy;
+  double m_ht;
+  bool   m_held;
+
+ private: // Last fix
+  double m_last_x;
+  double m_last_y;
+  double m_last_z;
+  double m_last_t;
+  bool   m_last_deep;
+
+ private: // Totals, each with its compensation term
+  double m_dist;
+  double m_dist_c;
+  double m_depth_dist;
+  double m_depth_dist_c;
+  double m_seg_dist;
+  double m_seg_dist_c;
+
+  unsigned int m_segments;
+  bool         m_in_segment;
+  unsigned int m_fixes;
+  unsigned int m_unpaired;
+  unsigned int m_dropped;
+
+  // Time and total distance of recent fixes, for the rate
+  std::deque<std::pair<double, double> > m_history;
+};
+
+#endif
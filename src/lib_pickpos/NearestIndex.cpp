@@ -0,0 +1,164 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: NearestIndex.cpp                                     */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cmath>
+#include <algorithm>
+#include "NearestIndex.h"
+
+using namespace std;
+
+//---------------------------------------------------------
+// Constructor()
+
+NearestIndex::NearestIndex()
+{
+  m_global_nearest = -1;
+}
+
+//---------------------------------------------------------
+// Procedure: setPoints()
+//      Note: Rings of cells are searched outward from a point's
+//            own cell. A point in ring k is at least (k-1) cells
+//            away, so the search stops once that exceeds the best
+//            distance so far.
+
+void NearestIndex::setPoints(const vector<double>& xs,
+			     const vector<double>& ys)
+{
+  unsigned int count = min(xs.size(), ys.size());
+  m_nearest.assign(count, -1);
+  m_global_nearest = -1;
+  if(count < 2)
+    return;
+
+  double xmin = xs[0];
+  double xmax = xs[0];
+  double ymin = ys[0];
+  double ymax = ys[0];
+  for(unsigned int i=1; i<count; i++) {
+    xmin = min(xmin, xs[i]);
+    xmax = max(xmax, xs[i]);
+    ymin = min(ymin, ys[i]);
+    ymax = max(ymax, ys[i]);
+  }
+
+  // Cell size for about one point per cell. Guard against all
+  // points lying on a line or on top of each other. Cells are no
+  // smaller than the long side over the count, so a near flat set
+  // still has no more than about 3*count cells.
+  double width  = xmax - xmin;
+  double height = ymax - ymin;
+  double cell = sqrt((width * height) / count);
+  cell = max(cell, max(width, height) / count);
+  if(cell <= 0)
+    cell = 1;
+
+  int nx = (int)(width / cell) + 1;
+  int ny = (int)(height / cell) + 1;
+
+  // Bucket the points, as index lists per cell
+  vector<int> pcx(count), pcy(count);
+  vector<unsigned int> cell_start((size_t)(nx) * ny + 1, 0);
+  for(unsigned int i=0; i<count; i++) {
+    pcx[i] = min(nx-1, (int)((xs[i] - xmin) / cell));
+    pcy[i] = min(ny-1, (int)((ys[i] - ymin) / cell));
+    cell_start[(size_t)(pcy[i])*nx + pcx[i] + 1]++;
+  }
+  for(size_t c=1; c<cell_start.size(); c++)
+    cell_start[c] += cell_start[c-1];
+  vector<unsigned int> cell_pts(count);
+  vector<unsigned int> fill(cell_start.begin(), cell_start.end()-1);
+  for(unsigned int i=0; i<count; i++)
+    cell_pts[fill[(size_t)(pcy[i])*nx + pcx[i]]++] = i;
+
+  int max_ring = max(nx, ny);
+  for(unsigned int i=0; i<count; i++) {
+    double best2 = -1;
+    for(int ring=0; ring<=max_ring; ring++) {
+      double ring_min = (ring - 1) * cell;
+      if((best2 >= 0) && (ring_min > 0) && ((ring_min * ring_min) > best2))
+	break;
+      int jlo = max(0, pcy[i]-ring);
+      int jhi = min(ny-1, pcy[i]+ring);
+      int klo = max(0, pcx[i]-ring);
+      int khi = min(nx-1, pcx[i]+ring);
+      for(int j=jlo; j<=jhi; j++) {
+	// Interior rows of the ring only have their two end cells,
+	// which may lie outside the grid
+	bool edge_row = ((j == pcy[i]-ring) || (j == pcy[i]+ring));
+	int step = edge_row ? 1 : (2 * ring);
+	int kfirst = edge_row ? klo : (pcx[i]-ring);
+	for(int k=kfirst; k<=khi; k+=step) {
+	  if(k < 0)
+	    continue;
+	  size_t c = (size_t)(j)*nx + k;
+	  for(unsigned int b=cell_start[c]; b<cell_start[c+1]; b++) {
+	    unsigned int n = cell_pts[b];
+	    if(n == i)
+	      continue;
+	    double dx = xs[n] - xs[i];
+	    double dy = ys[n] - ys[i];
+	    double d2 = (dx*dx) + (dy*dy);
+	    if((best2 < 0) || (d2 < best2))
+	      best2 = d2;
+	  }
+	}
+      }
+    }
+    m_nearest[i] = sqrt(best2);
+    if((m_global_nearest < 0) || (m_nearest[i] < m_global_nearest))
+      m_global_nearest = m_nearest[i];
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: countBelow()
+
+unsigned int NearestIndex::countBelow(double sep) const
+{
+  unsigned int total = 0;
+  for(unsigned int i=0; i<m_nearest.size(); i++) {
+    if((m_nearest[i] >= 0) && (m_nearest[i] < sep))
+      total++;
+  }
+  return(total);
+}
+
+//---------------------------------------------------------
+// Procedure: histogram()
+
+vector<unsigned int> NearestIndex::histogram(const vector<double>& vals,
+					     double width,
+					     unsigned int max_bins)
+{
+  vector<unsigned int> bins;
+  if((width <= 0) || (max_bins == 0))
+    return(bins);
+
+  double max_dist = -1;
+  for(unsigned int i=0; i<vals.size(); i++)
+    max_dist = max(max_dist, vals[i]);
+  if(max_dist < 0)
+    return(bins);
+
+  unsigned int bin_count = (unsigned int)(max_dist / width) + 1;
+  bins.assign(min(bin_count, max_bins), 0);
+
+  for(unsigned int i=0; i<vals.size(); i++) {
+    if(vals[i] < 0)
+      continue;
+    unsigned int ix = (unsigned int)(vals[i] / width);
+    if(ix >= bins.size())
+      ix = bins.size() - 1;
+    bins[ix]++;
+  }
+  return(bins);
+}
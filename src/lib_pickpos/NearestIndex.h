@@ -0,0 +1,59 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: NearestIndex.h                                       */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef NEAREST_INDEX_HEADER
+#define NEAREST_INDEX_HEADER
+
+#include <vector>
+
+//---------------------------------------------------------------
+// NearestIndex: nearest neighbor distances for a set of points.
+// Points are bucketed in a uniform grid with about one point per
+// cell, and each point searches rings of cells outward until no
+// closer point is possible. For spread out point sets, as picked
+// start positions are, this is close to linear in the number of
+// points, versus quadratic for an all-pairs check.
+
+class NearestIndex
+{
+ public:
+  NearestIndex();
+  ~NearestIndex() {}
+
+  void setPoints(const std::vector<double>& xs,
+		 const std::vector<double>& ys);
+
+  const std::vector<double>& getNearest() const {return(m_nearest);}
+
+  // -1 if there are fewer than two points
+  double getGlobalNearest() const {return(m_global_nearest);}
+
+  // Number of points with a neighbor closer than sep
+  unsigned int countBelow(double sep) const;
+
+  // Counts of nearest distances in bins of the given width. The
+  // last bin also counts all larger distances.
+  std::vector<unsigned int> getHistogram(double width,
+					 unsigned int max_bins=50) const
+  {return(histogram(m_nearest, width, max_bins));}
+
+  // Same as above for any set of distances. Negative values,
+  // meaning unknown, are skipped.
+  static std::vector<unsigned int> histogram(const std::vector<double>&,
+					     double width,
+					     unsigned int max_bins=50);
+
+ private:
+  std::vector<double> m_nearest;
+  double m_global_nearest;
+};
+
+#endif
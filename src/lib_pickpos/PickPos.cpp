@@ -24,7 +24,15 @@
 #include <iostream>
 #include <cstdlib>
 #include <cmath>
+#include <ctime>
+#include <random>
+#include <sstream>
+#include <fstream>
+#include <thread>
+#include <unordered_map>
+#include <sys/stat.h>
 #include "PickPos.h"
+#include "NearestIndex.h"
 #include "MBUtils.h"
 #include "AngleUtils.h"
 #include "GeomUtils.h"
@@ -49,6 +57,11 @@ PickPos::PickPos()
   // When making random pts, num tries to find pt satisfying buffer
   m_max_tries = 1000;
 
+  // Optional min separation of any picked set, and the bin width
+  // of the separation histogram. Both are off by default.
+  m_min_sep  = 0;
+  m_sep_hist = 0;
+
   // If multiline true, output each point on a separate line
   m_multiline = true;
 
@@ -75,6 +88,7 @@ PickPos::PickPos()
   m_colors  = false;
   m_indices = false;
   m_verbose = false;
+  m_debug   = false;
   m_vname_start_ix = 0;
   
   m_reverse_names = false;
@@ -84,8 +98,12 @@ PickPos::PickPos()
 
   m_headers_enabled = false;
 
-  m_global_nearest = -1;
-  
+  m_seed = 0;
+  m_seed_set = false;
+
+  m_batch_amt = 0;
+  m_threads   = 0;
+
   setVNameCacheOne();
   setColorCache();
 }
@@ -107,6 +125,101 @@ bool PickPos::setPickAmt(string str)
   return(true);
 }
 
+//---------------------------------------------------------
+// Procedure: addPolygon()
+//      Note: Polygons must be convex, as with the field generator
+//            this replaced.
+
+bool PickPos::addPolygon(string str)
+{
+  XYPolygon poly = string2Poly(str);
+  return(addPolygon(poly));
+}
+
+//---------------------------------------------------------
+// Procedure: addPolygon(XYPolygon)
+
+bool PickPos::addPolygon(const XYPolygon& poly)
+{
+  if(!poly.is_convex())
+    return(false);
+
+  m_sampler.addPolygon(poly);
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setSeed()
+//      Note: The same seed and arguments give the same choices.
+
+bool PickPos::setSeed(string str)
+{
+  str = stripBlankEnds(str);
+  if((str == "") || (str.find_first_not_of("0123456789") != string::npos))
+    return(false);
+
+  m_seed = strtoull(str.c_str(), 0, 10);
+  m_seed_set = true;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setBatchAmt()
+
+bool PickPos::setBatchAmt(string str)
+{
+  if(!isNumber(str))
+    return(false);
+
+  int ival = atoi(str.c_str());
+  if(ival <= 0)
+    return(false);
+
+  m_batch_amt = (unsigned int)(ival);
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setBatchFile()
+
+bool PickPos::setBatchFile(string str)
+{
+  str = stripBlankEnds(str);
+  if(str == "")
+    return(false);
+  m_batch_file = str;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setBatchDir()
+
+bool PickPos::setBatchDir(string str)
+{
+  str = stripBlankEnds(str);
+  if(str == "")
+    return(false);
+  m_batch_dir = str;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setThreads()
+//      Note: Zero (the default) means one thread per core.
+
+bool PickPos::setThreads(string str)
+{
+  if(!isNumber(str))
+    return(false);
+
+  int ival = atoi(str.c_str());
+  if(ival < 0)
+    return(false);
+
+  m_threads = (unsigned int)(ival);
+  return(true);
+}
+
 //---------------------------------------------------------
 // Procedure: setVNameStartIX()
 
@@ -131,6 +244,22 @@ bool PickPos::setBufferDist(string str)
   return(setNonNegDoubleOnString(m_buffer_dist, str));
 }
 
+//---------------------------------------------------------
+// Procedure: setMinSep()
+
+bool PickPos::setMinSep(string str)
+{
+  return(setNonNegDoubleOnString(m_min_sep, str));
+}
+
+//---------------------------------------------------------
+// Procedure: setSepHist()
+
+bool PickPos::setSepHist(string str)
+{
+  return(setPosDoubleOnString(m_sep_hist, str));
+}
+
 //---------------------------------------------------------
 // Procedure: setMaxTries()
 
@@ -472,21 +601,56 @@ bool PickPos::addPosFile(string filename)
 
 //---------------------------------------------------------
 // Procedure: pick()
+//      Note: Entry point for the command line utility. Output goes
+//            to stdout, or to files in batch mode.
 
-bool PickPos::pick()
+int PickPos::pick()
 {
-  if(m_verbose)
-    cout << "Generating " << m_pick_amt << " positions" << endl;
+  // If no seed was given, make one, and report it with the headers
+  // so that the run can be reproduced.
+  if(!m_seed_set) {
+    random_device rd;
+    m_seed = ((uint64_t)(rd()) << 32) ^ rd() ^ (uint64_t)(time(NULL));
+  }
+
+  if(m_batch_amt > 0) {
+    vector<uint64_t> seeds;
+    vector<vector<PickRecord> > records;
+    int result = generateBatch(m_batch_amt, seeds, records);
+    if(result != PICK_OK)
+      return(result);
+    return(writeBatch(seeds, records));
+  }
+
+  vector<PickRecord> records;
+  int result = generate(m_seed, records);
+  if(result != PICK_OK)
+    return(result);
 
-  if(m_file_positions.size() != 0)    
-    pickPosByFile();
-  else if(m_fld_generator.polygonCount() > 0)
-    pickPosByPoly();
-  else if(m_circ_set)
-    pickPosByCircle();
+  printScenario(records, m_seed, !m_seed_set, cout);
+  return(PICK_OK);
+}
+
+//---------------------------------------------------------
+// Procedure: generate()
+//      Note: One full set of choices from the given seed. Prior
+//            choices are cleared first.
 
-  if(m_hdg_type != "none")
-    pickHeadingVals();
+int PickPos::generate(uint64_t seed, vector<PickRecord>& records)
+{
+  records.clear();
+  clearPicks();
+  m_rng.setSeed(seed);
+
+  int result = pickPositions();
+  if(result != PICK_OK)
+    return(result);
+
+  if(m_hdg_type != "none") {
+    result = pickHeadingVals();
+    if(result != PICK_OK)
+      return(result);
+  }
 
   if(m_spd_type != "none")
     pickSpeedVals();
@@ -503,103 +667,340 @@ bool PickPos::pick()
   if(m_groups.size() != 0)
     pickGroupNames();
 
+  buildRecords(records);
+  return(PICK_OK);
+}
+
+//---------------------------------------------------------
+// Procedure: pickPositions()
+//      Note: With a min_sep, a set with any two positions closer
+//            than min_sep is redrawn, up to max_tries times. Poly
+//            picks are sampled at the min_sep so they always pass.
+
+int PickPos::pickPositions()
+{
+  for(unsigned int tries=0; tries<m_max_tries; tries++) {
+    m_pick_positions.clear();
+    m_near_positions.clear();
+
+    int result = PICK_OK;
+    if(m_file_positions.size() != 0)    
+      result = pickPosByFile();
+    else if(m_sampler.polygonCount() > 0)
+      result = pickPosByPoly();
+    else if(m_circ_set)
+      pickPosByCircle();
+    if(result != PICK_OK)
+      return(result);
+
+    double global_nearest = setNearestVals();
+    if((m_min_sep <= 0) || (global_nearest < 0))
+      return(PICK_OK);
+    if(global_nearest >= m_min_sep)
+      return(PICK_OK);
+  }
+
+  m_error = "Unable to pick " + uintToString(m_pick_amt);
+  m_error += " positions at least " + doubleToStringX(m_min_sep,2);
+  m_error += " apart in " + uintToString(m_max_tries) + " tries.";
+  return(PICK_ERR_MIN_SEP);
+}
+
+//---------------------------------------------------------
+// Procedure: setNearestVals()
+//   Returns: The global nearest value, or -1 if fewer than two
+//            positions were picked.
+
+double PickPos::setNearestVals()
+{
+  unsigned int count = m_pick_positions.size();
+  vector<double> xs(count), ys(count);
+  for(unsigned int i=0; i<count; i++) {
+    string xstr = tokStringParse(m_pick_positions[i], "x", ',', '=');
+    string ystr = tokStringParse(m_pick_positions[i], "y", ',', '=');
+    xs[i] = atof(xstr.c_str());
+    ys[i] = atof(ystr.c_str());
+  }
+
+  NearestIndex index;
+  index.setPoints(xs, ys);
+  m_near_positions = index.getNearest();
+  return(index.getGlobalNearest());
+}
+
+//---------------------------------------------------------
+// Procedure: generateBatch()
+//      Note: Makes amt independent scenarios. Scenario i uses the
+//            i-th value drawn from the master seed, so a batch is
+//            reproducible, and any scenario can be made again
+//            alone with its seed.
+//      Note: Scenarios are split over threads, each with its own
+//            copy of this object. On error, the code and message
+//            of the first failed scenario are returned.
+
+int PickPos::generateBatch(unsigned int amt, vector<uint64_t>& seeds,
+			   vector<vector<PickRecord> >& records)
+{
+  PickRand master(m_seed);
+  seeds.resize(amt);
+  for(unsigned int i=0; i<amt; i++)
+    seeds[i] = master.next();
+
+  records.clear();
+  records.resize(amt);
+  if(amt == 0)
+    return(PICK_OK);
+  
+  unsigned int parts = m_threads;
+  if(parts == 0)
+    parts = thread::hardware_concurrency();
+  if(parts == 0)
+    parts = 1;
+  if(parts > amt)
+    parts = amt;
+
+  vector<int>    results(amt, PICK_OK);
+  vector<string> errors(amt);
+  vector<thread> workers;
+  for(unsigned int p=1; p<parts; p++)
+    workers.push_back(thread(&PickPos::generateBatchPart, this, p, parts,
+			     cref(seeds), ref(records), ref(results),
+			     ref(errors)));
+  generateBatchPart(0, parts, seeds, records, results, errors);
+  for(unsigned int p=0; p<workers.size(); p++)
+    workers[p].join();
+
+  for(unsigned int i=0; i<amt; i++) {
+    if(results[i] != PICK_OK) {
+      m_error = errors[i];
+      return(results[i]);
+    }
+  }
+  return(PICK_OK);
+}
+
+//---------------------------------------------------------
+// Procedure: generateBatchPart()
+//      Note: Handles every parts-th scenario starting at part.
+//            Each result slot is written by one thread only.
+
+void PickPos::generateBatchPart(unsigned int part, unsigned int parts,
+				const vector<uint64_t>& seeds,
+				vector<vector<PickRecord> >& records,
+				vector<int>& results,
+				vector<string>& errors) const
+{
+  PickPos picker(*this);
+  for(unsigned int i=part; i<seeds.size(); i+=parts) {
+    results[i] = picker.generate(seeds[i], records[i]);
+    if(results[i] != PICK_OK)
+      errors[i] = picker.getError();
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: writeBatch()
+//      Note: Output is written in scenario order, to one file per
+//            scenario (--batch_dir), one file with a "# scenario"
+//            line before each (--batch_file), or stdout.
+
+int PickPos::writeBatch(const vector<uint64_t>& seeds,
+			const vector<vector<PickRecord> >& records)
+{
+  // Part 1: One file per scenario
+  if(m_batch_dir != "") {
+    mkdir(m_batch_dir.c_str(), 0755);
+    unsigned int width = uintToString(records.size()).length();
+    for(unsigned int i=0; i<records.size(); i++) {
+      string index = uintToString(i+1);
+      index = string(width - index.length(), '0') + index;
+      string fname = m_batch_dir + "/scenario_" + index + ".txt";
+      ofstream fout(fname.c_str());
+      if(!fout) {
+	m_error = "Unable to open " + fname + " for writing.";
+	return(PICK_ERR_OUTPUT);
+      }
+      printScenario(records[i], seeds[i], true, fout);
+    }
+    return(PICK_OK);
+  }
+
+  // Part 2: All scenarios to one stream, indexed by header lines
+  ofstream fout;
+  if(m_batch_file != "") {
+    fout.open(m_batch_file.c_str());
+    if(!fout) {
+      m_error = "Unable to open " + m_batch_file + " for writing.";
+      return(PICK_ERR_OUTPUT);
+    }
+  }
+  ostream& os = (m_batch_file != "") ? fout : cout;
+  for(unsigned int i=0; i<records.size(); i++) {
+    os << "# scenario=" << (i+1) << ", seed=" << seeds[i] << "\n";
+    printScenario(records[i], seeds[i], true, os);
+  }
+  os.flush();
+  return(PICK_OK);
+}
+
+//---------------------------------------------------------
+// Procedure: printScenario()
+//      Note: The text output of the pickpos utility for one set of
+//            choices, including any headers and verbose info.
+
+void PickPos::printScenario(const vector<PickRecord>& records,
+			    uint64_t seed, bool show_seed,
+			    ostream& os) const
+{
+  if(m_verbose) {
+    os << "Generating " << m_pick_amt << " positions" << endl;
+    os << "Seed: " << seed << endl;
+  }
+
   if(m_headers_enabled) {
-    cout << "# Values chosen by the pickpos utility" << endl;
-    cout << "# " << m_arg_summary << endl;
+    os << "# Values chosen by the pickpos utility" << endl;
+    os << "# " << m_arg_summary << endl;
+    if(show_seed)
+      os << "# --seed=" << seed << endl;
   }
 
   if(m_verbose) {
     if(m_hdg_type != "none") {
-      cout << "heading type: " << m_hdg_type << endl;
-      cout << "  heading val1: " << m_hdg_val1 << endl;
-      cout << "  heading val2: " << m_hdg_val2 << endl;
-      cout << "  heading val3: " << m_hdg_val3 << endl;
+      os << "heading type: " << m_hdg_type << endl;
+      os << "  heading val1: " << m_hdg_val1 << endl;
+      os << "  heading val2: " << m_hdg_val2 << endl;
+      os << "  heading val3: " << m_hdg_val3 << endl;
     }
     if(m_spd_type != "none") {
-      cout << "speed type: " << m_spd_type << endl;
-      cout << "  speed val1: " << m_spd_val1 << endl;
-      cout << "  speed val2: " << m_spd_val2 << endl;
+      os << "speed type: " << m_spd_type << endl;
+      os << "  speed val1: " << m_spd_val1 << endl;
+      os << "  speed val2: " << m_spd_val2 << endl;
     }
   }
-  printChoices();
-  
-  return(true);
+  printChoices(records, os);
 }
 
+//---------------------------------------------------------
+// Procedure: clearPicks()
+
+void PickPos::clearPicks()
+{
+  m_error = "";
+  m_pick_positions.clear();
+  m_pick_headings.clear();
+  m_pick_speeds.clear();
+  m_pick_vnames.clear();
+  m_pick_groups.clear();
+  m_pick_colors.clear();
+  m_pick_indices.clear();
+  m_near_positions.clear();
+}
 
 //---------------------------------------------------------
-// Procedure: pickPosByFile()
+// Procedure: buildRecords()
+//      Note: Gathers the chosen values into one record per vehicle.
+//            Headings and speeds are snapped here so that records
+//            hold the values as printed.
 
-void PickPos::pickPosByFile()
+void PickPos::buildRecords(vector<PickRecord>& records) const
+{
+  records.clear();
+  records.resize(m_pick_amt);
+  for(unsigned int i=0; i<m_pick_amt; i++) {
+    PickRecord& record = records[i];
+    if(i < m_pick_positions.size()) {
+      record.pos = m_pick_positions[i];
+      string xstr = tokStringParse(record.pos, "x", ',', '=');
+      string ystr = tokStringParse(record.pos, "y", ',', '=');
+      record.x = atof(xstr.c_str());
+      record.y = atof(ystr.c_str());
+      record.pos_set = true;
+    }
+    if((m_hdg_type != "none") && (i < m_pick_headings.size())) {
+      double hdg = angle360(m_pick_headings[i]);
+      record.heading = snapToStep(hdg, m_hdg_snap);
+      record.hdg_set = true;
+    }
+    if((m_spd_type != "none") && (i < m_pick_speeds.size())) {
+      record.speed = snapToStep(m_pick_speeds[i], m_spd_snap);
+      record.spd_set = true;
+    }
+    if(m_vnames && (i < m_pick_vnames.size()))
+      record.vname = m_pick_vnames[i];
+    if(m_colors && (i < m_pick_colors.size()))
+      record.color = m_pick_colors[i];
+    if(i < m_pick_groups.size())
+      record.group = m_pick_groups[i];
+    if(i < m_pick_indices.size())
+      record.index = m_pick_indices[i];
+    if(i < m_near_positions.size())
+      record.nearest = m_near_positions[i];
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: pickPosByFile()
+//      Note: Partial Fisher-Yates shuffle of the line indices. Each
+//            pick is uniform over the lines not yet chosen, and
+//            only m_pick_amt swaps are made. The index array is
+//            virtual: a slot not in the map holds its own index, so
+//            only displaced slots are stored and a scenario costs
+//            O(pick_amt) regardless of the file length.
+
+int PickPos::pickPosByFile()
 {
   unsigned int choices = m_file_positions.size();
   
   if(m_pick_amt > choices) {
-    cout << "Cannot pick " << m_pick_amt << " positions." << endl;
-    cout << "File(s) only had " << choices << " lines." << endl;
-    exit(1);
+    m_error = "Cannot pick " + uintToString(m_pick_amt) + " positions. ";
+    m_error += "File(s) only had " + uintToString(choices) + " lines.";
+    return(PICK_ERR_FILE_SHORT);
   }
-  //TODO: Add xorshift pseudorandom number generator - https://github.com/astocko/xorshift-cpp/tree/master
-  srand(time(NULL));
 
-  // Create an array of Booleans the same size as num of file choices
-  vector<bool> bool_positions(choices, false);
-   
+  unordered_map<unsigned int, unsigned int> displaced;
+  displaced.reserve(2 * m_pick_amt);
+
+  m_pick_positions.reserve(m_pick_amt);
   for(unsigned int i=0; i<m_pick_amt; i++) {
-    int rval = rand() % ((int)(choices));
-
-    bool found = false;
-    while(!found) {
-      for(unsigned int i=(unsigned int)(rval); ((i<choices) && !found); i++) {
-	if(bool_positions[i] == false) {
-	  bool_positions[i] = true;
-	  found = true;
-	  m_pick_positions.push_back(m_file_positions[i]);
-	}
-      }
-      rval = 0;
-    }
+    unsigned int j = i + (unsigned int)(m_rng.uniform(choices - i));
+    auto pj = displaced.find(j);
+    unsigned int ix_j = (pj == displaced.end()) ? j : pj->second;
+    auto pi = displaced.find(i);
+    unsigned int ix_i = (pi == displaced.end()) ? i : pi->second;
+
+    // Slot i is never read again, so only slot j keeps the value
+    displaced[j] = ix_i;
+    m_pick_positions.push_back(m_file_positions[ix_j]);
   }
+  return(PICK_OK);
 }
 
 //---------------------------------------------------------
 // Procedure: pickPosByPoly()
 
-void PickPos::pickPosByPoly()
+int PickPos::pickPosByPoly()
 {
-  if(m_fld_generator.size() == 0) {
-    cout << "Cannot pick " << m_pick_amt << " positions." << endl;
-    cout << "No polygons have been specified." << endl;
-    exit(1);
-  }
-  //TODO: Add xorshift pseudorandom number generator
-  srand(time(NULL));
-
-  m_fld_generator.setSnap(m_pt_snap);
-  m_fld_generator.setBufferDist(m_buffer_dist);
-  m_fld_generator.setFlexBuffer(true);
-  m_fld_generator.generatePoints(m_pick_amt);
-
-  vector<XYPoint> points = m_fld_generator.getPoints();
-  if(points.size() != m_pick_amt) {
-    cout << "Unable to squeeze " << m_pick_amt << " pts in given region." << endl;
-    cout << "Wanted: " << m_pick_amt << ", Found: " << points.size() << endl;
-    exit(2);
+  m_sampler.setSnap(m_pt_snap);
+  m_sampler.setMinSep(max(m_buffer_dist, m_min_sep));
+  bool ok = m_sampler.generate(m_pick_amt, m_rng);
+  if(m_debug)
+    cout << "Sampler: " << m_sampler.getSummary() << endl;
+
+  const vector<double>& xs = m_sampler.getPointsX();
+  const vector<double>& ys = m_sampler.getPointsY();
+  if(!ok) {
+    m_error = "Unable to squeeze " + uintToString(m_pick_amt);
+    m_error += " pts in given region. Wanted: " + uintToString(m_pick_amt);
+    m_error += ", Found: " + uintToString(xs.size());
+    return(PICK_ERR_REGION_FULL);
   }
   
-  for(unsigned int i=0; i<points.size(); i++) {
-    XYPoint pick_pt = points[i];
-    
-    double x = pick_pt.get_vx();
-    double y = pick_pt.get_vy();
-    string s="x="+doubleToStringX(x,2)+",y="+doubleToStringX(y,2);
-    
+  for(unsigned int i=0; i<xs.size(); i++) {
+    string s="x="+doubleToStringX(xs[i],2)+",y="+doubleToStringX(ys[i],2);
     m_pick_positions.push_back(s);
-    m_near_positions.push_back(0);
   }    
 
-  m_near_positions = m_fld_generator.getNearestVals();
-  m_global_nearest = m_fld_generator.getGlobalNearest();
+  return(PICK_OK);
 }
 
 //---------------------------------------------------------
@@ -625,9 +1026,8 @@ bool PickPos::pickPosByCircle(double min_sep)
     double angle_delta = 360.0 / (double)(m_pick_amt);
 
     // First pick an arbitrary initial angle    
-    double ang1 = ((double)(rand() % 3600)) / 100.0;
-    
-    vector<XYPoint> points;
+    double ang1 = ((double)(m_rng.uniform(3600))) / 100.0;
+
     for(unsigned int i=0; i<m_pick_amt; i++) {
       double ang = angle360(ang1 + (i*angle_delta));
 
@@ -637,7 +1037,6 @@ bool PickPos::pickPosByCircle(double min_sep)
       string s="x="+doubleToStringX(newx,2)+",y="+doubleToStringX(newy,2);
 
       m_pick_positions.push_back(s);
-      m_near_positions.push_back(0);
     }
   }
   return(true);
@@ -646,20 +1045,17 @@ bool PickPos::pickPosByCircle(double min_sep)
 //---------------------------------------------------------
 // Procedure: pickHeadingVals()
 
-void PickPos::pickHeadingVals()
+int PickPos::pickHeadingVals()
 {
   // Part 1: Handle simple case where the user does not want headings
   if(m_hdg_type == "none")
-    return;
-
-  //TODO: Add xorshift pseudorandom number generator
-  srand(time(NULL));
+    return(PICK_OK);
 
   // Sanity check
   if((m_pick_positions.size() != m_pick_amt) && (m_hdg_type == "rbng")) {
-    cout << "The rel_bng heading pick mode can only be use while also";
-    cout << "picking positions. Exiting now." << endl;
-    exit(1);
+    m_error = "The rel_bng heading pick mode can only be used while ";
+    m_error += "also picking positions.";
+    return(PICK_ERR_RBNG_NO_POS);
   }
   
   // Part 2: Handle making random headings from a range of headings
@@ -671,7 +1067,7 @@ void PickPos::pickHeadingVals()
 	m_pick_headings.push_back(m_hdg_val1);
       else {
 	int choices = (int)((100 * range));
-	int rval = rand() % choices;
+	int rval = (int)(m_rng.uniform(choices));
 	double hdg = m_hdg_val1 + (double)(rval) / 100;
 	m_pick_headings.push_back(hdg);
       }
@@ -695,6 +1091,7 @@ void PickPos::pickHeadingVals()
       m_pick_headings.push_back(hdg);
     }
   }
+  return(PICK_OK);
 }
 
 //---------------------------------------------------------
@@ -705,9 +1102,6 @@ void PickPos::pickSpeedVals()
   // Part 1: Handle simple case where the user does not want speeds
   if(m_spd_type == "none")
     return;
-  
-  //TODO: Add xorshift pseudorandom number generator
-  srand(time(NULL));
 
   // Part 2: Handle making random speeds from a range of speeds
   if(m_spd_type == "rand") {
@@ -718,7 +1112,7 @@ void PickPos::pickSpeedVals()
       }
       else {
 	int choices = (int)((10000 * range));
-	int rval = rand() % choices;
+	int rval = (int)(m_rng.uniform(choices));
 	double spd = m_spd_val1 + (double)(rval) / 10000;
 	m_pick_speeds.push_back(spd);
       }
@@ -735,14 +1129,11 @@ void PickPos::pickGroupNames()
   int choices = (int)(m_groups.size());
   if(choices == 0)
     return;
-  
-  //TODO: Add xorshift pseudorandom number generator
-  srand(time(NULL));
 
   // Part 2: Select random group names from configured set
   if(m_grp_type == "random") {
     for(unsigned int i=0; i<m_pick_amt; i++) {
-      int rval = rand() % choices;
+      int rval = (int)(m_rng.uniform(choices));
       string chosen_group = m_groups[rval];
       m_pick_groups.push_back(chosen_group);
     }
@@ -991,71 +1382,55 @@ void PickPos::pickColors()
 
 //---------------------------------------------------------
 // Procedure: printChoices()
+//      Note: Lines end in a newline rather than endl so that large
+//            batches are not flushed line by line.
 
-void PickPos::printChoices()
+void PickPos::printChoices(const vector<PickRecord>& records,
+			   ostream& os) const
 {
-  if(m_pick_indices.size() > 0) {
-    for(unsigned int i=0; i<m_pick_indices.size(); i++)
-      cout << m_pick_indices[i] << endl;
+  if(m_indices) {
+    for(unsigned int i=0; i<records.size(); i++)
+      os << records[i].index << "\n";
     return;
   }
 
-  // All three vectors will be of size either N or 0.
-  // Find out what N is here and set to max_index
-  unsigned int max_index = m_pick_positions.size();
-  if(m_pick_headings.size() > max_index)
-    max_index = m_pick_headings.size();
-  if(m_pick_speeds.size() > max_index)
-    max_index = m_pick_speeds.size();
-  if(m_pick_vnames.size() > max_index)
-    max_index = m_pick_vnames.size();
-  if(m_pick_groups.size() > max_index)
-    max_index = m_pick_groups.size();
-
-  for(unsigned int i=0; i<max_index; i++) {
-    string line;
-    bool position_info = false;
-    if(i<m_pick_positions.size()) {
-      line = m_pick_positions[i];
-      position_info = true;
-    }
+  double global_nearest = -1;
+  for(unsigned int i=0; i<records.size(); i++) {
+    const PickRecord& record = records[i];
+    string line = record.pos;
 
-    if((m_hdg_type != "none") && (i<m_pick_headings.size())) {
-      double hdg = angle360(m_pick_headings[i]);
-      hdg = snapToStep(hdg, m_hdg_snap);
+    if(record.hdg_set) {
       if(line != "")
 	line += ",";
-      if(position_info)
+      if(record.pos_set)
 	line += "heading=";
-      line += doubleToStringX(hdg,3);
+      line += doubleToStringX(record.heading,3);
     }
 
-    if((m_spd_type != "none") && (i<m_pick_speeds.size())) {
-      double spd = m_pick_speeds[i];
-      spd = snapToStep(spd, m_spd_snap);
+    if(record.spd_set) {
       if(line != "")
 	line += ",";
-      if(position_info)
+      if(record.pos_set)
 	line += "speed=";
-      line += doubleToStringX(spd,5);
+      line += doubleToStringX(record.speed,5);
     }
       
-    if(m_vnames && (i<m_pick_vnames.size())) {
+    if(record.vname != "") {
       if(line != "")
 	line += ",";
-      line += m_pick_vnames[i];
+      line += record.vname;
     }
       
-    if(m_colors && (i<m_pick_colors.size())) {
+    if(record.color != "") {
       if(line != "")
 	line += ",";
-      line += m_pick_colors[i];
+      line += record.color;
     }
       
-    if((m_groups.size() > 0) && (i<m_pick_groups.size())) {
+    if(record.group != "") {
       if(line != "")
 	line += ",";
-      line += m_pick_groups[i];
+      line += record.group;
     }
       
     if(m_output_type == "terse") {
@@ -1064,15 +1439,41 @@ void PickPos::printChoices()
       line = findReplace(line, "heading=", "");
       line = findReplace(line, "speed=", "");
     }
-    cout << line;
+    os << line;
 
-    if(m_verbose) {
-      if(i < m_near_positions.size())
-	cout << "   nearest=" << doubleToString(m_near_positions[i],2);
+    if(m_verbose && (record.nearest >= 0)) {
+      os << "   nearest=" << doubleToString(record.nearest,2);
+      if((global_nearest < 0) || (record.nearest < global_nearest))
+	global_nearest = record.nearest;
     }
-    cout << endl;
+    os << "\n";
   }
   if(m_verbose)
-    cout << "Global nearest = " << doubleToStringX(m_global_nearest,2) << endl;
+    os << "Global nearest = " << doubleToStringX(global_nearest,2) << endl;
+
+  if(m_sep_hist > 0)
+    printSepHistogram(records, os);
 }
 
+//---------------------------------------------------------
+// Procedure: printSepHistogram()
+//      Note: Counts of nearest neighbor distances, as comment lines
+//            so output files can still be read as positions.
+
+void PickPos::printSepHistogram(const vector<PickRecord>& records,
+				ostream& os) const
+{
+  vector<double> vals(records.size());
+  for(unsigned int i=0; i<records.size(); i++)
+    vals[i] = records[i].nearest;
+
+  vector<unsigned int> bins = NearestIndex::histogram(vals, m_sep_hist);
+  os << "# Separation histogram, bin=" << doubleToStringX(m_sep_hist,2) << "\n";
+  for(unsigned int i=0; i<bins.size(); i++) {
+    string low = doubleToStringX(i * m_sep_hist, 2);
+    string hgh = doubleToStringX((i+1) * m_sep_hist, 2);
+    if(i+1 == bins.size())
+      hgh = "";
+    os << "#   [" << low << "," << hgh << "): " << bins[i] << "\n";
+  }
+}
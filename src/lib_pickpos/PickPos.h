@@ -26,9 +26,32 @@
 
 #include <vector>
 #include <string>
-#include "XYFieldGenerator.h"
+#include <ostream>
 #include "XYPolygon.h"
 #include "XYFormatUtilsPoly.h"
+#include "PickRand.h"
+#include "PickRecord.h"
+#include "PoissonSampler.h"
+
+// Error codes returned by PickPos::generate() and pick()
+enum PickPosError {
+  PICK_OK = 0,
+  PICK_ERR_FILE_SHORT,    // Posfile(s) have fewer lines than --amt
+  PICK_ERR_REGION_FULL,   // Polygon region too small for amt/buffer
+  PICK_ERR_RBNG_NO_POS,   // Relative bearing headings need positions
+  PICK_ERR_MIN_SEP,       // No set found meeting the min separation
+  PICK_ERR_OUTPUT         // Unable to write an output file
+};
+
+//---------------------------------------------------------------
+// PickPos: picks starting positions, headings, speeds, names and
+// colors for a group of vehicles. Configure with the set* methods,
+// then call generate() for the choices as records, or pick() for
+// the text output of the pickpos utility. Errors are returned as
+// PickPosError codes, with a message from getError().
+//
+// generate() changes internal state, so each thread should use its
+// own copy. generateBatch() does this internally.
 
 class PickPos
 {
@@ -36,7 +59,8 @@ class PickPos
   PickPos();
   virtual ~PickPos() {}
 
-  bool   addPolygon(std::string s) {return(m_fld_generator.addPolygon(s));}
+  bool   addPolygon(std::string);
+  bool   addPolygon(const XYPolygon&);
   
   bool   addPosFile(std::string);
   bool   setCircle(std::string);
@@ -46,8 +70,20 @@ class PickPos
   bool   setVNameStartIX(std::string);
   bool   setBufferDist(std::string);
   bool   setMaxTries(std::string);
+  bool   setMinSep(std::string);
+  bool   setSepHist(std::string);
   bool   setOutputType(std::string);
   bool   setReverseNames() {m_reverse_names=true; return(true);}
+  bool   setSeed(std::string);
+  void   setSeed(uint64_t seed)  {m_seed=seed; m_seed_set=true;}
+  void   setPickAmt(unsigned int amt) {m_pick_amt=amt;}
+  void   setBufferDist(double v) {m_buffer_dist=(v<0)?0:v;}
+  void   setMinSep(double v)     {m_min_sep=(v<0)?0:v;}
+
+  bool   setBatchAmt(std::string);
+  bool   setBatchFile(std::string);
+  bool   setBatchDir(std::string);
+  bool   setThreads(std::string);
 
   bool   setHeadingSnap(std::string);
   bool   setSpeedSnap(std::string);
@@ -63,7 +99,7 @@ class PickPos
 
   void   setVerbose(bool v)      {m_verbose=v;}
   void   enableHeaders()         {m_headers_enabled=true;}
-  void   setDebug()              {m_fld_generator.setVerbose(true);}
+  void   setDebug()              {m_debug=true;}
 
   void   setArgSummary(std::string str)  {m_arg_summary=str;}
 
@@ -73,25 +109,49 @@ class PickPos
   bool   setVNameCacheFour();
 
  public:
-  bool   pick();
+  // In-process API: choices as records, no text output
+  int    generate(uint64_t seed, std::vector<PickRecord>& records);
+  int    generateBatch(unsigned int amt, std::vector<uint64_t>& seeds,
+		       std::vector<std::vector<PickRecord> >& records);
+  std::string getError() const {return(m_error);}
+
+  // Command line API: pick and write output per the batch settings
+  int    pick();
+  void   printScenario(const std::vector<PickRecord>&, uint64_t seed,
+		       bool show_seed, std::ostream&) const;
 
  protected:
   void setColorCache();
-  void pickPosByFile();
-  void pickPosByPoly();
+  int  pickPositions();
+  double setNearestVals();
+  int  pickPosByFile();
+  int  pickPosByPoly();
   bool pickPosByCircle(double minsep=-1);
-  void pickHeadingVals();
+  int  pickHeadingVals();
   void pickSpeedVals();
   void pickIndices();
   void pickGroupNames();
   void pickVehicleNames();
   void pickColors();
-  void printChoices();
+  void clearPicks();
+  void buildRecords(std::vector<PickRecord>&) const;
+  void printChoices(const std::vector<PickRecord>&, std::ostream&) const;
+  void printSepHistogram(const std::vector<PickRecord>&,
+			 std::ostream&) const;
+  int  writeBatch(const std::vector<uint64_t>& seeds,
+		  const std::vector<std::vector<PickRecord> >& records);
+  void generateBatchPart(unsigned int part, unsigned int parts,
+			 const std::vector<uint64_t>& seeds,
+			 std::vector<std::vector<PickRecord> >& records,
+			 std::vector<int>& results,
+			 std::vector<std::string>& errors) const;
   
  protected: // Config variables
   unsigned int m_pick_amt;
   unsigned int m_max_tries;
   double       m_buffer_dist;
+  double       m_min_sep;
+  double       m_sep_hist;
 
   bool         m_multiline;
   bool         m_verbose;
@@ -125,9 +185,21 @@ class PickPos
   std::string  m_arg_summary;
   
   bool         m_headers_enabled;
+
+  uint64_t     m_seed;
+  bool         m_seed_set;
+
+  // Batch mode: m_batch_amt scenarios, each from a derived seed
+  unsigned int m_batch_amt;
+  std::string  m_batch_file;
+  std::string  m_batch_dir;
+  unsigned int m_threads;
   
 protected: // State variables
-  XYFieldGenerator          m_fld_generator;
+  PickRand                  m_rng;
+  PoissonSampler            m_sampler;
+  bool                      m_debug;
+  std::string               m_error;
   double                    m_pt_snap;
   double                    m_hdg_snap;
   double                    m_spd_snap;
@@ -152,7 +224,6 @@ protected: // State variables
 
   // Nearest neighbor for each chosen position
   std::vector<double>       m_near_positions;
-  double                    m_global_nearest;
 };
 
 #endif 
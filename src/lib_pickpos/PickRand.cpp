@@ -0,0 +1,75 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: PickRand.cpp                                         */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include "PickRand.h"
+
+static inline uint64_t rotl(uint64_t x, int k)
+{
+  return((x << k) | (x >> (64 - k)));
+}
+
+//---------------------------------------------------------
+// Procedure: setSeed()
+
+void PickRand::setSeed(uint64_t seed)
+{
+  uint64_t z = seed;
+  for(unsigned int i=0; i<4; i++) {
+    z += 0x9e3779b97f4a7c15ULL;
+    uint64_t x = z;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    m_state[i] = x ^ (x >> 31);
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: next()
+
+uint64_t PickRand::next()
+{
+  uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+  uint64_t t = m_state[1] << 17;
+
+  m_state[2] ^= m_state[0];
+  m_state[3] ^= m_state[1];
+  m_state[1] ^= m_state[2];
+  m_state[0] ^= m_state[3];
+  m_state[2] ^= t;
+  m_state[3] = rotl(m_state[3], 45);
+
+  return(result);
+}
+
+//---------------------------------------------------------
+// Procedure: uniform()
+//      Note: Values below 2^64 mod n are rejected so that every
+//            residue is equally likely.
+
+uint64_t PickRand::uniform(uint64_t n)
+{
+  if(n == 0)
+    return(0);
+
+  uint64_t threshold = (0 - n) % n;
+  uint64_t r = next();
+  while(r < threshold)
+    r = next();
+  return(r % n);
+}
+
+//---------------------------------------------------------
+// Procedure: uniformReal()
+
+double PickRand::uniformReal()
+{
+  return((double)(next() >> 11) * 0x1.0p-53);
+}
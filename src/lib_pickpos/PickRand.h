@@ -0,0 +1,41 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: PickRand.h                                           */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef PICK_RAND_HEADER
+#define PICK_RAND_HEADER
+
+#include <cstdint>
+
+//---------------------------------------------------------------
+// PickRand: xoshiro256** pseudo random number generator, seeded
+// through splitmix64 so any 64-bit seed gives a well mixed state.
+// The same seed gives the same sequence on every platform.
+
+class PickRand
+{
+ public:
+  PickRand(uint64_t seed=0) {setSeed(seed);}
+  ~PickRand() {}
+
+  void     setSeed(uint64_t);
+  uint64_t next();
+
+  // Uniform in [0,n), without modulo bias. Returns 0 if n is 0.
+  uint64_t uniform(uint64_t n);
+
+  // Uniform in [0,1)
+  double   uniformReal();
+
+ private:
+  uint64_t m_state[4];
+};
+
+#endif
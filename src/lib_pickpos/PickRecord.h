@@ -0,0 +1,56 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: PickRecord.h                                         */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef PICK_RECORD_HEADER
+#define PICK_RECORD_HEADER
+
+#include <string>
+
+//---------------------------------------------------------------
+// PickRecord: the choices made for one vehicle by PickPos. Only
+// fields that were asked for are set. Headings and speeds are
+// already snapped. pos holds the position as it is printed,
+// either "x=..,y=.." or a line from a posfile, and x/y hold its
+// parsed values.
+
+struct PickRecord
+{
+  PickRecord() {
+    x = 0;
+    y = 0;
+    pos_set = false;
+    heading = 0;
+    hdg_set = false;
+    speed = 0;
+    spd_set = false;
+    index = -1;
+    nearest = -1;
+  }
+
+  std::string pos;
+  double      x;
+  double      y;
+  bool        pos_set;
+
+  double      heading;
+  bool        hdg_set;
+  double      speed;
+  bool        spd_set;
+
+  std::string vname;
+  std::string color;
+  std::string group;
+  int         index;    // -1 if indices were not picked
+
+  double      nearest;  // Dist to nearest other pick, -1 if unknown
+};
+
+#endif
@@ -0,0 +1,258 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: PoissonSampler.cpp                                   */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cmath>
+#include <algorithm>
+#include "PoissonSampler.h"
+#include "MBUtils.h"
+
+using namespace std;
+
+// Approximate density of a maximal Bridson sample, pts per r^2
+static const double maximal_density = 0.65;
+// Size of the maximal sample relative to the amount requested
+static const double oversample = 2.0;
+// Radius reduction per round when the sample comes up short
+static const double shrink = 0.85;
+// Rounds at the minimum separation before giving up
+static const unsigned int min_sep_rounds = 3;
+
+//---------------------------------------------------------
+// Constructor()
+
+PoissonSampler::PoissonSampler()
+{
+  m_min_sep = 10;
+  m_snap    = 0;
+  m_tries   = 30;
+
+  m_area = 0;
+  m_xmin = 0;
+  m_xmax = 0;
+  m_ymin = 0;
+  m_ymax = 0;
+
+  m_radius = 0;
+  m_maximal_count = 0;
+  m_rounds = 0;
+}
+
+//---------------------------------------------------------
+// Procedure: addPolygon()
+//      Note: Polygons are assumed not to overlap when adding up
+//            the region area.
+
+void PoissonSampler::addPolygon(const XYPolygon& poly)
+{
+  unsigned int vsize = poly.size();
+  if(vsize < 3)
+    return;
+
+  double area2 = 0;
+  for(unsigned int i=0; i<vsize; i++) {
+    unsigned int j = (i+1) % vsize;
+    area2 += (poly.get_vx(i) * poly.get_vy(j));
+    area2 -= (poly.get_vx(j) * poly.get_vy(i));
+  }
+  m_area += fabs(area2) / 2;
+
+  if(m_polys.empty()) {
+    m_xmin = poly.get_min_x();
+    m_xmax = poly.get_max_x();
+    m_ymin = poly.get_min_y();
+    m_ymax = poly.get_max_y();
+  }
+  else {
+    m_xmin = min(m_xmin, poly.get_min_x());
+    m_xmax = max(m_xmax, poly.get_max_x());
+    m_ymin = min(m_ymin, poly.get_min_y());
+    m_ymax = max(m_ymax, poly.get_max_y());
+  }
+  m_polys.push_back(poly);
+}
+
+//---------------------------------------------------------
+// Procedure: generate()
+
+bool PoissonSampler::generate(unsigned int amt, PickRand& rng)
+{
+  m_ptx.clear();
+  m_pty.clear();
+  m_maximal_count = 0;
+  m_rounds = 0;
+  if((amt == 0) || m_polys.empty() || (m_area <= 0))
+    return(false);
+
+  double radius = sqrt((maximal_density * m_area) / (oversample * amt));
+  radius = max(radius, m_min_sep);
+
+  vector<double> xs, ys;
+  unsigned int rounds_at_min = 0;
+  while(true) {
+    m_rounds++;
+    m_radius = radius;
+    sampleMaximal(radius, rng, xs, ys);
+    if(xs.size() >= amt)
+      break;
+    if(radius <= m_min_sep) {
+      rounds_at_min++;
+      if(rounds_at_min >= min_sep_rounds)
+	break;
+    }
+    radius = max(radius * shrink, m_min_sep);
+  }
+  m_maximal_count = xs.size();
+
+  // Choose amt of the sample, partial Fisher-Yates
+  unsigned int count = xs.size();
+  unsigned int picks = min(amt, count);
+  for(unsigned int i=0; i<picks; i++) {
+    unsigned int j = i + (unsigned int)(rng.uniform(count - i));
+    swap(xs[i], xs[j]);
+    swap(ys[i], ys[j]);
+    m_ptx.push_back(xs[i]);
+    m_pty.push_back(ys[i]);
+  }
+
+  return(m_ptx.size() == amt);
+}
+
+//---------------------------------------------------------
+// Procedure: sampleMaximal()
+
+void PoissonSampler::sampleMaximal(double radius, PickRand& rng,
+				   vector<double>& xs,
+				   vector<double>& ys) const
+{
+  xs.clear();
+  ys.clear();
+
+  // With a zero radius there is no packing limit, so fall back to
+  // a guard value that still gives a finite grid.
+  if(radius <= 0)
+    radius = max(m_snap, 1e-3 * max(m_xmax - m_xmin, m_ymax - m_ymin));
+  if(radius <= 0)
+    return;
+
+  double cell = radius / sqrt(2.0);
+  int nx = (int)((m_xmax - m_xmin) / cell) + 1;
+  int ny = (int)((m_ymax - m_ymin) / cell) + 1;
+  vector<int> grid((size_t)(nx) * ny, -1);
+  vector<unsigned int> active;
+  double r2 = radius * radius;
+
+  auto cellOf = [&](double x, double y, int& cx, int& cy) {
+    cx = min(nx-1, max(0, (int)((x - m_xmin) / cell)));
+    cy = min(ny-1, max(0, (int)((y - m_ymin) / cell)));
+  };
+  auto farEnough = [&](double x, double y) {
+    int cx, cy;
+    cellOf(x, y, cx, cy);
+    for(int j=max(0,cy-2); j<=min(ny-1,cy+2); j++) {
+      for(int i=max(0,cx-2); i<=min(nx-1,cx+2); i++) {
+	int ix = grid[(size_t)(j)*nx + i];
+	if(ix < 0)
+	  continue;
+	double dx = xs[ix] - x;
+	double dy = ys[ix] - y;
+	if(((dx*dx) + (dy*dy)) < r2)
+	  return(false);
+      }
+    }
+    return(true);
+  };
+  auto addPoint = [&](double x, double y) {
+    int cx, cy;
+    cellOf(x, y, cx, cy);
+    grid[(size_t)(cy)*nx + cx] = xs.size();
+    active.push_back(xs.size());
+    xs.push_back(x);
+    ys.push_back(y);
+  };
+
+  // Seed each polygon so disjoint polygons are all covered
+  for(unsigned int p=0; p<m_polys.size(); p++) {
+    const XYPolygon& poly = m_polys[p];
+    double pxmin = poly.get_min_x();
+    double pymin = poly.get_min_y();
+    double pw = poly.get_max_x() - pxmin;
+    double ph = poly.get_max_y() - pymin;
+    for(unsigned int k=0; k<100; k++) {
+      double x = snap(pxmin + (rng.uniformReal() * pw));
+      double y = snap(pymin + (rng.uniformReal() * ph));
+      if(poly.contains(x, y) && farEnough(x, y)) {
+	addPoint(x, y);
+	break;
+      }
+    }
+  }
+
+  // Grow from active points, candidates uniform in the annulus
+  // between r and 2r
+  while(!active.empty()) {
+    unsigned int aix = (unsigned int)(rng.uniform(active.size()));
+    unsigned int pix = active[aix];
+    double px = xs[pix];
+    double py = ys[pix];
+
+    bool found = false;
+    for(unsigned int k=0; (k<m_tries) && !found; k++) {
+      double dist = radius * sqrt(1 + (3 * rng.uniformReal()));
+      double ang  = 2 * M_PI * rng.uniformReal();
+      double x = snap(px + (dist * cos(ang)));
+      double y = snap(py + (dist * sin(ang)));
+      if(inRegion(x, y) && farEnough(x, y)) {
+	addPoint(x, y);
+	found = true;
+      }
+    }
+    if(!found) {
+      active[aix] = active.back();
+      active.pop_back();
+    }
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: inRegion()
+
+bool PoissonSampler::inRegion(double x, double y) const
+{
+  if((x < m_xmin) || (x > m_xmax) || (y < m_ymin) || (y > m_ymax))
+    return(false);
+  for(unsigned int i=0; i<m_polys.size(); i++) {
+    if(m_polys[i].contains(x, y))
+      return(true);
+  }
+  return(false);
+}
+
+//---------------------------------------------------------
+// Procedure: snap()
+
+double PoissonSampler::snap(double v) const
+{
+  if(m_snap <= 0)
+    return(v);
+  return(snapToStep(v, m_snap));
+}
+
+//---------------------------------------------------------
+// Procedure: getSummary()
+
+string PoissonSampler::getSummary() const
+{
+  string str = "radius=" + doubleToStringX(m_radius, 3);
+  str += ", maximal=" + uintToString(m_maximal_count);
+  str += ", rounds=" + uintToString(m_rounds);
+  str += ", area=" + doubleToStringX(m_area, 1);
+  return(str);
+}
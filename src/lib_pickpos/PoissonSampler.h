@@ -0,0 +1,85 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: PoissonSampler.h                                     */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef POISSON_SAMPLER_HEADER
+#define POISSON_SAMPLER_HEADER
+
+#include <vector>
+#include <string>
+#include "XYPolygon.h"
+#include "PickRand.h"
+
+//---------------------------------------------------------------
+// PoissonSampler: random points in one or more polygons with a
+// guaranteed minimum separation (Bridson's algorithm). A
+// background grid with cells of r/sqrt(2) holds at most one point
+// per cell, so each separation check looks at a fixed 5x5 block.
+//
+// The sampling radius is the larger of the minimum separation and
+// a radius based on the region area, chosen so a maximal sample
+// has about twice the requested points. The requested number is
+// then chosen at random from the maximal sample, so points spread
+// over the whole region. If the sample is short, the radius
+// shrinks toward the minimum separation. Points are snapped
+// before they are checked, so snapping cannot break separation.
+
+class PoissonSampler
+{
+ public:
+  PoissonSampler();
+  ~PoissonSampler() {}
+
+  void addPolygon(const XYPolygon& poly);
+  void setMinSep(double v)  {m_min_sep = (v < 0) ? 0 : v;}
+  void setSnap(double v)    {m_snap = (v < 0) ? 0 : v;}
+  void setTries(unsigned int v) {m_tries = (v == 0) ? 1 : v;}
+
+  // False if amt points cannot be placed at the min separation
+  bool generate(unsigned int amt, PickRand& rng);
+
+  unsigned int polygonCount() const {return(m_polys.size());}
+
+  const std::vector<double>& getPointsX() const {return(m_ptx);}
+  const std::vector<double>& getPointsY() const {return(m_pty);}
+
+  double getRadius() const        {return(m_radius);}
+  unsigned int getMaximalCount() const {return(m_maximal_count);}
+  std::string getSummary() const;
+
+ protected:
+  bool   inRegion(double x, double y) const;
+  double snap(double v) const;
+  void   sampleMaximal(double radius, PickRand& rng,
+		       std::vector<double>& xs,
+		       std::vector<double>& ys) const;
+
+ private: // Configuration
+  std::vector<XYPolygon> m_polys;
+  double       m_min_sep;
+  double       m_snap;
+  unsigned int m_tries;   // candidates per active point
+
+ private: // Region
+  double m_area;
+  double m_xmin;
+  double m_xmax;
+  double m_ymin;
+  double m_ymax;
+
+ private: // Results
+  std::vector<double> m_ptx;
+  std::vector<double> m_pty;
+  double       m_radius;
+  unsigned int m_maximal_count;
+  unsigned int m_rounds;
+};
+
+#endif
@@ -0,0 +1,473 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: FleetPlanner.cpp                                     */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cmath>
+#include <thread>
+#include <algorithm>
+#include "FleetPlanner.h"
+
+using namespace std;
+
+//---------------------------------------------------------
+// Constructor()
+
+FleetPlanner::FleetPlanner()
+{
+  m_threads    = 0;
+  m_iterations = 10;
+  m_slack      = 0;
+  m_budget     = 1;
+  m_planned    = false;
+}
+
+//---------------------------------------------------------
+// Procedure: clear()
+
+void FleetPlanner::clear()
+{
+  m_vx.clear();
+  m_vy.clear();
+  m_vpos.clear();
+  m_px.clear();
+  m_py.clear();
+  m_planners.clear();
+  m_members.clear();
+  m_owner.clear();
+  m_local.clear();
+  m_sx.clear();
+  m_sy.clear();
+  m_planned = false;
+}
+
+//---------------------------------------------------------
+// Procedure: addVehicle()
+//      Note: For a vehicle whose position is not known
+
+unsigned int FleetPlanner::addVehicle()
+{
+  m_vx.push_back(0);
+  m_vy.push_back(0);
+  m_vpos.push_back(false);
+  m_planned = false;
+  return(m_vx.size() - 1);
+}
+
+//---------------------------------------------------------
+// Procedure: addVehicle()
+
+unsigned int FleetPlanner::addVehicle(double x, double y)
+{
+  unsigned int vix = addVehicle();
+  m_vx[vix] = x;
+  m_vy[vix] = y;
+  m_vpos[vix] = true;
+  return(vix);
+}
+
+//---------------------------------------------------------
+// Procedure: addPoint()
+//      Note: Points added after plan() are not in any tour until
+//            the next plan(). See also assignPoint().
+
+unsigned int FleetPlanner::addPoint(double x, double y)
+{
+  m_px.push_back(x);
+  m_py.push_back(y);
+  return(m_px.size() - 1);
+}
+
+//---------------------------------------------------------
+// Procedure: plan()
+
+void FleetPlanner::plan()
+{
+  m_planned = false;
+  unsigned int vehicles = m_vx.size();
+  if(vehicles == 0)
+    return;
+
+  vector<double> cx, cy;
+  vector<int> cluster;
+  seedCenters(cx, cy);
+  partition(cluster, cx, cy);
+
+  vector<unsigned int> vehicle_of;
+  matchVehicles(cx, cy, vehicle_of);
+
+  m_members.assign(vehicles, vector<unsigned int>());
+  m_owner.assign(cluster.size(), -1);
+  m_local.assign(cluster.size(), 0);
+  for(unsigned int i=0; i<cluster.size(); i++) {
+    unsigned int vix = vehicle_of[cluster[i]];
+    m_owner[i] = vix;
+    m_local[i] = m_members[vix].size();
+    m_members[vix].push_back(i);
+  }
+
+  // Tours start at the vehicle, or the cluster center if unknown
+  m_sx = m_vx;
+  m_sy = m_vy;
+  for(unsigned int c=0; c<vehicles; c++) {
+    unsigned int vix = vehicle_of[c];
+    if(!m_vpos[vix]) {
+      m_sx[vix] = cx[c];
+      m_sy[vix] = cy[c];
+    }
+  }
+
+  m_planners.clear();
+  m_planners.resize(vehicles);
+  for(unsigned int vix=0; vix<vehicles; vix++) {
+    m_planners[vix].setStart(m_sx[vix], m_sy[vix]);
+    const vector<unsigned int>& members = m_members[vix];
+    for(unsigned int i=0; i<members.size(); i++)
+      m_planners[vix].addPoint(m_px[members[i]], m_py[members[i]]);
+  }
+
+  unsigned int parts = m_threads;
+  if(parts == 0)
+    parts = thread::hardware_concurrency();
+  if(parts == 0)
+    parts = 1;
+  if(parts > vehicles)
+    parts = vehicles;
+
+  vector<thread> workers;
+  for(unsigned int p=1; p<parts; p++)
+    workers.push_back(thread(&FleetPlanner::planPart, this, p, parts));
+  planPart(0, parts);
+  for(unsigned int p=0; p<workers.size(); p++)
+    workers[p].join();
+
+  m_planned = true;
+}
+
+//---------------------------------------------------------
+// Procedure: planPart()
+//      Note: Plans every parts-th vehicle tour starting at part.
+//            Each planner is used by one thread only.
+
+void FleetPlanner::planPart(unsigned int part, unsigned int parts)
+{
+  for(unsigned int vix=part; vix<m_planners.size(); vix+=parts) {
+    m_planners[vix].buildTour();
+    m_planners[vix].improve(m_budget);
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: seedCenters()
+//      Note: Known vehicle positions first, then for the others
+//            the point farthest from all seeds so far.
+
+void FleetPlanner::seedCenters(vector<double>& cx, vector<double>& cy)
+{
+  unsigned int vehicles = m_vx.size();
+  unsigned int points = m_px.size();
+  cx.assign(vehicles, 0);
+  cy.assign(vehicles, 0);
+
+  vector<double> near(points, -1);
+  for(unsigned int vix=0; vix<vehicles; vix++) {
+    if(!m_vpos[vix])
+      continue;
+    cx[vix] = m_vx[vix];
+    cy[vix] = m_vy[vix];
+    for(unsigned int i=0; i<points; i++) {
+      double d2 = pdist2(i, cx[vix], cy[vix]);
+      if((near[i] < 0) || (d2 < near[i]))
+	near[i] = d2;
+    }
+  }
+
+  for(unsigned int vix=0; vix<vehicles; vix++) {
+    if(m_vpos[vix] || (points == 0))
+      continue;
+    unsigned int far = 0;
+    for(unsigned int i=1; i<points; i++) {
+      if((near[far] >= 0) && ((near[i] < 0) || (near[i] > near[far])))
+	far = i;
+    }
+    cx[vix] = m_px[far];
+    cy[vix] = m_py[far];
+    for(unsigned int i=0; i<points; i++) {
+      double d2 = pdist2(i, cx[vix], cy[vix]);
+      if((near[i] < 0) || (d2 < near[i]))
+	near[i] = d2;
+    }
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: partition()
+//      Note: Each cluster gets points/clusters points, and the
+//            remainder go one each to the first clusters to ask.
+//            Points whose nearest center beats the next nearest
+//            by the most choose first, so the points pushed to a
+//            farther cluster are those it costs least to push.
+
+void FleetPlanner::partition(vector<int>& cluster, vector<double>& cx,
+			     vector<double>& cy)
+{
+  unsigned int points = m_px.size();
+  unsigned int clusters = cx.size();
+  cluster.assign(points, -1);
+  if(clusters == 0)
+    return;
+
+  unsigned int share = (points / clusters) + m_slack;
+  unsigned int extra = points % clusters;
+
+  vector<pair<double, unsigned int> > order(points);
+  vector<unsigned int> count(clusters);
+  for(unsigned int iter=0; iter<m_iterations; iter++) {
+    for(unsigned int i=0; i<points; i++) {
+      double best = -1;
+      double next = -1;
+      for(unsigned int c=0; c<clusters; c++) {
+	double d = sqrt(pdist2(i, cx[c], cy[c]));
+	if((best < 0) || (d < best)) {
+	  next = best;
+	  best = d;
+	}
+	else if((next < 0) || (d < next))
+	  next = d;
+      }
+      double regret = (next < 0) ? 0 : (next - best);
+      order[i] = make_pair(-regret, i);
+    }
+    sort(order.begin(), order.end());
+
+    bool changed = false;
+    unsigned int extra_used = 0;
+    count.assign(clusters, 0);
+    for(unsigned int j=0; j<points; j++) {
+      unsigned int i = order[j].second;
+      int    pick = -1;
+      double pick_d2 = 0;
+      for(unsigned int c=0; c<clusters; c++) {
+	bool room = (count[c] < share) ||
+	  ((count[c] == share) && (extra_used < extra));
+	if(!room)
+	  continue;
+	double d2 = pdist2(i, cx[c], cy[c]);
+	if((pick < 0) || (d2 < pick_d2)) {
+	  pick = c;
+	  pick_d2 = d2;
+	}
+      }
+      if(count[pick] == share)
+	extra_used++;
+      count[pick]++;
+      if(cluster[i] != pick)
+	changed = true;
+      cluster[i] = pick;
+    }
+
+    // Centers move to the mean of their points
+    vector<double> sx(clusters, 0);
+    vector<double> sy(clusters, 0);
+    for(unsigned int i=0; i<points; i++) {
+      sx[cluster[i]] += m_px[i];
+      sy[cluster[i]] += m_py[i];
+    }
+    for(unsigned int c=0; c<clusters; c++) {
+      if(count[c] > 0) {
+	cx[c] = sx[c] / count[c];
+	cy[c] = sy[c] / count[c];
+      }
+    }
+    if(!changed)
+      break;
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: matchVehicles()
+//      Note: Closest vehicle and cluster pairs are matched first.
+//            Vehicles with unknown positions take what is left.
+
+void FleetPlanner::matchVehicles(const vector<double>& cx,
+				 const vector<double>& cy,
+				 vector<unsigned int>& vehicle_of)
+{
+  unsigned int vehicles = m_vx.size();
+  vector<pair<double, pair<unsigned int, unsigned int> > > pairs;
+  for(unsigned int vix=0; vix<vehicles; vix++) {
+    if(!m_vpos[vix])
+      continue;
+    for(unsigned int c=0; c<vehicles; c++) {
+      double dx = m_vx[vix] - cx[c];
+      double dy = m_vy[vix] - cy[c];
+      pairs.push_back(make_pair((dx*dx) + (dy*dy), make_pair(vix, c)));
+    }
+  }
+  sort(pairs.begin(), pairs.end());
+
+  vector<bool> vused(vehicles, false);
+  vector<bool> cused(vehicles, false);
+  vehicle_of.assign(vehicles, 0);
+  for(unsigned int i=0; i<pairs.size(); i++) {
+    unsigned int vix = pairs[i].second.first;
+    unsigned int c   = pairs[i].second.second;
+    if(vused[vix] || cused[c])
+      continue;
+    vehicle_of[c] = vix;
+    vused[vix] = true;
+    cused[c] = true;
+  }
+
+  unsigned int vix = 0;
+  for(unsigned int c=0; c<vehicles; c++) {
+    if(cused[c])
+      continue;
+    while(vused[vix])
+      vix++;
+    vehicle_of[c] = vix;
+    vused[vix] = true;
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: assignPoint()
+//      Note: A vehicle is over its share if it has more than its
+//            even split of all points, rounded up, plus the slack.
+//   Returns: The vehicle index, or -1 if plan() has not been run
+
+int FleetPlanner::assignPoint(double x, double y)
+{
+  if(!m_planned)
+    return(-1);
+
+  unsigned int pix = addPoint(x, y);
+  unsigned int vehicles = m_vx.size();
+  unsigned int share = ((m_px.size() + vehicles - 1) / vehicles) + m_slack;
+
+  int    pick = -1;
+  double pick_d2 = 0;
+  for(unsigned int vix=0; vix<vehicles; vix++) {
+    if(m_members[vix].size() >= share)
+      continue;
+    double nx = m_sx[vix];
+    double ny = m_sy[vix];
+    int near = m_planners[vix].findPoint(x, y);
+    if(near >= 0) {
+      nx = m_px[m_members[vix][near]];
+      ny = m_py[m_members[vix][near]];
+    }
+    double d2 = ((x-nx) * (x-nx)) + ((y-ny) * (y-ny));
+    if((pick < 0) || (d2 < pick_d2)) {
+      pick = vix;
+      pick_d2 = d2;
+    }
+  }
+
+  m_owner.push_back(pick);
+  m_local.push_back(m_planners[pick].insertPoint(x, y));
+  m_members[pick].push_back(pix);
+  return(pick);
+}
+
+//---------------------------------------------------------
+// Procedure: visitPoint()
+//   Returns: false if the point is in no tour or already visited
+
+bool FleetPlanner::visitPoint(unsigned int pix)
+{
+  int vix = getVehicle(pix);
+  if(vix < 0)
+    return(false);
+  return(m_planners[vix].visitPoint(m_local[pix]));
+}
+
+//---------------------------------------------------------
+// Procedure: getTour()
+
+vector<unsigned int> FleetPlanner::getTour(unsigned int vix) const
+{
+  vector<unsigned int> tour;
+  if(!m_planned || (vix >= m_planners.size()))
+    return(tour);
+
+  vector<unsigned int> local = m_planners[vix].getTour();
+  for(unsigned int i=0; i<local.size(); i++)
+    tour.push_back(m_members[vix][local[i]]);
+  return(tour);
+}
+
+//---------------------------------------------------------
+// Procedure: getRemaining()
+//   Returns: Indices of the unvisited points, in visit order
+
+vector<unsigned int> FleetPlanner::getRemaining(unsigned int vix) const
+{
+  vector<unsigned int> tour;
+  if(!m_planned || (vix >= m_planners.size()))
+    return(tour);
+
+  vector<unsigned int> local = m_planners[vix].getRemaining();
+  for(unsigned int i=0; i<local.size(); i++)
+    tour.push_back(m_members[vix][local[i]]);
+  return(tour);
+}
+
+//---------------------------------------------------------
+// Procedure: getTourLength()
+
+double FleetPlanner::getTourLength(unsigned int vix) const
+{
+  if(!m_planned || (vix >= m_planners.size()))
+    return(0);
+  return(m_planners[vix].getTourLength());
+}
+
+//---------------------------------------------------------
+// Procedure: getMakespan()
+//   Returns: The length of the longest vehicle tour
+
+double FleetPlanner::getMakespan() const
+{
+  double longest = 0;
+  for(unsigned int vix=0; vix<m_planners.size(); vix++)
+    longest = max(longest, getTourLength(vix));
+  return(longest);
+}
+
+//---------------------------------------------------------
+// Procedure: getClusterSize()
+
+unsigned int FleetPlanner::getClusterSize(unsigned int vix) const
+{
+  if(vix >= m_members.size())
+    return(0);
+  return(m_members[vix].size());
+}
+
+//---------------------------------------------------------
+// Procedure: getVehicle()
+//   Returns: The vehicle whose tour has the point, or -1 if none
+
+int FleetPlanner::getVehicle(unsigned int pix) const
+{
+  if(!m_planned || (pix >= m_owner.size()))
+    return(-1);
+  return(m_owner[pix]);
+}
+
+//---------------------------------------------------------
+// Procedure: pdist2()
+
+double FleetPlanner::pdist2(unsigned int pix, double x, double y) const
+{
+  double dx = m_px[pix] - x;
+  double dy = m_py[pix] - y;
+  return((dx*dx) + (dy*dy));
+}
@@ -0,0 +1,102 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: FleetPlanner.h                                       */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef FLEET_PLANNER_HEADER
+#define FLEET_PLANNER_HEADER
+
+#include <vector>
+#include "TourPlanner.h"
+
+//---------------------------------------------------------------
+// FleetPlanner: splits a set of visit points among vehicles and
+// plans a tour for each, the goal being a short mission overall
+// rather than a short tour for any one vehicle.
+//
+// plan() partitions the points with a balanced k-means: cluster
+// sizes differ by at most one, or by up to the slack if set, and
+// centers start at the vehicle positions. Each pass assigns points
+// to their nearest center that is not yet full, points with the
+// most to lose by a second choice going first. Clusters are then
+// matched to the nearest vehicles and each tour is planned, on
+// several threads.
+//
+// assignPoint() adds a point after plan() to the nearest vehicle
+// tour that is not over its share, at its cheapest place in the
+// tour. visitPoint() marks a point, and those before it in its
+// tour, as visited so later points are not put before them.
+// Vehicles with unknown positions are seeded from the points
+// instead, spread as far from other seeds as possible.
+
+class FleetPlanner
+{
+ public:
+  FleetPlanner();
+  ~FleetPlanner() {}
+
+  void clear();
+  unsigned int addVehicle();
+  unsigned int addVehicle(double x, double y);
+  unsigned int addPoint(double x, double y);
+
+  void setThreads(unsigned int amt)  {m_threads = amt;}
+  void setPlanBudget(double secs)    {m_budget = secs;}
+  void setSlack(unsigned int amt)    {m_slack = amt;}
+
+  void plan();
+  int  assignPoint(double x, double y);
+  bool visitPoint(unsigned int pix);
+
+  // Point indices for the vehicle, in visit order
+  std::vector<unsigned int> getTour(unsigned int vix) const;
+  std::vector<unsigned int> getRemaining(unsigned int vix) const;
+
+  bool   isPlanned() const           {return(m_planned);}
+  double getTourLength(unsigned int vix) const;
+  double getMakespan() const;
+  unsigned int getVehicleCount() const {return(m_vx.size());}
+  unsigned int getPointCount() const   {return(m_px.size());}
+  unsigned int getClusterSize(unsigned int vix) const;
+  int getVehicle(unsigned int pix) const;
+
+ protected:
+  void seedCenters(std::vector<double>& cx, std::vector<double>& cy);
+  void partition(std::vector<int>& cluster, std::vector<double>& cx,
+		 std::vector<double>& cy);
+  void matchVehicles(const std::vector<double>& cx,
+		     const std::vector<double>& cy,
+		     std::vector<unsigned int>& vehicle_of);
+  void planPart(unsigned int part, unsigned int parts);
+  double pdist2(unsigned int pix, double x, double y) const;
+
+ private: // Configuration
+  unsigned int m_threads;
+  unsigned int m_iterations;
+  unsigned int m_slack;
+  double       m_budget;
+
+ private: // Vehicles and points
+  std::vector<double> m_vx;
+  std::vector<double> m_vy;
+  std::vector<bool>   m_vpos;    // true if the position is known
+  std::vector<double> m_px;
+  std::vector<double> m_py;
+
+ private: // Plan state, by vehicle
+  std::vector<TourPlanner> m_planners;
+  std::vector<std::vector<unsigned int> > m_members;
+  std::vector<int>          m_owner;  // Vehicle by point
+  std::vector<unsigned int> m_local;  // Planner index by point
+  std::vector<double> m_sx;      // Tour start positions
+  std::vector<double> m_sy;
+  bool m_planned;
+};
+
+#endif
@@ -0,0 +1,174 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: PointRegistry.cpp                                    */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cstdlib>
+#include <cctype>
+#include "PointRegistry.h"
+
+using namespace std;
+
+//---------------------------------------------------------
+// Procedure: clear()
+
+void PointRegistry::clear()
+{
+  m_xs.clear();
+  m_ys.clear();
+  m_ids.clear();
+  m_index.clear();
+}
+
+//---------------------------------------------------------
+// Procedure: reserve()
+
+void PointRegistry::reserve(unsigned int amt)
+{
+  m_xs.reserve(amt);
+  m_ys.reserve(amt);
+  m_ids.reserve(amt);
+  m_index.reserve(amt);
+}
+
+//---------------------------------------------------------
+// Procedure: add()
+
+int PointRegistry::add(uint64_t id, double x, double y)
+{
+  unsigned int ix = m_xs.size();
+  if(!m_index.insert(make_pair(id, ix)).second)
+    return(-1);
+
+  m_xs.push_back(x);
+  m_ys.push_back(y);
+  m_ids.push_back(id);
+  return(ix);
+}
+
+//---------------------------------------------------------
+// Procedure: repeat()
+//   Returns: Index of the new entry
+
+unsigned int PointRegistry::repeat(unsigned int index)
+{
+  m_xs.push_back(m_xs[index]);
+  m_ys.push_back(m_ys[index]);
+  m_ids.push_back(m_ids[index]);
+  return(m_xs.size() - 1);
+}
+
+//---------------------------------------------------------
+// Procedure: find()
+//   Returns: Index of the first entry with the id, or -1
+
+int PointRegistry::find(uint64_t id) const
+{
+  unordered_map<uint64_t, unsigned int>::const_iterator p;
+  p = m_index.find(id);
+  if(p == m_index.end())
+    return(-1);
+  return(p->second);
+}
+
+//---------------------------------------------------------
+// Procedure: parsePoint()
+//      Note: Keys are matched without regard to case, and fields
+//            other than x, y and the id are skipped. A missing id
+//            is read as an empty one, so all such points share it.
+//   Returns: false if x or y is missing or not a number
+
+bool PointRegistry::parsePoint(const string& spec, const char *id_key,
+			       double& x, double& y, uint64_t& id)
+{
+  bool x_set = false;
+  bool y_set = false;
+
+  // FNV-1a of the id text, top bit set to stay clear of numbers
+  uint64_t hash = 14695981039346656037ULL;
+  uint64_t num  = 0;
+  bool     numeric = true;
+  bool     id_seen = false;
+
+  const char *c = spec.c_str();
+  while(*c) {
+    while(isspace(*c))
+      c++;
+    const char *key = c;
+    while(*c && (*c != '=') && (*c != ','))
+      c++;
+    const char *key_end = c;
+    while((key_end > key) && isspace(key_end[-1]))
+      key_end--;
+    if(*c != '=') {
+      if(*c)
+	c++;
+      continue;
+    }
+    c++;
+    while(isspace(*c))
+      c++;
+    const char *val = c;
+    while(*c && (*c != ','))
+      c++;
+    const char *val_end = c;
+    while((val_end > val) && isspace(val_end[-1]))
+      val_end--;
+    if(*c)
+      c++;
+
+    unsigned int klen = key_end - key;
+    if((klen == 1) && (tolower(key[0]) == 'x')) {
+      char *end;
+      x = strtod(val, &end);
+      x_set = (end != val) && (end <= val_end);
+    }
+    else if((klen == 1) && (tolower(key[0]) == 'y')) {
+      char *end;
+      y = strtod(val, &end);
+      y_set = (end != val) && (end <= val_end);
+    }
+    else {
+      unsigned int i = 0;
+      while((i < klen) && id_key[i] && (tolower(key[i]) == tolower(id_key[i])))
+	i++;
+      if((i < klen) || id_key[i])
+	continue;
+
+      id_seen = true;
+      for(const char *v=val; v<val_end; v++) {
+	hash = (hash ^ (unsigned char)(*v)) * 1099511628211ULL;
+	if(isdigit(*v) && (num < 1000000000000000000ULL))
+	  num = (num * 10) + (*v - '0');
+	else
+	  numeric = false;
+      }
+      if(val == val_end)
+	numeric = false;
+    }
+  }
+
+  if(id_seen && numeric)
+    id = num;
+  else
+    id = hash | (1ULL << 63);
+  return(x_set && y_set);
+}
+
+//---------------------------------------------------------
+// Procedure: labelID()
+//   Returns: The id parsePoint() gives a point with this label
+
+uint64_t PointRegistry::labelID(const string& label)
+{
+  double x, y;
+  uint64_t id = 0;
+  parsePoint("x=0,y=0,label=" + label, "label", x, y, id);
+  return(id);
+}
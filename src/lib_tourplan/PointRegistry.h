@@ -0,0 +1,68 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: PointRegistry.h                                      */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef POINT_REGISTRY_HEADER
+#define POINT_REGISTRY_HEADER
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <unordered_map>
+
+//---------------------------------------------------------------
+// PointRegistry: visit points kept by integer id, with positions
+// in contiguous arrays indexed in the order points were added, so
+// a TourPlanner loaded from them uses the same indices. add()
+// drops a point whose id is already known. repeat() adds another
+// entry for a known point, e.g. to visit it again.
+//
+// parsePoint() reads "x=..,y=..,<id_key>=.." without allocating.
+// Ids that are whole numbers are used as is, and others are hashed
+// to a value above any such number. labelID() gives the same id for
+// a bare label, for apps that hold points by label rather than spec.
+
+class PointRegistry
+{
+ public:
+  PointRegistry() {}
+  ~PointRegistry() {}
+
+  void clear();
+  void reserve(unsigned int amt);
+
+  // Index of the new point, or -1 if the id is already known
+  int  add(uint64_t id, double x, double y);
+  unsigned int repeat(unsigned int index);
+
+  bool has(uint64_t id) const {return(m_index.count(id) != 0);}
+  int  find(uint64_t id) const;
+
+  unsigned int size() const           {return(m_xs.size());}
+  double   getX(unsigned int ix) const  {return(m_xs[ix]);}
+  double   getY(unsigned int ix) const  {return(m_ys[ix]);}
+  uint64_t getID(unsigned int ix) const {return(m_ids[ix]);}
+
+  const std::vector<double>& getXs() const {return(m_xs);}
+  const std::vector<double>& getYs() const {return(m_ys);}
+
+  static bool parsePoint(const std::string& spec, const char *id_key,
+			 double& x, double& y, uint64_t& id);
+  static uint64_t labelID(const std::string& label);
+
+ private:
+  std::vector<double>   m_xs;
+  std::vector<double>   m_ys;
+  std::vector<uint64_t> m_ids;
+
+  std::unordered_map<uint64_t, unsigned int> m_index;  // First entry
+};
+
+#endif
@@ -0,0 +1,63 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: SPSCQueue.h                                          */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef SPSC_QUEUE_HEADER
+#define SPSC_QUEUE_HEADER
+
+#include <vector>
+#include <atomic>
+#include <utility>
+
+//---------------------------------------------------------------
+// SPSCQueue: fixed size lock-free queue between one producer
+// thread and one consumer thread. Items are moved in and out, so
+// large items such as point sets are not copied. push() and pop()
+// never block, they return false if the queue is full or empty.
+// One slot is kept empty to tell a full queue from an empty one.
+
+template <class T>
+class SPSCQueue
+{
+ public:
+  SPSCQueue(unsigned int capacity=4) : m_slots(capacity+1) {
+    m_head = 0;
+    m_tail = 0;
+  }
+  ~SPSCQueue() {}
+
+  // Producer only
+  bool push(T& item) {
+    unsigned int tail = m_tail.load(std::memory_order_relaxed);
+    unsigned int next = (tail + 1) % m_slots.size();
+    if(next == m_head.load(std::memory_order_acquire))
+      return(false);
+    m_slots[tail] = std::move(item);
+    m_tail.store(next, std::memory_order_release);
+    return(true);
+  }
+
+  // Consumer only
+  bool pop(T& item) {
+    unsigned int head = m_head.load(std::memory_order_relaxed);
+    if(head == m_tail.load(std::memory_order_acquire))
+      return(false);
+    item = std::move(m_slots[head]);
+    m_head.store((head + 1) % m_slots.size(), std::memory_order_release);
+    return(true);
+  }
+
+ private:
+  std::vector<T> m_slots;
+  std::atomic<unsigned int> m_head;  // Next to pop, set by consumer
+  std::atomic<unsigned int> m_tail;  // Next to push, set by producer
+};
+
+#endif
@@ -0,0 +1,354 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: TourEdits.cpp                                        */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <unordered_map>
+#include "TourEdits.h"
+
+using namespace std;
+
+//---------------------------------------------------------
+// Constructor()
+
+TourEdits::TourEdits()
+{
+  m_checkpoint = 20;
+  clear();
+}
+
+//---------------------------------------------------------
+// Procedure: clear()
+
+void TourEdits::clear()
+{
+  m_ids.clear();
+  m_xs.clear();
+  m_ys.clear();
+  m_seq = 0;
+  m_since_full = 0;
+  m_force_full = false;
+  m_in_sync = false;
+}
+
+//---------------------------------------------------------
+// Procedure: encode()
+//   Returns: The message, or "" if the list has not changed
+
+string TourEdits::encode(const vector<unsigned int>& ids,
+			 const vector<double>& xs,
+			 const vector<double>& ys)
+{
+  unordered_map<unsigned int, unsigned int> new_pos;
+  for(unsigned int i=0; i<ids.size(); i++)
+    new_pos[ids[i]] = i;
+
+  // Deletions, and positions of the points left among themselves
+  string edits;
+  unordered_map<unsigned int, unsigned int> old_pos;
+  for(unsigned int i=0; i<m_ids.size(); i++) {
+    if(new_pos.count(m_ids[i]) == 0)
+      edits += ";del=" + to_string(m_ids[i]);
+    else {
+      unsigned int pos = old_pos.size();
+      old_pos[m_ids[i]] = pos;
+    }
+  }
+
+  // Longest run of kept points whose old order is increasing in
+  // the new list. These stay put and the rest move around them.
+  vector<unsigned int> common;
+  for(unsigned int i=0; i<ids.size(); i++) {
+    if(old_pos.count(ids[i]))
+      common.push_back(ids[i]);
+  }
+  vector<unsigned int> tails;      // Index in common, by run length
+  vector<int> parent(common.size(), -1);
+  for(unsigned int i=0; i<common.size(); i++) {
+    unsigned int pos = old_pos[common[i]];
+    unsigned int lo = 0;
+    unsigned int hi = tails.size();
+    while(lo < hi) {
+      unsigned int mid = (lo + hi) / 2;
+      if(old_pos[common[tails[mid]]] < pos)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+    if(lo > 0)
+      parent[i] = tails[lo-1];
+    if(lo == tails.size())
+      tails.push_back(i);
+    else
+      tails[lo] = i;
+  }
+  unordered_map<unsigned int, bool> keep;
+  if(tails.size() > 0) {
+    for(int i=tails.back(); i>=0; i=parent[i])
+      keep[common[i]] = true;
+  }
+
+  // Walk the new list, inserting and moving after the point before
+  string prev = "^";
+  unsigned int i = 0;
+  while(i < ids.size()) {
+    unsigned int id = ids[i];
+    if(old_pos.count(id) == 0) {
+      string pts;
+      while((i < ids.size()) && (old_pos.count(ids[i]) == 0)) {
+	if(pts != "")
+	  pts += ":";
+	pts += pointSpec(ids[i], xs[ids[i]], ys[ids[i]]);
+	i++;
+      }
+      edits += ";ins=" + pts + ">" + prev;
+      prev = to_string(ids[i-1]);
+    }
+    else if(keep.count(id)) {
+      prev = to_string(id);
+      i++;
+    }
+    else {
+      unsigned int j = i;
+      while(((j+1) < ids.size()) && old_pos.count(ids[j+1]) &&
+	    !keep.count(ids[j+1]) &&
+	    (old_pos[ids[j+1]] == (old_pos[ids[j]] + 1)))
+	j++;
+      edits += ";mov=" + to_string(id) + "-" + to_string(ids[j]) + ">" + prev;
+      prev = to_string(ids[j]);
+      i = j + 1;
+    }
+  }
+
+  if((edits == "") && !m_force_full && (m_seq > 0))
+    return("");
+
+  string full = ";full=";
+  for(unsigned int k=0; k<ids.size(); k++) {
+    if(k > 0)
+      full += ":";
+    full += pointSpec(ids[k], xs[ids[k]], ys[ids[k]]);
+  }
+
+  m_since_full++;
+  if((m_seq == 0) || m_force_full || (full.size() <= edits.size()) ||
+     ((m_checkpoint > 0) && (m_since_full >= m_checkpoint))) {
+    edits = full;
+    m_since_full = 0;
+    m_force_full = false;
+  }
+
+  m_ids = ids;
+  m_xs.clear();
+  m_ys.clear();
+  for(unsigned int k=0; k<ids.size(); k++) {
+    m_xs.push_back(xs[ids[k]]);
+    m_ys.push_back(ys[ids[k]]);
+  }
+  m_seq++;
+  m_in_sync = true;
+  return("seq=" + to_string(m_seq) + edits);
+}
+
+//---------------------------------------------------------
+// Procedure: apply()
+//      Note: Messages from before the last one applied are
+//            ignored, as repeats.
+//   Returns: false if out of sync or the message is malformed
+
+bool TourEdits::apply(const string& msg)
+{
+  vector<string> edits;
+  size_t start = 0;
+  while(start <= msg.size()) {
+    size_t end = msg.find(';', start);
+    if(end == string::npos)
+      end = msg.size();
+    edits.push_back(msg.substr(start, end - start));
+    start = end + 1;
+  }
+  if((edits.size() < 1) || (edits[0].compare(0, 4, "seq=") != 0))
+    return(false);
+
+  unsigned int seq = strtoul(edits[0].c_str() + 4, 0, 10);
+  bool full = (edits.size() > 1) && (edits[1].compare(0, 5, "full=") == 0);
+  if(!full) {
+    if(m_in_sync && (seq <= m_seq))
+      return(true);
+    if(!m_in_sync || (seq != (m_seq + 1))) {
+      m_in_sync = false;
+      return(false);
+    }
+  }
+
+  for(unsigned int i=1; i<edits.size(); i++) {
+    if(!applyEdit(edits[i])) {
+      m_in_sync = false;
+      return(false);
+    }
+  }
+  m_seq = seq;
+  m_in_sync = true;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: remove()
+//      Note: For the follower, as it reaches points
+
+bool TourEdits::remove(unsigned int id)
+{
+  int ix = findID(id);
+  if(ix < 0)
+    return(false);
+  m_ids.erase(m_ids.begin() + ix);
+  m_xs.erase(m_xs.begin() + ix);
+  m_ys.erase(m_ys.begin() + ix);
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: applyEdit()
+
+bool TourEdits::applyEdit(const string& edit)
+{
+  size_t eq = edit.find('=');
+  if(eq == string::npos)
+    return(false);
+  string op = edit.substr(0, eq);
+  string arg = edit.substr(eq + 1);
+
+  if(op == "full") {
+    vector<unsigned int> ids;
+    vector<double> xs, ys;
+    if(!parsePoints(arg, ids, xs, ys))
+      return(false);
+    m_ids = ids;
+    m_xs = xs;
+    m_ys = ys;
+    return(true);
+  }
+  if(op == "del") {
+    remove(strtoul(arg.c_str(), 0, 10));
+    return(true);
+  }
+
+  size_t gt = arg.rfind('>');
+  if(gt == string::npos)
+    return(false);
+  string after = arg.substr(gt + 1);
+  arg = arg.substr(0, gt);
+
+  vector<unsigned int> ids;
+  vector<double> xs, ys;
+  if(op == "ins") {
+    if(!parsePoints(arg, ids, xs, ys))
+      return(false);
+  }
+  else if(op == "mov") {
+    size_t dash = arg.find('-');
+    if(dash == string::npos)
+      return(false);
+    int first = findID(strtoul(arg.c_str(), 0, 10));
+    int last  = findID(strtoul(arg.c_str() + dash + 1, 0, 10));
+    if(last < 0)
+      return(true);
+    if((first < 0) || (first > last))
+      first = 0;
+    ids.assign(m_ids.begin() + first, m_ids.begin() + last + 1);
+    xs.assign(m_xs.begin() + first, m_xs.begin() + last + 1);
+    ys.assign(m_ys.begin() + first, m_ys.begin() + last + 1);
+    m_ids.erase(m_ids.begin() + first, m_ids.begin() + last + 1);
+    m_xs.erase(m_xs.begin() + first, m_xs.begin() + last + 1);
+    m_ys.erase(m_ys.begin() + first, m_ys.begin() + last + 1);
+  }
+  else
+    return(false);
+
+  unsigned int pos = 0;
+  if(after != "^") {
+    int ix = findID(strtoul(after.c_str(), 0, 10));
+    if(ix >= 0)
+      pos = ix + 1;
+  }
+  m_ids.insert(m_ids.begin() + pos, ids.begin(), ids.end());
+  m_xs.insert(m_xs.begin() + pos, xs.begin(), xs.end());
+  m_ys.insert(m_ys.begin() + pos, ys.begin(), ys.end());
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: parsePoints()
+//      Note: "id@x,y:id@x,y:..", where an empty string is no points
+
+bool TourEdits::parsePoints(const string& str, vector<unsigned int>& ids,
+			    vector<double>& xs, vector<double>& ys) const
+{
+  const char *c = str.c_str();
+  while(*c) {
+    char *end;
+    unsigned long id = strtoul(c, &end, 10);
+    if((end == c) || (*end != '@'))
+      return(false);
+    c = end + 1;
+    double x = strtod(c, &end);
+    if((end == c) || (*end != ','))
+      return(false);
+    c = end + 1;
+    double y = strtod(c, &end);
+    if((end == c) || ((*end != ':') && (*end != '\0')))
+      return(false);
+    c = (*end == ':') ? end + 1 : end;
+
+    ids.push_back(id);
+    xs.push_back(x);
+    ys.push_back(y);
+  }
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: findID()
+//   Returns: Position of the point in the list, or -1
+
+int TourEdits::findID(unsigned int id) const
+{
+  for(unsigned int i=0; i<m_ids.size(); i++) {
+    if(m_ids[i] == id)
+      return(i);
+  }
+  return(-1);
+}
+
+//---------------------------------------------------------
+// Procedure: pointSpec()
+//      Note: Positions to the centimeter, trailing zeros dropped
+
+string TourEdits::pointSpec(unsigned int id, double x, double y) const
+{
+  char buff[64];
+  string spec = to_string(id) + "@";
+  for(int k=0; k<2; k++) {
+    snprintf(buff, 64, "%.2f", (k == 0) ? x : y);
+    string num = buff;
+    while((num.size() > 1) && (num.back() == '0'))
+      num.pop_back();
+    if(num.back() == '.')
+      num.pop_back();
+    if(num == "-0")
+      num = "0";
+    spec += num;
+    if(k == 0)
+      spec += ",";
+  }
+  return(spec);
+}
@@ -0,0 +1,90 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: TourEdits.h                                          */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef TOUR_EDITS_HEADER
+#define TOUR_EDITS_HEADER
+
+#include <vector>
+#include <string>
+
+//---------------------------------------------------------------
+// TourEdits: a list of tour points kept in step between a planner
+// and a follower by messages carrying only what changed. Points
+// are keyed by an integer id, unique within the list.
+//
+// A message is "seq=N" then ';' separated edits, applied in order:
+//
+//   full=id@x,y:id@x,y:...   Replace the whole list
+//   del=id                   Remove a point
+//   ins=id@x,y:...>after     Insert points after id after
+//   mov=first-last>after     Move the range first..last after id
+//
+// An after of "^" is the front of the list. An after the follower
+// no longer has, e.g. a point it has since reached, also means the
+// front, and a del of such a point is ignored.
+//
+// encode() turns a new list into the edits from the last one. The
+// common points keep their places along a longest increasing run,
+// so a local reorder moves only the points involved. A full list
+// is sent first, every checkpoint messages, when forceFull() was
+// called, or when it is shorter than the edits.
+//
+// apply() takes a message on the follower side. A gap in seq puts
+// it out of sync until the next full list, which it should ask for.
+
+class TourEdits
+{
+ public:
+  TourEdits();
+  ~TourEdits() {}
+
+  void clear();
+  void setCheckpoint(unsigned int msgs) {m_checkpoint = msgs;}
+  void forceFull()                      {m_force_full = true;}
+
+  // Planner side, xs/ys are indexed by id
+  std::string encode(const std::vector<unsigned int>& ids,
+		     const std::vector<double>& xs,
+		     const std::vector<double>& ys);
+
+  // Follower side
+  bool apply(const std::string& msg);
+  bool remove(unsigned int id);
+  bool inSync() const {return(m_in_sync);}
+
+  unsigned int size() const              {return(m_ids.size());}
+  unsigned int getID(unsigned int i) const {return(m_ids[i]);}
+  double getX(unsigned int i) const      {return(m_xs[i]);}
+  double getY(unsigned int i) const      {return(m_ys[i]);}
+  unsigned int getSeq() const            {return(m_seq);}
+
+ protected:
+  int  findID(unsigned int id) const;
+  bool applyEdit(const std::string& edit);
+  bool parsePoints(const std::string& str, std::vector<unsigned int>& ids,
+		   std::vector<double>& xs, std::vector<double>& ys) const;
+  std::string pointSpec(unsigned int id, double x, double y) const;
+
+ private: // Configuration
+  unsigned int m_checkpoint;
+
+ private: // State
+  std::vector<unsigned int> m_ids;
+  std::vector<double>       m_xs;
+  std::vector<double>       m_ys;
+
+  unsigned int m_seq;
+  unsigned int m_since_full;
+  bool         m_force_full;
+  bool         m_in_sync;
+};
+
+#endif
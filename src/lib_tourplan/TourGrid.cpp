@@ -0,0 +1,239 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: TourGrid.cpp                                         */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cmath>
+#include <algorithm>
+#include "TourGrid.h"
+
+using namespace std;
+
+//---------------------------------------------------------
+// Constructor()
+
+TourGrid::TourGrid()
+{
+  m_xs = 0;
+  m_ys = 0;
+  m_xmin = 0;
+  m_ymin = 0;
+  m_cell = 1;
+  m_nx = 0;
+  m_ny = 0;
+  m_count = 0;
+}
+
+//---------------------------------------------------------
+// Procedure: build()
+
+void TourGrid::build(const vector<double>& xs, const vector<double>& ys,
+		     const vector<unsigned int>& ids, double pts_per_cell)
+{
+  m_xs = &xs;
+  m_ys = &ys;
+  m_cells.clear();
+  m_cell_of.assign(xs.size(), -1);
+  m_slot.assign(xs.size(), 0);
+  m_count = 0;
+  m_nx = 0;
+  m_ny = 0;
+  if(ids.empty())
+    return;
+
+  double xmin = xs[ids[0]];
+  double xmax = xmin;
+  double ymin = ys[ids[0]];
+  double ymax = ymin;
+  for(unsigned int i=1; i<ids.size(); i++) {
+    xmin = min(xmin, xs[ids[i]]);
+    xmax = max(xmax, xs[ids[i]]);
+    ymin = min(ymin, ys[ids[i]]);
+    ymax = max(ymax, ys[ids[i]]);
+  }
+
+  // Cell size for about pts_per_cell points per cell, guarding
+  // against points on a line or all at one spot.
+  double width  = xmax - xmin;
+  double height = ymax - ymin;
+  double cells  = max(1.0, ids.size() / max(pts_per_cell, 0.1));
+  m_cell = sqrt((width * height) / cells);
+  if(m_cell <= 0)
+    m_cell = max(width, height) / cells;
+  if(m_cell <= 0)
+    m_cell = 1;
+
+  m_xmin = xmin;
+  m_ymin = ymin;
+  m_nx = (int)(width / m_cell) + 1;
+  m_ny = (int)(height / m_cell) + 1;
+  m_cells.resize((size_t)(m_nx) * m_ny);
+
+  for(unsigned int i=0; i<ids.size(); i++) {
+    unsigned int id = ids[i];
+    int cx, cy;
+    cellOf(xs[id], ys[id], cx, cy);
+    int c = (cy * m_nx) + cx;
+    m_cell_of[id] = c;
+    m_slot[id] = m_cells[c].size();
+    m_cells[c].push_back(id);
+  }
+  m_count = ids.size();
+}
+
+//---------------------------------------------------------
+// Procedure: add()
+//      Note: The id must index the coordinate vectors given to
+//            build(), which may have grown since. Into an empty
+//            grid the point goes in a single cell at its spot.
+
+bool TourGrid::add(unsigned int id)
+{
+  if(!m_xs || (id >= m_xs->size()))
+    return(false);
+  if(id >= m_cell_of.size()) {
+    m_cell_of.resize(m_xs->size(), -1);
+    m_slot.resize(m_xs->size(), 0);
+  }
+  if(m_cell_of[id] >= 0)
+    return(false);
+
+  if(m_cells.empty()) {
+    m_xmin = (*m_xs)[id];
+    m_ymin = (*m_ys)[id];
+    m_cell = 1;
+    m_nx = 1;
+    m_ny = 1;
+    m_cells.resize(1);
+  }
+
+  int cx, cy;
+  cellOf((*m_xs)[id], (*m_ys)[id], cx, cy);
+  int c = (cy * m_nx) + cx;
+  m_cell_of[id] = c;
+  m_slot[id] = m_cells[c].size();
+  m_cells[c].push_back(id);
+  m_count++;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: remove()
+//      Note: Swap with the last entry of the cell and pop.
+
+bool TourGrid::remove(unsigned int id)
+{
+  if((id >= m_cell_of.size()) || (m_cell_of[id] < 0))
+    return(false);
+
+  vector<unsigned int>& bucket = m_cells[m_cell_of[id]];
+  unsigned int slot = m_slot[id];
+  unsigned int last = bucket.back();
+  bucket[slot] = last;
+  m_slot[last] = slot;
+  bucket.pop_back();
+
+  m_cell_of[id] = -1;
+  m_count--;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: getRemaining()
+
+void TourGrid::getRemaining(vector<unsigned int>& ids) const
+{
+  ids.clear();
+  ids.reserve(m_count);
+  for(unsigned int c=0; c<m_cells.size(); c++)
+    ids.insert(ids.end(), m_cells[c].begin(), m_cells[c].end());
+}
+
+//---------------------------------------------------------
+// Procedure: nearest()
+
+int TourGrid::nearest(double x, double y) const
+{
+  vector<unsigned int> result;
+  nearestK(x, y, 1, -1, result);
+  if(result.empty())
+    return(-1);
+  return(result[0]);
+}
+
+//---------------------------------------------------------
+// Procedure: nearestK()
+//      Note: A point in ring r of cells around the query cell is
+//            at least (r-1) cells away. This also holds for query
+//            points, or added points, outside the grid, since they
+//            are clamped to the nearest cell and projection onto
+//            the grid box never increases distances.
+
+void TourGrid::nearestK(double x, double y, unsigned int k, int exclude,
+			vector<unsigned int>& result) const
+{
+  result.clear();
+  if((k == 0) || (m_count == 0))
+    return;
+
+  // Best k so far as (dist^2, id), kept sorted by insertion
+  vector<pair<double, unsigned int> > best;
+  best.reserve(k+1);
+
+  int cx, cy;
+  cellOf(x, y, cx, cy);
+  int max_ring = max(m_nx, m_ny);
+  for(int ring=0; ring<=max_ring; ring++) {
+    if(best.size() == k) {
+      double ring_min = (ring - 1) * m_cell;
+      if((ring_min > 0) && ((ring_min * ring_min) > best.back().first))
+	break;
+    }
+    for(int j=cy-ring; j<=cy+ring; j++) {
+      if((j < 0) || (j >= m_ny))
+	continue;
+      // Interior rows of the ring only have their two end cells
+      bool edge_row = ((j == cy-ring) || (j == cy+ring));
+      int step = edge_row ? 1 : (2 * ring);
+      for(int i=cx-ring; i<=cx+ring; i+=step) {
+	if((i < 0) || (i >= m_nx))
+	  continue;
+	const vector<unsigned int>& bucket = m_cells[(j * m_nx) + i];
+	for(unsigned int b=0; b<bucket.size(); b++) {
+	  unsigned int id = bucket[b];
+	  if((int)(id) == exclude)
+	    continue;
+	  double dx = (*m_xs)[id] - x;
+	  double dy = (*m_ys)[id] - y;
+	  double d2 = (dx*dx) + (dy*dy);
+	  if((best.size() == k) && (d2 >= best.back().first))
+	    continue;
+	  pair<double, unsigned int> entry(d2, id);
+	  best.insert(upper_bound(best.begin(), best.end(), entry), entry);
+	  if(best.size() > k)
+	    best.pop_back();
+	}
+      }
+    }
+  }
+
+  for(unsigned int i=0; i<best.size(); i++)
+    result.push_back(best[i].second);
+}
+
+//---------------------------------------------------------
+// Procedure: cellOf()
+
+void TourGrid::cellOf(double x, double y, int& cx, int& cy) const
+{
+  double fx = (x - m_xmin) / m_cell;
+  double fy = (y - m_ymin) / m_cell;
+  cx = (fx <= 0) ? 0 : ((fx >= m_nx) ? (m_nx-1) : (int)(fx));
+  cy = (fy <= 0) ? 0 : ((fy >= m_ny) ? (m_ny-1) : (int)(fy));
+}
@@ -0,0 +1,68 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: TourGrid.h                                           */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef TOUR_GRID_HEADER
+#define TOUR_GRID_HEADER
+
+#include <vector>
+
+//---------------------------------------------------------------
+// TourGrid: uniform grid over a subset of points for nearest and
+// k-nearest queries, with O(1) removal. Points are referred to by
+// their index in the coordinate vectors given to build(), which
+// must outlive the grid. Queries search rings of cells outward
+// and stop once no closer point is possible. Points added after
+// build() that fall outside the grid go to the nearest edge cell.
+
+class TourGrid
+{
+ public:
+  TourGrid();
+  ~TourGrid() {}
+
+  void build(const std::vector<double>& xs, const std::vector<double>& ys,
+	     const std::vector<unsigned int>& ids, double pts_per_cell=2);
+
+  bool add(unsigned int id);
+  bool remove(unsigned int id);
+  void getRemaining(std::vector<unsigned int>& ids) const;
+
+  // Nearest remaining point to x,y, or -1 if none remain
+  int  nearest(double x, double y) const;
+
+  // Up to k nearest remaining points to x,y, excluding the given
+  // id, closest first
+  void nearestK(double x, double y, unsigned int k, int exclude,
+		std::vector<unsigned int>& result) const;
+
+  unsigned int size() const      {return(m_count);}
+  unsigned int cellCount() const {return(m_cells.size());}
+
+ protected:
+  void cellOf(double x, double y, int& cx, int& cy) const;
+
+ private:
+  const std::vector<double>* m_xs;
+  const std::vector<double>* m_ys;
+
+  double m_xmin;
+  double m_ymin;
+  double m_cell;
+  int    m_nx;
+  int    m_ny;
+
+  std::vector<std::vector<unsigned int> > m_cells;
+  std::vector<int>          m_cell_of;  // By id, -1 if not in grid
+  std::vector<unsigned int> m_slot;     // By id, index in its cell
+  unsigned int m_count;
+};
+
+#endif
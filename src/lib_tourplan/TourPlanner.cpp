@@ -0,0 +1,798 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: TourPlanner.cpp                                      */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cmath>
+#include <chrono>
+#include <algorithm>
+#include "TourPlanner.h"
+#include "TourGrid.h"
+
+using namespace std;
+
+// Improvements smaller than this are not worth a move
+static const double min_gain = 1e-7;
+
+//---------------------------------------------------------
+// Constructor()
+
+TourPlanner::TourPlanner()
+{
+  m_neighbors = 8;
+  m_max_kicks = -1;
+  clear();
+}
+
+//---------------------------------------------------------
+// Procedure: clear()
+
+void TourPlanner::clear()
+{
+  m_nx.assign(1, 0);
+  m_ny.assign(1, 0);
+  m_path.clear();
+  m_pos.clear();
+  m_near.clear();
+  m_queue.clear();
+  m_queued.clear();
+
+  m_built = false;
+  m_optimized = false;
+  m_greedy_len = 0;
+  m_moves = 0;
+
+  m_edits.clear();
+  m_kicking = false;
+  m_kick_delta = 0;
+  m_kicks = 0;
+
+  m_head = 1;
+  m_live_built = false;
+}
+
+//---------------------------------------------------------
+// Procedure: setStart()
+
+void TourPlanner::setStart(double x, double y)
+{
+  m_nx[0] = x;
+  m_ny[0] = y;
+  m_built = false;
+  m_optimized = false;
+}
+
+//---------------------------------------------------------
+// Procedure: addPoint()
+//   Returns: The index of the point, as used in getTour()
+
+unsigned int TourPlanner::addPoint(double x, double y)
+{
+  m_nx.push_back(x);
+  m_ny.push_back(y);
+  m_built = false;
+  m_optimized = false;
+  return(m_nx.size() - 2);
+}
+
+//---------------------------------------------------------
+// Procedure: addPoints()
+//      Note: Adds the points in order, e.g. all points of a
+//            PointRegistry, so indices match those given there
+
+void TourPlanner::addPoints(const vector<double>& xs,
+			    const vector<double>& ys)
+{
+  m_nx.insert(m_nx.end(), xs.begin(), xs.end());
+  m_ny.insert(m_ny.end(), ys.begin(), ys.end());
+  m_built = false;
+  m_optimized = false;
+}
+
+//---------------------------------------------------------
+// Procedure: buildTour()
+//      Note: Greedy nearest neighbor from the start. The grid is
+//            rebuilt for the remaining points whenever they drop
+//            below 1/8th of the cells, so searches late in the
+//            tour do not wade through empty cells.
+
+void TourPlanner::buildTour()
+{
+  unsigned int nodes = m_nx.size();
+  m_path.clear();
+  m_path.reserve(nodes);
+  m_path.push_back(0);
+
+  vector<unsigned int> ids;
+  for(unsigned int i=1; i<nodes; i++)
+    ids.push_back(i);
+
+  TourGrid grid;
+  grid.build(m_nx, m_ny, ids);
+
+  unsigned int curr = 0;
+  while(grid.size() > 0) {
+    int next = grid.nearest(m_nx[curr], m_ny[curr]);
+    grid.remove(next);
+    m_path.push_back(next);
+    curr = next;
+
+    if((grid.size() > 64) && ((grid.size() * 8) < grid.cellCount())) {
+      grid.getRemaining(ids);
+      grid.build(m_nx, m_ny, ids);
+    }
+  }
+
+  startSearch();
+}
+
+//---------------------------------------------------------
+// Procedure: setTour()
+//      Note: Takes a tour made elsewhere, e.g. a previous plan to
+//            be improved further, in place of buildTour().
+//   Returns: false if the tour is not an ordering of all points
+
+bool TourPlanner::setTour(const vector<unsigned int>& tour)
+{
+  unsigned int nodes = m_nx.size();
+  if(tour.size() != (nodes - 1))
+    return(false);
+
+  vector<bool> seen(nodes, false);
+  vector<unsigned int> path(1, 0);
+  for(unsigned int i=0; i<tour.size(); i++) {
+    unsigned int node = tour[i] + 1;
+    if((node >= nodes) || seen[node])
+      return(false);
+    seen[node] = true;
+    path.push_back(node);
+  }
+
+  m_path = path;
+  startSearch();
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: startSearch()
+//      Note: Neighbor lists are left to the first improve() call,
+//            so a tour that is only followed never pays for them.
+
+void TourPlanner::startSearch()
+{
+  unsigned int nodes = m_nx.size();
+  m_pos.assign(nodes, 0);
+  for(unsigned int i=0; i<nodes; i++)
+    m_pos[m_path[i]] = i;
+
+  m_near.clear();
+  m_queue.clear();
+  m_queued.assign(nodes, false);
+  for(unsigned int i=0; i<nodes; i++)
+    push(m_path[i]);
+
+  m_built = true;
+  m_optimized = (nodes < 4);
+  m_moves = 0;
+  m_greedy_len = getTourLength();
+
+  // Same kicks for the same tour, so plans are repeatable
+  m_edits.clear();
+  m_kicking = false;
+  m_kick_delta = 0;
+  m_kicks = 0;
+  m_rng.seed(1);
+
+  m_head = 1;
+  m_live_built = false;
+}
+
+//---------------------------------------------------------
+// Procedure: buildNeighbors()
+
+void TourPlanner::buildNeighbors()
+{
+  unsigned int nodes = m_nx.size();
+  vector<unsigned int> ids(nodes);
+  for(unsigned int i=0; i<nodes; i++)
+    ids[i] = i;
+
+  TourGrid grid;
+  grid.build(m_nx, m_ny, ids);
+
+  m_near.assign(nodes, vector<unsigned int>());
+  for(unsigned int i=0; i<nodes; i++)
+    grid.nearestK(m_nx[i], m_ny[i], m_neighbors, i, m_near[i]);
+}
+
+//---------------------------------------------------------
+// Procedure: improve()
+//      Note: Each time the queue runs dry the tour is at a local
+//            optimum. The last kick is then kept or undone, and
+//            the next one made.
+//   Returns: true if no improving move remains and all kicks
+//            have been tried
+
+bool TourPlanner::improve(double budget_secs)
+{
+  if(!m_built)
+    buildTour();
+  if(m_optimized)
+    return(true);
+  if(m_near.size() != m_nx.size())
+    buildNeighbors();
+
+  chrono::steady_clock::time_point deadline = chrono::steady_clock::now() +
+    chrono::duration_cast<chrono::steady_clock::duration>
+    (chrono::duration<double>(budget_secs));
+
+  unsigned int count = 0;
+  while(true) {
+    if(((++count % 64) == 0) && (chrono::steady_clock::now() > deadline))
+      return(false);
+
+    if(m_queue.empty()) {
+      if(m_kicking)
+	endKick();
+      if(!kick())
+	break;
+      continue;
+    }
+
+    unsigned int node = m_queue.front();
+    m_queue.pop_front();
+    m_queued[node] = false;
+
+    if(tryTwoOpt(node) || tryOrOpt(node)) {
+      m_moves++;
+      push(node);
+    }
+  }
+
+  m_optimized = true;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: tryTwoOpt()
+//      Note: Tries to replace the edge to the node's successor,
+//            then the edge from its predecessor, with an edge to
+//            one of its near neighbors. Neighbor lists are sorted,
+//            so the scan stops once a neighbor is farther than
+//            the edge being replaced. When the other edge is past
+//            the end of the open tour it costs nothing.
+
+bool TourPlanner::tryTwoOpt(unsigned int a)
+{
+  unsigned int last = m_path.size() - 1;
+  unsigned int i = m_pos[a];
+  const vector<unsigned int>& near = m_near[a];
+
+  // Part 1: Successor edge (a,b) with (c,d), d the successor of c
+  if(i < last) {
+    unsigned int b = m_path[i+1];
+    double dab = dist(a, b);
+    for(unsigned int n=0; n<near.size(); n++) {
+      unsigned int c = near[n];
+      double dac = dist(a, c);
+      if(dac >= dab)
+	break;
+      unsigned int j = m_pos[c];
+      if(j == i+1)
+	continue;
+      double delta = dac - dab;
+      if(j < last) {
+	unsigned int d = m_path[j+1];
+	delta += dist(b, d) - dist(c, d);
+      }
+      if(delta < -min_gain) {
+	m_kick_delta += delta;
+	if(j > i)
+	  reverse(i+1, j);
+	else
+	  reverse(j+1, i);
+	return(true);
+      }
+    }
+  }
+
+  // Part 2: Predecessor edge (p,a) with (e,c), e the predecessor
+  // of c. The start never moves, so c may not be the start.
+  if(i > 0) {
+    unsigned int p = m_path[i-1];
+    double dpa = dist(p, a);
+    for(unsigned int n=0; n<near.size(); n++) {
+      unsigned int c = near[n];
+      double dac = dist(a, c);
+      if(dac >= dpa)
+	break;
+      unsigned int j = m_pos[c];
+      if((j == 0) || (j == i-1))
+	continue;
+      unsigned int e = m_path[j-1];
+      double delta = dac + dist(p, e) - dpa - dist(e, c);
+      if(delta < -min_gain) {
+	m_kick_delta += delta;
+	if(j > i)
+	  reverse(i, j-1);
+	else
+	  reverse(j, i-1);
+	return(true);
+      }
+    }
+  }
+  return(false);
+}
+
+//---------------------------------------------------------
+// Procedure: tryOrOpt()
+//      Note: Tries moving a segment of 1 to 3 nodes that starts
+//            or ends at this node between two other adjacent nodes,
+//            in either direction. Candidate places are next to near
+//            neighbors of the segment ends.
+
+bool TourPlanner::tryOrOpt(unsigned int a)
+{
+  unsigned int last = m_path.size() - 1;
+  unsigned int i = m_pos[a];
+  if(i == 0)
+    return(false);
+
+  for(unsigned int seg=0; seg<6; seg++) {
+    unsigned int len = (seg / 2) + 1;
+    unsigned int beg = i;
+    if((seg % 2) == 1) {
+      if((len == 1) || (i < len))
+	continue;
+      beg = i - len + 1;
+    }
+    unsigned int k = beg + len - 1;
+    if((beg == 0) || (k > last))
+      continue;
+
+    unsigned int s0 = m_path[beg];
+    unsigned int s1 = m_path[k];
+    unsigned int p  = m_path[beg-1];
+
+    // Gain from removing the segment and joining p to its successor
+    double gain = dist(p, s0);
+    if(k < last) {
+      unsigned int q = m_path[k+1];
+      gain += dist(s1, q) - dist(p, q);
+    }
+    if(gain <= min_gain)
+      continue;
+
+    for(unsigned int end=0; end<2; end++) {
+      unsigned int s = (end == 0) ? s0 : s1;
+      const vector<unsigned int>& near = m_near[s];
+      for(unsigned int n=0; n<near.size(); n++) {
+	unsigned int c = near[n];
+	if(dist(s, c) >= gain)
+	  break;
+	unsigned int j = m_pos[c];
+	if((j >= beg) && (j <= k))
+	  continue;
+
+	// Try the edge after c, then the edge before c
+	for(unsigned int side=0; side<2; side++) {
+	  unsigned int u_pos = (side == 0) ? j : j-1;
+	  if((side == 1) && (j == 0))
+	    continue;
+	  if((u_pos == beg-1) || ((u_pos >= beg) && (u_pos <= k)))
+	    continue;
+	  unsigned int u = m_path[u_pos];
+	  bool has_v = (u_pos < last);
+	  unsigned int v = has_v ? m_path[u_pos+1] : 0;
+
+	  double duv = has_v ? dist(u, v) : 0;
+	  double fwd = dist(u, s0) + (has_v ? dist(s1, v) : 0) - duv;
+	  double rev = dist(u, s1) + (has_v ? dist(s0, v) : 0) - duv;
+	  bool   flip = (rev < fwd);
+	  double cost = flip ? rev : fwd;
+	  if(cost - gain < -min_gain) {
+	    m_kick_delta += cost - gain;
+	    moveSegment(beg, len, u_pos, flip);
+	    return(true);
+	  }
+	}
+      }
+    }
+  }
+  return(false);
+}
+
+//---------------------------------------------------------
+// Procedure: kick()
+//      Note: Swaps two adjacent segments of 1 to 30 nodes at a
+//            random place, a double-bridge move that 2-opt and
+//            Or-opt cannot undo in one step. The queue then holds
+//            the nodes on the three changed edges.
+//   Returns: false if all kicks have been made
+
+bool TourPlanner::kick()
+{
+  unsigned int last = m_path.size() - 1;
+  unsigned int max_kicks = last;
+  if(m_max_kicks >= 0)
+    max_kicks = m_max_kicks;
+  if((m_kicks >= max_kicks) || (last < 8))
+    return(false);
+  m_kicks++;
+
+  unsigned int max_len = min(last / 4, 30u);
+  uniform_int_distribution<unsigned int> pick_pos(0, last-2);
+  uniform_int_distribution<unsigned int> pick_len(1, max_len);
+
+  // Segment A starts at a, segment B at b and ends at k
+  unsigned int p = pick_pos(m_rng);
+  unsigned int a = p + 1;
+  unsigned int b = a + min(pick_len(m_rng), last - a);
+  unsigned int k = min(b + pick_len(m_rng) - 1, last);
+
+  unsigned int np = m_path[p];
+  unsigned int a0 = m_path[a];
+  unsigned int a1 = m_path[b-1];
+  unsigned int b0 = m_path[b];
+  unsigned int b1 = m_path[k];
+
+  m_kick_delta = dist(np, b0) + dist(b1, a0) - dist(np, a0) - dist(a1, b0);
+  if(k < last) {
+    unsigned int q = m_path[k+1];
+    m_kick_delta += dist(a1, q) - dist(b1, q);
+  }
+
+  m_edits.clear();
+  m_kicking = true;
+  rotate(a, b, k);
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: endKick()
+//      Note: Undoes the kick, and the moves made since, unless
+//            the tour is now shorter than before the kick
+
+void TourPlanner::endKick()
+{
+  m_kicking = false;
+  if(m_kick_delta < -min_gain) {
+    m_edits.clear();
+    return;
+  }
+
+  for(unsigned int e=m_edits.size(); e>0; e--) {
+    const PathEdit& edit = m_edits[e-1];
+    vector<unsigned int>::iterator beg = m_path.begin() + edit.i;
+    if(edit.rot)
+      std::rotate(beg, beg + (edit.j + 1 - edit.mid), m_path.begin()+edit.j+1);
+    else
+      std::reverse(beg, m_path.begin()+edit.j+1);
+    updatePositions(edit.i, edit.j);
+  }
+  m_edits.clear();
+}
+
+//---------------------------------------------------------
+// Procedure: insertPoint()
+//      Note: Only the edges on either side of the new point's near
+//            unvisited neighbors are tried, plus the end of the
+//            tour, so the cost does not grow with the tour size
+//            beyond shifting the later part of the path by one.
+//            If the tour is not built the point is just added.
+//   Returns: The index of the point, as used in getTour()
+
+unsigned int TourPlanner::insertPoint(double x, double y)
+{
+  if(!m_built)
+    return(addPoint(x, y));
+  buildLive();
+
+  m_nx.push_back(x);
+  m_ny.push_back(y);
+  unsigned int node = m_nx.size() - 1;
+  m_pos.push_back(0);
+  m_queued.push_back(false);
+
+  // Appending after the last node is always possible
+  unsigned int last  = m_path.size() - 1;
+  unsigned int after = last;
+  double best = dist(m_path[last], node);
+
+  vector<unsigned int> near;
+  m_live.nearestK(x, y, m_neighbors, -1, near);
+  for(unsigned int n=0; n<near.size(); n++) {
+    unsigned int j = m_pos[near[n]];
+    unsigned int c = m_path[j];
+
+    // Edge into c, which may start at the last visited node
+    unsigned int p = m_path[j-1];
+    double cost = dist(p, node) + dist(node, c) - dist(p, c);
+    if(cost < best) {
+      best  = cost;
+      after = j-1;
+    }
+    // Edge out of c
+    if(j < last) {
+      unsigned int q = m_path[j+1];
+      cost = dist(c, node) + dist(node, q) - dist(c, q);
+      if(cost < best) {
+	best  = cost;
+	after = j;
+      }
+    }
+  }
+
+  m_path.insert(m_path.begin() + after + 1, node);
+  updatePositions(after+1, m_path.size()-1);
+  m_live.add(node);
+  return(node - 1);
+}
+
+//---------------------------------------------------------
+// Procedure: visitPoint()
+//      Note: Points before it in the tour that were not visited
+//            are passed over and count as visited too.
+//   Returns: false if the point is unknown or already visited
+
+bool TourPlanner::visitPoint(unsigned int index)
+{
+  unsigned int node = index + 1;
+  if(!m_built || (node >= m_pos.size()) || (m_pos[node] < m_head))
+    return(false);
+  buildLive();
+
+  unsigned int pos = m_pos[node];
+  for(unsigned int i=m_head; i<=pos; i++)
+    m_live.remove(m_path[i]);
+  m_head = pos + 1;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: dropPoint()
+//      Note: The point is moved to the end of the visited part of
+//            the tour, so it stays in getTour() and counts as
+//            visited, but is passed over by the rest of the tour.
+//   Returns: false if the point is unknown or already visited
+
+bool TourPlanner::dropPoint(unsigned int index)
+{
+  unsigned int node = index + 1;
+  if(!m_built || (node >= m_pos.size()) || (m_pos[node] < m_head))
+    return(false);
+  buildLive();
+
+  unsigned int pos = m_pos[node];
+  std::rotate(m_path.begin()+m_head, m_path.begin()+pos,
+	      m_path.begin()+pos+1);
+  updatePositions(m_head, pos);
+  m_live.remove(node);
+  m_head++;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: setRemaining()
+//      Note: Reorders the unvisited part of a built tour, e.g. to
+//            take a better plan for it made elsewhere. Points in
+//            the new order that were visited since it was made
+//            are dropped.
+//   Returns: false if the order does not cover the unvisited points
+
+bool TourPlanner::setRemaining(const vector<unsigned int>& order)
+{
+  if(!m_built)
+    return(false);
+
+  unsigned int nodes = m_nx.size();
+  vector<unsigned int> suffix;
+  suffix.reserve(m_path.size() - m_head);
+  vector<bool> seen(nodes, false);
+  for(unsigned int i=0; i<order.size(); i++) {
+    unsigned int node = order[i] + 1;
+    if((node >= nodes) || seen[node])
+      return(false);
+    seen[node] = true;
+    if(m_pos[node] >= m_head)
+      suffix.push_back(node);
+  }
+  if(suffix.size() != (m_path.size() - m_head))
+    return(false);
+
+  copy(suffix.begin(), suffix.end(), m_path.begin() + m_head);
+  updatePositions(m_head, m_path.size()-1);
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: findPoint()
+//   Returns: Index of the nearest unvisited point to x,y, or -1
+
+int TourPlanner::findPoint(double x, double y)
+{
+  if(!m_built)
+    return(-1);
+  buildLive();
+
+  int node = m_live.nearest(x, y);
+  if(node < 0)
+    return(-1);
+  return(node - 1);
+}
+
+//---------------------------------------------------------
+// Procedure: buildLive()
+//      Note: Called when the tour is first followed. Local search
+//            is finished from here on, see the class comment.
+
+void TourPlanner::buildLive()
+{
+  if(m_live_built)
+    return;
+  if(m_kicking)
+    endKick();
+
+  vector<unsigned int> ids;
+  for(unsigned int i=m_head; i<m_path.size(); i++)
+    ids.push_back(m_path[i]);
+  m_live.build(m_nx, m_ny, ids);
+
+  m_queue.clear();
+  m_queued.assign(m_nx.size(), false);
+  m_optimized = true;
+  m_live_built = true;
+}
+
+//---------------------------------------------------------
+// Procedure: reverse()
+//      Note: Reverses the tour between positions i and j inclusive
+
+void TourPlanner::reverse(unsigned int i, unsigned int j)
+{
+  std::reverse(m_path.begin()+i, m_path.begin()+j+1);
+  updatePositions(i, j);
+  if(m_kicking) {
+    PathEdit edit = {false, i, i, j};
+    m_edits.push_back(edit);
+  }
+
+  if(i > 0)
+    pushAt(i-1);
+  pushAt(i);
+  pushAt(j);
+  if(j+1 < m_path.size())
+    pushAt(j+1);
+}
+
+//---------------------------------------------------------
+// Procedure: moveSegment()
+//      Note: Moves the len nodes starting at position i to just
+//            after the node now at position after, reversed if
+//            flip is true. The position after is outside the
+//            segment and not just before it.
+
+void TourPlanner::moveSegment(unsigned int i, unsigned int len,
+			      unsigned int after, bool flip)
+{
+  unsigned int new_beg = 0;
+  if(after < i) {
+    rotate(after+1, i, i+len-1);
+    new_beg = after + 1;
+  }
+  else {
+    rotate(i, i+len, after);
+    new_beg = after + 1 - len;
+  }
+
+  if(flip)
+    reverse(new_beg, new_beg+len-1);
+}
+
+//---------------------------------------------------------
+// Procedure: rotate()
+//      Note: Rotates the tour between positions i and j inclusive
+//            so the node at position mid comes first
+
+void TourPlanner::rotate(unsigned int i, unsigned int mid, unsigned int j)
+{
+  std::rotate(m_path.begin()+i, m_path.begin()+mid, m_path.begin()+j+1);
+  updatePositions(i, j);
+  if(m_kicking) {
+    PathEdit edit = {true, i, mid, j};
+    m_edits.push_back(edit);
+  }
+
+  // Nodes on the three edges that changed
+  unsigned int split = i + (j - mid);
+  if(i > 0)
+    pushAt(i-1);
+  pushAt(i);
+  pushAt(split);
+  pushAt(split+1);
+  pushAt(j);
+  if(j+1 < m_path.size())
+    pushAt(j+1);
+}
+
+//---------------------------------------------------------
+// Procedure: updatePositions()
+
+void TourPlanner::updatePositions(unsigned int i, unsigned int j)
+{
+  for(unsigned int k=i; k<=j; k++)
+    m_pos[m_path[k]] = k;
+}
+
+//---------------------------------------------------------
+// Procedure: push()
+
+void TourPlanner::push(unsigned int node)
+{
+  if(m_queued[node])
+    return;
+  m_queued[node] = true;
+  m_queue.push_back(node);
+}
+
+//---------------------------------------------------------
+// Procedure: pushAt()
+
+void TourPlanner::pushAt(unsigned int pos)
+{
+  push(m_path[pos]);
+}
+
+//---------------------------------------------------------
+// Procedure: getTour()
+
+vector<unsigned int> TourPlanner::getTour() const
+{
+  vector<unsigned int> tour;
+  if(m_path.empty())
+    return(tour);
+
+  tour.reserve(m_path.size() - 1);
+  for(unsigned int i=1; i<m_path.size(); i++)
+    tour.push_back(m_path[i] - 1);
+  return(tour);
+}
+
+//---------------------------------------------------------
+// Procedure: getRemaining()
+//   Returns: Indices of the unvisited points, in visit order
+
+vector<unsigned int> TourPlanner::getRemaining() const
+{
+  vector<unsigned int> tour;
+  for(unsigned int i=m_head; i<m_path.size(); i++)
+    tour.push_back(m_path[i] - 1);
+  return(tour);
+}
+
+//---------------------------------------------------------
+// Procedure: getTourLength()
+
+double TourPlanner::getTourLength() const
+{
+  double total = 0;
+  for(unsigned int i=1; i<m_path.size(); i++)
+    total += dist(m_path[i-1], m_path[i]);
+  return(total);
+}
+
+//---------------------------------------------------------
+// Procedure: dist()
+
+double TourPlanner::dist(unsigned int a, unsigned int b) const
+{
+  double dx = m_nx[a] - m_nx[b];
+  double dy = m_ny[a] - m_ny[b];
+  return(sqrt((dx*dx) + (dy*dy)));
+}
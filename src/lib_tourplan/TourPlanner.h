@@ -0,0 +1,138 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: TourPlanner.h                                        */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef TOUR_PLANNER_HEADER
+#define TOUR_PLANNER_HEADER
+
+#include <vector>
+#include <deque>
+#include <random>
+#include "TourGrid.h"
+
+//---------------------------------------------------------------
+// TourPlanner: an open tour from a fixed start position through
+// a set of visit points, shortest path length being the goal.
+//
+// buildTour() makes a greedy nearest-neighbor tour, with a grid
+// index to find and remove the nearest point, or setTour() takes
+// a tour from elsewhere. improve() then applies 2-opt and Or-opt
+// moves, with candidates limited to each point's k nearest
+// neighbors and a queue of points whose edges changed. Once no
+// such move remains it kicks the tour out of the local optimum by
+// swapping two short adjacent segments, searches again from the
+// kicked edges, and keeps the result only if the tour got shorter.
+// improve() stops when its wall-clock budget is used up, and picks
+// up where it left off on the next call, so it can be spread over
+// several app iterations. It is done after a set number of kicks,
+// by default one per point.
+//
+// Once built, the tour may be followed live. visitPoint() marks
+// a point and all before it as visited, and insertPoint() puts a
+// new point at its cheapest place among the unvisited points,
+// found with a grid over them. dropPoint() takes a point out of
+// the unvisited part, e.g. when it is handed to another vehicle,
+// and setRemaining() reorders them with a plan made elsewhere.
+// A live tour is not improved further since that could reorder
+// points already visited.
+//
+// Internally node 0 is the start and node i+1 is point i.
+
+class TourPlanner
+{
+ public:
+  TourPlanner();
+  ~TourPlanner() {}
+
+  void clear();
+  void setStart(double x, double y);
+  unsigned int addPoint(double x, double y);
+  void addPoints(const std::vector<double>& xs,
+		 const std::vector<double>& ys);
+  void setNeighbors(unsigned int k) {m_neighbors = (k < 2) ? 2 : k;}
+  void setKicks(int kicks)          {m_max_kicks = kicks;}
+
+  void buildTour();
+  bool setTour(const std::vector<unsigned int>& tour);
+  bool improve(double budget_secs);
+
+  // Following a built tour
+  unsigned int insertPoint(double x, double y);
+  bool visitPoint(unsigned int index);
+  bool dropPoint(unsigned int index);
+  bool setRemaining(const std::vector<unsigned int>& order);
+  int  findPoint(double x, double y);
+
+  // Point indices, in visit order
+  std::vector<unsigned int> getTour() const;
+  std::vector<unsigned int> getRemaining() const;
+
+  bool   isBuilt() const        {return(m_built);}
+  bool   isOptimized() const    {return(m_optimized);}
+  double getTourLength() const;
+  double getGreedyLength() const {return(m_greedy_len);}
+  unsigned int size() const     {return(m_nx.size() - 1);}
+  unsigned int getMoves() const {return(m_moves);}
+  unsigned int getKicks() const {return(m_kicks);}
+  unsigned int getVisited() const {return(m_head - 1);}
+
+ protected:
+  double dist(unsigned int a, unsigned int b) const;
+  void   startSearch();
+  void   buildNeighbors();
+  void   buildLive();
+
+  bool   tryTwoOpt(unsigned int node);
+  bool   tryOrOpt(unsigned int node);
+  bool   kick();
+  void   endKick();
+  void   reverse(unsigned int i, unsigned int j);
+  void   rotate(unsigned int i, unsigned int mid, unsigned int j);
+  void   moveSegment(unsigned int i, unsigned int len,
+		     unsigned int after, bool flip);
+  void   updatePositions(unsigned int i, unsigned int j);
+  void   push(unsigned int node);
+  void   pushAt(unsigned int pos);
+
+ private: // Configuration
+  unsigned int m_neighbors;
+  int          m_max_kicks;  // -1 for one per point
+
+ private: // Nodes, start at index 0
+  std::vector<double> m_nx;
+  std::vector<double> m_ny;
+
+ private: // Tour state
+  std::vector<unsigned int> m_path;   // Nodes by position
+  std::vector<unsigned int> m_pos;    // Positions by node
+  std::vector<std::vector<unsigned int> > m_near;
+  std::deque<unsigned int>  m_queue;
+  std::vector<bool>         m_queued;
+
+  bool   m_built;
+  bool   m_optimized;
+  double m_greedy_len;
+  unsigned int m_moves;
+
+ private: // Kick state, edits are logged so a kick can be undone
+  struct PathEdit {bool rot; unsigned int i, mid, j;};
+  std::vector<PathEdit> m_edits;
+  bool         m_kicking;
+  double       m_kick_delta;
+  unsigned int m_kicks;
+  std::mt19937 m_rng;
+
+ private: // Live tour state
+  unsigned int m_head;       // Position of first unvisited node
+  TourGrid     m_live;       // Unvisited nodes
+  bool         m_live_built;
+};
+
+#endif
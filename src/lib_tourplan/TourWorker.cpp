@@ -0,0 +1,167 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: TourWorker.cpp                                       */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <chrono>
+#include "TourWorker.h"
+#include "TourPlanner.h"
+
+using namespace std;
+
+//---------------------------------------------------------
+// Constructor()
+//      Note: The thread is started last, once all members it
+//            reads are set.
+
+TourWorker::TourWorker()
+{
+  m_stop    = false;
+  m_slice   = 0.02;
+  m_last_id = 0;
+  m_thread  = thread(&TourWorker::run, this);
+}
+
+//---------------------------------------------------------
+// Destructor()
+
+TourWorker::~TourWorker()
+{
+  stop();
+}
+
+//---------------------------------------------------------
+// Procedure: stop()
+
+void TourWorker::stop()
+{
+  m_stop = true;
+  if(m_thread.joinable())
+    m_thread.join();
+}
+
+//---------------------------------------------------------
+// Procedure: request()
+//      Note: The request is moved into the queue if accepted.
+
+unsigned int TourWorker::request(TourRequest& request)
+{
+  unsigned int id = m_last_id + 1;
+  if(id == 0)
+    id = 1;
+  request.id = id;
+  if(!m_requests.push(request))
+    return(0);
+
+  m_last_id = id;
+  return(id);
+}
+
+//---------------------------------------------------------
+// Procedure: getResult()
+//      Note: Results for older requests are passed over. A result
+//            with no tour only marks the one before it as done.
+
+bool TourWorker::getResult(TourResult& result)
+{
+  bool found = false;
+  TourResult entry;
+  while(m_results.pop(entry)) {
+    if(entry.id != m_last_id)
+      continue;
+    if(found && entry.tour.empty())
+      result.done = entry.done;
+    else
+      result = std::move(entry);
+    found = true;
+  }
+  return(found);
+}
+
+//---------------------------------------------------------
+// Procedure: run()
+//      Note: Worker thread. Between time slices it checks for a
+//            newer request, so a cancel takes at most one slice
+//            plus the time to build a greedy tour.
+
+void TourWorker::run()
+{
+  TourPlanner  planner;
+  TourRequest  request;
+  TourResult   pending;
+  bool   has_pending = false;
+  bool   active = false;
+  double posted_len = 0;
+
+  while(!m_stop) {
+    // Newest request wins, those behind it are dropped
+    bool fresh = false;
+    while(m_requests.pop(request))
+      fresh = true;
+
+    if(fresh) {
+      planner.clear();
+      planner.setStart(request.start_x, request.start_y);
+      vector<unsigned int> order;
+      for(unsigned int i=0; i<request.xs.size(); i++)
+	order.push_back(planner.addPoint(request.xs[i], request.ys[i]));
+
+      if(request.warm)
+	planner.setTour(order);
+      else
+	planner.buildTour();
+      active = true;
+      posted_len = planner.getTourLength();
+
+      if(!request.warm) {
+	pending.id     = request.id;
+	pending.tour   = planner.getTour();
+	pending.length = posted_len;
+	pending.done   = planner.isOptimized();
+	has_pending = true;
+      }
+    }
+    else if(active) {
+      bool done = planner.improve(m_slice);
+      double len = planner.getTourLength();
+      bool better = (len < posted_len);
+      if(better || done) {
+	// A better tour waiting to be posted is kept when done
+	if(better)
+	  pending.tour = planner.getTour();
+	else if(!has_pending || (pending.id != request.id))
+	  pending.tour.clear();
+	pending.id     = request.id;
+	pending.length = len;
+	pending.done   = done;
+	has_pending = true;
+	posted_len  = len;
+      }
+      if(done)
+	active = false;
+    }
+
+    // A result the caller has not made room for is kept, and
+    // replaced if a better one comes along first
+    if(has_pending)
+      post(pending, has_pending);
+
+    if(!active && !fresh)
+      this_thread::sleep_for(chrono::milliseconds(5));
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: post()
+
+void TourWorker::post(TourResult& result, bool& pending)
+{
+  if(m_results.push(result))
+    pending = false;
+}
@@ -0,0 +1,97 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: TourWorker.h                                         */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef TOUR_WORKER_HEADER
+#define TOUR_WORKER_HEADER
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include "SPSCQueue.h"
+
+//---------------------------------------------------------------
+// TourRequest: a point set to plan a tour through, from a start
+// position. If warm is true the points are already in the order
+// of a tour worth keeping, and planning starts from it rather than
+// from a greedy tour.
+
+struct TourRequest
+{
+  TourRequest() {id=0; start_x=0; start_y=0; warm=false;}
+
+  unsigned int id;
+  double start_x;
+  double start_y;
+  std::vector<double> xs;
+  std::vector<double> ys;
+  bool   warm;
+};
+
+//---------------------------------------------------------------
+// TourResult: the best tour so far for a request, as indices into
+// its point set. done is true on the last result for a request,
+// once no improving move remains. The last result has no tour if
+// the one posted before it is still the best.
+
+struct TourResult
+{
+  TourResult() {id=0; length=0; done=false;}
+
+  unsigned int id;
+  std::vector<unsigned int> tour;
+  double length;
+  bool   done;
+};
+
+//---------------------------------------------------------------
+// TourWorker: plans tours with a TourPlanner on its own thread so
+// the caller never waits on it. Requests go to the worker and
+// results come back over lock-free single-producer queues, so
+// request() and getResult() must be called from one thread only.
+//
+// Results are anytime: one is posted once a tour exists, and again
+// after each time slice that shortened it, and a last one when
+// done. A warm request only posts a tour if it shortened the tour
+// it was given. A newer request
+// cancels the one being planned, and requests still queued behind
+// it are dropped unplanned.
+
+class TourWorker
+{
+ public:
+  TourWorker();
+  ~TourWorker();
+
+  void setSlice(double secs) {m_slice = (secs > 0.001) ? secs : 0.001;}
+
+  // Returns the request id, or 0 if the request queue is full
+  unsigned int request(TourRequest& request);
+
+  // Latest result for the latest request, true if one arrived
+  bool getResult(TourResult& result);
+
+  void stop();
+
+ protected:
+  void run();
+  void post(TourResult& result, bool& pending);
+
+ private:
+  SPSCQueue<TourRequest> m_requests;
+  SPSCQueue<TourResult>  m_results;
+
+  std::thread         m_thread;
+  std::atomic<bool>   m_stop;
+  std::atomic<double> m_slice;
+  unsigned int        m_last_id;
+};
+
+#endif
@@ -0,0 +1,404 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoyAssign.cpp                                     */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cmath>
+#include <chrono>
+#include "MBUtils.h"
+#include "ACTable.h"
+#include "NodeRecordUtils.h"
+#include "ConvoyAssign.h"
+
+using namespace std;
+
+//---------------------------------------------------------
+// Constructor()
+
+ConvoyAssign::ConvoyAssign()
+{
+  // Config vars
+  m_ordering_var   = "EXT_ORDERING_ALL";
+  m_slot_spacing   = 10;
+  m_turn_radius    = 5;
+  m_solve_interval = 2;
+  m_stale_time     = 10;
+  m_repost_interval = 5;
+
+  // State vars
+  m_last_solve_utc   = 0;
+  m_last_post_utc    = 0;
+  m_last_solve_msecs = 0;
+  m_solves = 0;
+  m_posts  = 0;
+  m_drops  = 0;
+}
+
+//---------------------------------------------------------
+// Procedure: OnNewMail()
+
+bool ConvoyAssign::OnNewMail(MOOSMSG_LIST &NewMail)
+{
+  AppCastingMOOSApp::OnNewMail(NewMail);
+
+  MOOSMSG_LIST::iterator p;
+  for(p=NewMail.begin(); p!=NewMail.end(); p++) {
+    CMOOSMsg &msg = *p;
+    string key  = msg.GetKey();
+    string sval = msg.GetString();
+
+    bool handled = false;
+    if(key == "NODE_REPORT")
+      handled = handleMailNodeReport(sval);
+    else if(key == "CONVOY_LEADER") {
+      m_leader = tolower(stripBlankEnds(sval));
+      handled = (m_leader != "");
+    }
+    else if(key == "APPCAST_REQ") // handled by AppCastingMOOSApp
+      handled = true;
+
+    if(!handled)
+      reportRunWarning("Unhandled Mail: " + key);
+  }
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: OnConnectToServer()
+
+bool ConvoyAssign::OnConnectToServer()
+{
+  registerVariables();
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: Iterate()
+
+bool ConvoyAssign::Iterate()
+{
+  AppCastingMOOSApp::Iterate();
+
+  if((m_curr_time - m_last_solve_utc) >= m_solve_interval) {
+    dropStaleFollowers();
+    updateFollowers();
+    solveAndPost();
+    m_last_solve_utc = m_curr_time;
+  }
+
+  AppCastingMOOSApp::PostReport();
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: OnStartUp()
+
+bool ConvoyAssign::OnStartUp()
+{
+  AppCastingMOOSApp::OnStartUp();
+
+  STRING_LIST sParams;
+  m_MissionReader.EnableVerbatimQuoting(false);
+  if(!m_MissionReader.GetConfiguration(GetAppName(), sParams))
+    reportConfigWarning("No config block found for " + GetAppName());
+
+  STRING_LIST::iterator p;
+  for(p=sParams.begin(); p!=sParams.end(); p++) {
+    string orig  = *p;
+    string line  = *p;
+    string param = tolower(biteStringX(line, '='));
+    string value = line;
+    double dval  = atof(value.c_str());
+
+    bool handled = false;
+    if(param == "leader") {
+      m_leader = tolower(value);
+      handled = (m_leader != "");
+    }
+    else if(param == "vehicles")
+      handled = handleConfigVehicles(value);
+    else if(param == "ordering_var")
+      handled = setNonWhiteVarOnString(m_ordering_var, value);
+    else if((param == "slot_spacing") && isNumber(value) && (dval > 0)) {
+      m_slot_spacing = dval;
+      handled = true;
+    }
+    else if((param == "turn_radius") && isNumber(value) && (dval >= 0)) {
+      m_turn_radius = dval;
+      handled = true;
+    }
+    else if((param == "join_speed") && isNumber(value))
+      handled = m_intercept.setJoinSpeed(dval);
+    else if((param == "max_join_time") && isNumber(value))
+      handled = m_intercept.setMaxTime(dval);
+    else if((param == "solve_interval") && isNumber(value) && (dval >= 0)) {
+      m_solve_interval = dval;
+      handled = true;
+    }
+    else if((param == "stale_time") && isNumber(value) && (dval > 0)) {
+      m_stale_time = dval;
+      handled = true;
+    }
+    else if((param == "repost_interval") && isNumber(value) && (dval > 0)) {
+      m_repost_interval = dval;
+      handled = true;
+    }
+    else if(param == "assign_flag")
+      handled = handleConfigAssignFlag(value);
+
+    if(!handled)
+      reportUnhandledConfigWarning(orig);
+  }
+
+  if(m_leader == "")
+    reportConfigWarning("No convoy leader set. Expecting CONVOY_LEADER.");
+
+  registerVariables();
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: registerVariables()
+
+void ConvoyAssign::registerVariables()
+{
+  AppCastingMOOSApp::RegisterVariables();
+  Register("NODE_REPORT", 0);
+  Register("CONVOY_LEADER", 0);
+}
+
+//---------------------------------------------------------
+// Procedure: handleConfigVehicles()
+//   Example: vehicles = ben,cal,deb
+
+bool ConvoyAssign::handleConfigVehicles(string str)
+{
+  m_vehicles.clear();
+  vector<string> svector = parseString(str, ',');
+  for(unsigned int i=0; i<svector.size(); i++) {
+    string vname = tolower(stripBlankEnds(svector[i]));
+    if(vname == "")
+      return(false);
+    if(!vectorContains(m_vehicles, vname))
+      m_vehicles.push_back(vname);
+  }
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: handleConfigAssignFlag()
+//   Example: assign_flag = CONVOY_ALL=true
+
+bool ConvoyAssign::handleConfigAssignFlag(string str)
+{
+  string var = stripBlankEnds(biteString(str, '='));
+  string val = stripBlankEnds(str);
+  if((var == "") || strContainsWhite(var) || (val == ""))
+    return(false);
+  m_assign_flags.push_back(make_pair(var, val));
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: handleMailNodeReport()
+
+bool ConvoyAssign::handleMailNodeReport(string str)
+{
+  NodeRecord record = string2NodeRecord(str);
+  string vname = tolower(record.getName());
+  if(vname == "")
+    return(false);
+
+  if(!m_vehicles.empty() && (vname != m_leader) &&
+     !vectorContains(m_vehicles, vname))
+    return(true);
+
+  m_records[vname] = record;
+  m_record_utc[vname] = m_curr_time;
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: dropStaleFollowers()
+//      Note: A vehicle that stops reporting gives up its row and
+//            the last slot. The solver keeps the rest of its last
+//            solution, so the re-solve is a single augmentation
+//            when the other costs have not moved.
+
+void ConvoyAssign::dropStaleFollowers()
+{
+  unsigned int i = 0;
+  while(i < m_followers.size()) {
+    string vname = m_followers[i];
+    if((m_curr_time - m_record_utc[vname]) <= m_stale_time) {
+      i++;
+      continue;
+    }
+    if(m_solver.size() == m_followers.size())
+      m_solver.dropRow(i, m_followers.size()-1);
+    else
+      m_solver.clear();
+    m_followers.erase(m_followers.begin() + i);
+    m_records.erase(vname);
+    m_record_utc.erase(vname);
+    m_drops++;
+    reportEvent("Dropped stale vehicle: " + vname);
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: updateFollowers()
+//      Note: New vehicles are added at the end. The solver then
+//            sees a new matrix size and starts cold.
+
+void ConvoyAssign::updateFollowers()
+{
+  map<string, double>::iterator p;
+  for(p=m_record_utc.begin(); p!=m_record_utc.end(); p++) {
+    string vname = p->first;
+    if((vname == m_leader) || ((m_curr_time - p->second) > m_stale_time))
+      continue;
+    if(!vectorContains(m_followers, vname))
+      m_followers.push_back(vname);
+  }
+
+  // A follower that became the leader leaves the follower rows
+  for(unsigned int i=0; i<m_followers.size(); i++) {
+    if(m_followers[i] == m_leader) {
+      m_followers.erase(m_followers.begin() + i);
+      m_solver.clear();
+      break;
+    }
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: buildCosts()
+//      Note: Slot k (1..n) is k*slot_spacing behind the leader on
+//            its current heading, moving with the leader. The cost
+//            of vehicle i to slot k is the time for vehicle i to
+//            join slot k (see InterceptBid).
+
+void ConvoyAssign::buildCosts()
+{
+  unsigned int n = m_followers.size();
+  m_costs.set_size(n, n);
+
+  const NodeRecord& lead = m_records[m_leader];
+  double lhdg = (90 - lead.getHeading()) * M_PI / 180;
+  double lcos = cos(lhdg);
+  double lsin = sin(lhdg);
+  double lspd = lead.getSpeed();
+
+  for(unsigned int i=0; i<n; i++) {
+    const NodeRecord& rec = m_records[m_followers[i]];
+    m_engine.setPose(rec.getX(), rec.getY(), rec.getHeading(), m_turn_radius);
+    for(unsigned int k=0; k<n; k++) {
+      double back = (k + 1) * m_slot_spacing;
+      double sx = lead.getX() - (back * lcos);
+      double sy = lead.getY() - (back * lsin);
+      m_intercept.setContact(sx, sy, lspd * lcos, lspd * lsin);
+      m_costs.at(i,k) = m_intercept.getBid(m_engine, rec.getSpeed());
+    }
+  }
+}
+
+//---------------------------------------------------------
+// Procedure: solveAndPost()
+//   Example: EXT_ORDERING_ALL = abe,cal,ben,deb
+//      Note: Same format as EXT_ORDERING in BHV_ConvoyPD, leader
+//            first. uFldShoreBroker bridges it to each vehicle as
+//            EXT_ORDERING (qbridge = EXT_ORDERING). Posted when the
+//            ordering changes, and again every repost_interval so
+//            a vehicle that missed it or joined late catches up.
+//            The assign flags go out with each post.
+
+void ConvoyAssign::solveAndPost()
+{
+  if((m_leader == "") || (m_records.count(m_leader) == 0))
+    return;
+  if(m_followers.empty())
+    return;
+
+  auto start = chrono::steady_clock::now();
+  buildCosts();
+  bool ok = m_solver.solve(m_costs);
+  auto end = chrono::steady_clock::now();
+  m_last_solve_msecs = chrono::duration<double, milli>(end - start).count();
+  if(!ok) {
+    reportRunWarning("Assignment failed: bad cost matrix");
+    return;
+  }
+  m_solves++;
+
+  const vector<unsigned int>& slots = m_solver.getAssignment();
+  vector<string> order(m_followers.size());
+  for(unsigned int i=0; i<slots.size(); i++)
+    order[slots[i]] = m_followers[i];
+
+  string ordering = m_leader;
+  for(unsigned int k=0; k<order.size(); k++)
+    ordering += "," + order[k];
+
+  Notify("CONVOY_ASSIGN_COST", m_solver.getTotalCost());
+  if((ordering == m_ordering) &&
+     ((m_curr_time - m_last_post_utc) < m_repost_interval))
+    return;
+
+  m_ordering = ordering;
+  Notify(m_ordering_var, m_ordering);
+  for(unsigned int i=0; i<m_assign_flags.size(); i++) {
+    string var = m_assign_flags[i].first;
+    string val = m_assign_flags[i].second;
+    if(isNumber(val))
+      Notify(var, atof(val.c_str()));
+    else
+      Notify(var, val);
+  }
+  m_last_post_utc = m_curr_time;
+  m_posts++;
+}
+
+//------------------------------------------------------------
+// Procedure: buildReport()
+
+bool ConvoyAssign::buildReport()
+{
+  m_msgs << "Configuration:" << endl;
+  m_msgs << "  leader:       " << m_leader << endl;
+  m_msgs << "  slot_spacing: " << doubleToStringX(m_slot_spacing,1) << endl;
+  m_msgs << "  turn_radius:  " << doubleToStringX(m_turn_radius,1) << endl;
+  m_msgs << "  ordering_var: " << m_ordering_var << endl;
+  m_msgs << "  assign_flags: " << m_assign_flags.size() << endl;
+  m_msgs << endl;
+  m_msgs << "State:" << endl;
+  m_msgs << "  solves:     " << m_solves << endl;
+  m_msgs << "  posts:      " << m_posts << endl;
+  m_msgs << "  drops:      " << m_drops << endl;
+  m_msgs << "  augments:   " << m_solver.getAugments() << endl;
+  m_msgs << "  solve time: " << doubleToString(m_last_solve_msecs,3) << " ms" << endl;
+  m_msgs << "  total cost: " << doubleToStringX(m_solver.getTotalCost(),1) << endl;
+  m_msgs << "  ordering:   " << m_ordering << endl;
+  m_msgs << endl;
+
+  ACTable actab(3);
+  actab << "Vehicle | Slot | Cost (s)";
+  actab.addHeaderLines();
+  const vector<unsigned int>& slots = m_solver.getAssignment();
+  for(unsigned int i=0; i<m_followers.size(); i++) {
+    if((i >= slots.size()) || (m_costs.n_rows != m_followers.size()))
+      break;
+    actab << m_followers[i];
+    actab << uintToString(slots[i] + 1);
+    actab << doubleToStringX(m_costs.at(i, slots[i]), 1);
+  }
+  m_msgs << actab.getFormattedString();
+
+  return(true);
+}
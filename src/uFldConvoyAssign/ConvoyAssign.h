@@ -0,0 +1,85 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoyAssign.h                                       */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef CONVOY_ASSIGN_HEADER
+#define CONVOY_ASSIGN_HEADER
+
+#include <string>
+#include <vector>
+#include <map>
+#include "MOOS/libMOOS/Thirdparty/AppCasting/AppCastingMOOSApp.h"
+#include "NodeRecord.h"
+#include "DubinsBidEngine.h"
+#include "InterceptBid.h"
+#include "ConvoySlotSolver.h"
+
+class ConvoyAssign : public AppCastingMOOSApp
+{
+ public:
+  ConvoyAssign();
+  ~ConvoyAssign() {}
+
+ protected: // Standard MOOSApp functions to overload
+  bool OnNewMail(MOOSMSG_LIST &NewMail);
+  bool Iterate();
+  bool OnConnectToServer();
+  bool OnStartUp();
+
+ protected: // Standard AppCastingMOOSApp function to overload
+  bool buildReport();
+
+ protected:
+  void registerVariables();
+  bool handleMailNodeReport(std::string);
+  bool handleConfigVehicles(std::string);
+  bool handleConfigAssignFlag(std::string);
+
+  void dropStaleFollowers();
+  void updateFollowers();
+  void buildCosts();
+  void solveAndPost();
+
+ private: // Configuration variables
+  std::string m_leader;
+  std::vector<std::string> m_vehicles;
+  std::string m_ordering_var;
+
+  double m_slot_spacing;
+  double m_turn_radius;
+  double m_solve_interval;
+  double m_stale_time;
+  double m_repost_interval;
+
+  // Posted along with each ordering, e.g. CONVOY_ALL=true
+  std::vector<std::pair<std::string, std::string> > m_assign_flags;
+
+ private: // State variables
+  std::map<std::string, NodeRecord> m_records;
+  std::map<std::string, double>     m_record_utc;
+
+  // Followers in row order of the cost matrix
+  std::vector<std::string> m_followers;
+
+  arma::mat        m_costs;
+  DubinsBidEngine  m_engine;
+  InterceptBid     m_intercept;
+  ConvoySlotSolver m_solver;
+
+  std::string  m_ordering;
+  double       m_last_solve_utc;
+  double       m_last_post_utc;
+  double       m_last_solve_msecs;
+  unsigned int m_solves;
+  unsigned int m_posts;
+  unsigned int m_drops;
+};
+
+#endif
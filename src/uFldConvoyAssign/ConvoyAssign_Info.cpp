@@ -0,0 +1,136 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoyAssign_Info.cpp                                */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <cstdlib>
+#include <iostream>
+#include "ConvoyAssign_Info.h"
+#include "ColorParse.h"
+#include "ReleaseInfo.h"
+
+using namespace std;
+
+//----------------------------------------------------------------
+// Procedure: showSynopsis
+
+void showSynopsis()
+{
+  blk("SYNOPSIS:                                                       ");
+  blk("------------------------------------                            ");
+  blk("  The uFldConvoyAssign application runs on the shoreside and    ");
+  blk("  assigns convoy slots to vehicles. From node reports it builds ");
+  blk("  the time for every follower to join every slot behind the     ");
+  blk("  leader, solves for the minimum total time assignment, and     ");
+  blk("  posts the resulting convoy ordering in one message.           ");
+}
+
+//----------------------------------------------------------------
+// Procedure: showHelpAndExit
+
+void showHelpAndExit()
+{
+  blk("                                                                ");
+  blu("=============================================================== ");
+  blu("Usage: uFldConvoyAssign file.moos [OPTIONS]                     ");
+  blu("=============================================================== ");
+  blk("                                                                ");
+  showSynopsis();
+  blk("                                                                ");
+  blk("Options:                                                        ");
+  mag("  --alias","=<ProcessName>                                      ");
+  blk("      Launch uFldConvoyAssign with the given process name       ");
+  blk("      rather than uFldConvoyAssign.                             ");
+  mag("  --example, -e                                                 ");
+  blk("      Display example MOOS configuration block.                 ");
+  mag("  --help, -h                                                    ");
+  blk("      Display this help message.                                ");
+  mag("  --interface, -i                                               ");
+  blk("      Display MOOS publications and subscriptions.              ");
+  mag("  --version,-v                                                  ");
+  blk("      Display the release version of uFldConvoyAssign.          ");
+  blk("                                                                ");
+  blk("Note: If argv[2] does not otherwise match a known option,       ");
+  blk("      then it will be interpreted as a run alias. This is       ");
+  blk("      to support pAntler launching conventions.                 ");
+  blk("                                                                ");
+  exit(0);
+}
+
+//----------------------------------------------------------------
+// Procedure: showExampleConfigAndExit
+
+void showExampleConfigAndExit()
+{
+  blk("                                                                ");
+  blu("=============================================================== ");
+  blu("uFldConvoyAssign Example MOOS Configuration                     ");
+  blu("=============================================================== ");
+  blk("                                                                ");
+  blk("ProcessConfig = uFldConvoyAssign                                ");
+  blk("{                                                               ");
+  blk("  AppTick   = 4                                                 ");
+  blk("  CommsTick = 4                                                 ");
+  blk("                                                                ");
+  blk("  leader         = abe               // or via CONVOY_LEADER    ");
+  blk("  vehicles       = ben,cal,deb       // default all reporting   ");
+  blk("  ordering_var   = EXT_ORDERING_ALL  // (default)               ");
+  blk("                                                                ");
+  blk("  slot_spacing   = 10                // meters (default)        ");
+  blk("  turn_radius    = 5                 // meters (default)        ");
+  blk("  join_speed     = 0                 // m/s, 0=reported speed   ");
+  blk("  max_join_time  = 600               // seconds (default)       ");
+  blk("  solve_interval = 2                 // seconds (default)       ");
+  blk("  stale_time     = 10                // seconds (default)       ");
+  blk("  repost_interval = 5                // seconds (default)       ");
+  blk("                                                                ");
+  blk("  assign_flag    = CONVOY_ALL=true   // posted with ordering    ");
+  blk("}                                                               ");
+  blk("                                                                ");
+  exit(0);
+}
+
+//----------------------------------------------------------------
+// Procedure: showInterfaceAndExit
+
+void showInterfaceAndExit()
+{
+  blk("                                                                ");
+  blu("=============================================================== ");
+  blu("uFldConvoyAssign INTERFACE                                      ");
+  blu("=============================================================== ");
+  blk("                                                                ");
+  showSynopsis();
+  blk("                                                                ");
+  blk("SUBSCRIPTIONS:                                                  ");
+  blk("------------------------------------                            ");
+  blk("  NODE_REPORT   = NAME=ben,X=10,Y=-20,SPD=1.2,HDG=90,...        ");
+  blk("  CONVOY_LEADER = abe                                           ");
+  blk("                                                                ");
+  blk("PUBLICATIONS:                                                   ");
+  blk("------------------------------------                            ");
+  blk("  EXT_ORDERING_ALL   = abe,cal,ben,deb                          ");
+  blk("                       Leader first, posted when it changes     ");
+  blk("                       and every repost_interval. Bridge to     ");
+  blk("                       vehicles with uFldShoreBroker            ");
+  blk("                       qbridge=EXT_ORDERING, and set            ");
+  blk("                       ext_assign=true in BHV_ConvoyPD.         ");
+  blk("  CONVOY_ASSIGN_COST = 84.2                                     ");
+  blk("                                                                ");
+  exit(0);
+}
+
+//----------------------------------------------------------------
+// Procedure: showReleaseInfoAndExit
+
+void showReleaseInfoAndExit()
+{
+  showReleaseInfo("uFldConvoyAssign", "gpl");
+  exit(0);
+}
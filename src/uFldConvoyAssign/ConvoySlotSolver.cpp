@@ -0,0 +1,165 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoySlotSolver.cpp                                 */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#include <limits>
+#include "ConvoySlotSolver.h"
+
+using namespace std;
+
+static const double inf = numeric_limits<double>::infinity();
+
+//---------------------------------------------------------
+// Procedure: clear()
+
+void ConvoySlotSolver::clear()
+{
+  m_u.clear();
+  m_v.clear();
+  m_col_row.clear();
+  m_row_col.clear();
+  m_total_cost = 0;
+  m_augments = 0;
+}
+
+//---------------------------------------------------------
+// Procedure: dropRow()
+//      Note: Removes a vehicle and a slot from the kept solution
+//            so the next solve, on the smaller matrix, can start
+//            from it. The vehicle in the dropped slot, if not
+//            the dropped vehicle itself, is left unassigned.
+
+void ConvoySlotSolver::dropRow(unsigned int row, unsigned int col)
+{
+  unsigned int n = m_u.size();
+  if((row >= n) || (col >= n) || (m_v.size() != n+1))
+    return;
+
+  m_u.erase(m_u.begin() + row);
+  m_v.erase(m_v.begin() + col);
+  m_col_row.erase(m_col_row.begin() + col);
+
+  for(unsigned int j=0; j<n-1; j++) {
+    int i = m_col_row[j];
+    if(i == (int)(row))
+      m_col_row[j] = -1;
+    else if(i > (int)(row))
+      m_col_row[j] = i - 1;
+  }
+  // The virtual column, last entry, is reset on each augment
+  m_col_row[n-1] = -1;
+}
+
+//---------------------------------------------------------
+// Procedure: solve()
+//   Returns: false if the matrix is not square or has a
+//            non-finite entry
+
+bool ConvoySlotSolver::solve(const arma::mat& costs)
+{
+  unsigned int n = costs.n_rows;
+  if((costs.n_cols != n) || !costs.is_finite())
+    return(false);
+
+  // Start cold unless the kept state matches this size
+  if((m_u.size() != n) || (m_v.size() != n+1) || (m_col_row.size() != n+1)) {
+    m_u.assign(n, 0);
+    m_v.assign(n+1, 0);
+    m_col_row.assign(n+1, -1);
+  }
+
+  // Keep a row's slot only if it is still the cheapest for that
+  // row under the kept slot potentials, so the kept pairs are
+  // tight and the potentials feasible for the kept rows.
+  vector<char> keep(n, 0);
+  for(unsigned int j=0; j<n; j++) {
+    int i = m_col_row[j];
+    if(i < 0)
+      continue;
+    double reduced = costs.at(i,j) - m_v[j];
+    bool tight = true;
+    for(unsigned int k=0; tight && (k<n); k++)
+      tight = ((costs.at(i,k) - m_v[k]) >= reduced);
+    if(tight && !keep[i]) {
+      keep[i] = 1;
+      m_u[i] = reduced;
+    }
+    else
+      m_col_row[j] = -1;
+  }
+
+  m_augments = 0;
+  for(unsigned int i=0; i<n; i++) {
+    if(!keep[i]) {
+      augment(costs, i);
+      m_augments++;
+    }
+  }
+
+  m_row_col.assign(n, 0);
+  m_total_cost = 0;
+  for(unsigned int j=0; j<n; j++) {
+    m_row_col[m_col_row[j]] = j;
+    m_total_cost += costs.at(m_col_row[j], j);
+  }
+  return(true);
+}
+
+//---------------------------------------------------------
+// Procedure: augment()
+//      Note: Dijkstra over reduced costs from the free row to the
+//            nearest free column, then flip the path. Column n is
+//            a virtual column holding the starting row.
+
+void ConvoySlotSolver::augment(const arma::mat& costs, unsigned int row)
+{
+  unsigned int n = costs.n_rows;
+  m_minv.assign(n+1, inf);
+  m_way.assign(n+1, -1);
+  m_used.assign(n+1, 0);
+
+  unsigned int j0 = n;
+  m_col_row[n] = row;
+  do {
+    m_used[j0] = 1;
+    unsigned int i0 = m_col_row[j0];
+    double delta = inf;
+    unsigned int j1 = n;
+    for(unsigned int j=0; j<n; j++) {
+      if(m_used[j])
+	continue;
+      double cur = costs.at(i0,j) - m_u[i0] - m_v[j];
+      if(cur < m_minv[j]) {
+	m_minv[j] = cur;
+	m_way[j] = j0;
+      }
+      if(m_minv[j] < delta) {
+	delta = m_minv[j];
+	j1 = j;
+      }
+    }
+    for(unsigned int j=0; j<=n; j++) {
+      if(m_used[j]) {
+	m_u[m_col_row[j]] += delta;
+	m_v[j] -= delta;
+      }
+      else
+	m_minv[j] -= delta;
+    }
+    j0 = j1;
+  } while(m_col_row[j0] >= 0);
+
+  do {
+    unsigned int j1 = m_way[j0];
+    m_col_row[j0] = m_col_row[j1];
+    j0 = j1;
+  } while(j0 != n);
+  m_col_row[n] = -1;
+}
@@ -0,0 +1,69 @@
+/*****************************************************************/
+/*    NAME: Michael Benjamin                                     */
+/*    ORGN: Dept of Mechanical Engineering, MIT, Cambridge MA    */
+/*    FILE: ConvoySlotSolver.h                                   */
+/*    DATE: Oct 19th 2026                                        */
+/*                                                               */
+/* This is unreleased BETA code. No permission is granted or     */
+/* implied to use, copy, modify, and distribute this software    */
+/* except by the author(s), or those designated by the author.   */
+/*****************************************************************/
+
+#ifndef CONVOY_SLOT_SOLVER_HEADER
+#define CONVOY_SLOT_SOLVER_HEADER
+
+#include <vector>
+#include <armadillo>
+
+//---------------------------------------------------------------
+// ConvoySlotSolver: minimum cost assignment of n vehicles (rows)
+// to n slots (columns), Hungarian method in the shortest
+// augmenting path form, O(n^3).
+//
+// The dual potentials and the assignment are kept between calls.
+// On the next solve, a row keeps its slot if that slot is still
+// its cheapest under the kept slot potentials. Only the other
+// rows are augmented. With dropRow() this makes the re-solve
+// after a vehicle drops out a single augmentation when the other
+// costs are unchanged, and keeps re-solves cheap when costs
+// drift slowly between rounds.
+
+class ConvoySlotSolver
+{
+ public:
+  ConvoySlotSolver() {m_augments = 0;}
+  ~ConvoySlotSolver() {}
+
+  bool solve(const arma::mat& costs);
+  void dropRow(unsigned int row, unsigned int col);
+  void clear();
+
+  // Slot assigned to each row, and total cost of the last solve
+  const std::vector<unsigned int>& getAssignment() const {return(m_row_col);}
+  double getTotalCost() const {return(m_total_cost);}
+
+  // Rows augmented in the last solve (n for a cold solve)
+  unsigned int getAugments() const {return(m_augments);}
+
+  // Size of the kept solution, zero if none
+  unsigned int size() const {return(m_u.size());}
+
+ protected:
+  void augment(const arma::mat& costs, unsigned int row);
+
+ private:
+  std::vector<double> m_u;           // row potentials
+  std::vector<double> m_v;           // col potentials, plus one
+  std::vector<int>    m_col_row;     // row in each col, -1 if free
+  std::vector<unsigned int> m_row_col;
+
+  // Scratch space for augment(), reused
+  std::vector<double> m_minv;
+  std::vector<int>    m_way;
+  std::vector<char>   m_used;
+
+  double       m_total_cost;
+  unsigned int m_augments;
+};
+
+#endif